@@ -118,6 +118,12 @@ public:
    *  @param userData user data (void ptr)
    */
   void subscribeStereoImages(const ImageSelection *select, VehicleCallBack callback = 0, UserData userData = 0);
+  /*! @brief subscribe to 240p stereo images at 20 fps, the callback gets a
+   *  view of the received frame instead of a RecvContainer copy
+   *
+   *  @platforms M210V2
+   */
+  void subscribeStereoImages(const ImageSelection *select, VehicleViewCallBack callback, UserData userData = 0);
   /*! @brief subscribe to VGA (480x640) front stereo images at 10 or 20 fps
    *
    *  @platforms M210V2, M300
@@ -126,6 +132,12 @@ public:
    *  @param userData user data (void ptr)
    */
   void subscribeFrontStereoVGA(const uint8_t freq, VehicleCallBack callback = 0, UserData userData = 0);
+  /*! @brief subscribe to VGA (480x640) front stereo images, the callback gets
+   *  a view of the received frame instead of a RecvContainer copy
+   *
+   *  @platforms M210V2, M300
+   */
+  void subscribeFrontStereoVGA(const uint8_t freq, VehicleViewCallBack callback, UserData userData = 0);
   /*! @brief subscribe to QVGA (240x320) stereo depth map at 10 fps
    *
    *  @platforms M210V2
@@ -133,6 +145,12 @@ public:
    *  @param userData user data (void ptr)
    */
   void subscribeFrontStereoDisparity(VehicleCallBack callback = 0, UserData userData = 0);
+  /*! @brief subscribe to QVGA (240x320) stereo depth map at 10 fps, the
+   *  callback gets a view of the received frame instead of a RecvContainer copy
+   *
+   *  @platforms M210V2
+   */
+  void subscribeFrontStereoDisparity(VehicleViewCallBack callback, UserData userData = 0);
   /*!
    *  @brief unsubscribe to QVGA (240x320) stereo depth map or images
    *
@@ -185,6 +203,34 @@ public:
    *  @return true if successfully started, false otherwise
    */
   bool startMainCameraStream(CameraImageCallback cb = NULL, void * cbParam = NULL);
+  /*! @brief
+   *
+   *  Start the FPV Camera Stream with a given decoder output
+   *
+   *  @platforms M210V2, M300
+   *  @param config pixel format, size and scaling algorithm of the images
+   *         delivered by the callback and getFPVCameraImage()
+   *  @param cb callback function that is called in a callback thread when a new
+   *            image is received and decoded
+   *  @param cbParam a void pointer that users can manipulate inside the callback
+   *  @return true if successfully started, false otherwise
+   */
+  bool startFPVCameraStream(const CameraImageOutputConfig& config,
+                            CameraImageCallback cb = NULL, void * cbParam = NULL);
+  /*! @brief
+   *
+   *  Start the Main Camera Stream with a given decoder output
+   *
+   *  @platforms M210V2, M300
+   *  @param config pixel format, size and scaling algorithm of the images
+   *         delivered by the callback and getMainCameraImage()
+   *  @param cb callback function that is called in a callback thread when a new
+   *            image is received and decoded
+   *  @param cbParam a void pointer that users can manipulate inside the callback
+   *  @return true if successfully started, false otherwise
+   */
+  bool startMainCameraStream(const CameraImageOutputConfig& config,
+                             CameraImageCallback cb = NULL, void * cbParam = NULL);
   /*! @brief
    *
    *  Set the ACM device path, mainly for M210V2
@@ -244,6 +290,32 @@ public:
    *  @return true if a new image frame is ready, false if timeout
    */
   bool getMainCameraImage(CameraRGBImage& copyOfImage);
+  /*! @brief Get a read-only view of the new image from the FPV camera
+   *
+   *  @platforms M210V2, M300
+   *  @param view A reference to the new available image will be put here,
+   *         the pixels are not copied. The frame is not reused by the
+   *         decoder while the view is alive.
+   *  @note If a new image is not ready upon calling this function,
+   *        it will wait for 20ms till timeout. If several images were
+   *        decoded since the last call, only the newest one is returned.
+   *
+   *  @return true if a new image frame is ready, false if timeout
+   */
+  bool getFPVCameraImageView(CameraRGBImageView& view);
+  /*! @brief Get a read-only view of the new image from the main camera
+   *
+   *  @platforms M210V2, M300
+   *  @param view A reference to the new available image will be put here,
+   *         the pixels are not copied. The frame is not reused by the
+   *         decoder while the view is alive.
+   *  @note If a new image is not ready upon calling this function,
+   *        it will wait for 20ms till timeout. If several images were
+   *        decoded since the last call, only the newest one is returned.
+   *
+   *  @return true if a new image frame is ready, false if timeout
+   */
+  bool getMainCameraImageView(CameraRGBImageView& view);
 
   /*! @brief
    *  Change the camera stream source from one payload device. (Beta API)
@@ -353,6 +425,9 @@ AdvancedSensingProtocol* getAdvancedSensingProtocol();
 public:
 VehicleCallBackHandler stereoHandler;
 VehicleCallBackHandler vgaHandler;
+/*! Take precedence over the by-value handlers above when set */
+VehicleViewCallBackHandler stereoViewHandler;
+VehicleViewCallBackHandler vgaViewHandler;
 };
 
 } // OSDK
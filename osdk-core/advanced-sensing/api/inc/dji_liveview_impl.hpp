@@ -33,6 +33,9 @@
 #include "dji_vehicle.hpp"
 #include "dji_liveview.hpp"
 #include "dji_linker.hpp"
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 namespace DJI {
 namespace OSDK {
@@ -59,6 +62,19 @@ class LiveViewImpl {
 
  private:
 
+  /*! Handler of one camera position. A handler is never changed once
+   *  published, the setter publishes a new one, so the cb and userData of a
+   *  dispatch always belong together. The USB receive thread counts itself
+   *  in readers around the load and the call, and a replaced handler is only
+   *  freed by a later set once no dispatch runs, so dispatching a frame
+   *  needs neither a lock nor an allocation.
+   */
+  typedef struct H264CallbackSlot {
+    std::atomic<const H264CallbackHandler *> active;
+    std::atomic<uint32_t> readers;
+    std::vector<const H264CallbackHandler *> retired;
+  } H264CallbackSlot;
+
   typedef enum E_OSDKCameraType {
     OSDK_CAMERA_TYPE_PSDK = 31,
     OSDK_CAMERA_TYPE_FPV = 39,  //Matrice FPV
@@ -168,12 +184,23 @@ class LiveViewImpl {
   Vehicle *vehicle;
 
  private:
-  static std::map<LiveView::LiveViewCameraPosition, H264CallbackHandler> h264CbHandlerMap;
-  static T_RecvCmdItem bulkCmdList[];
+  /*! Drives RecordStreamHandler in liveview_dispatch_benchmark */
+  friend class LiveViewDispatchBench;
+
+  /*! Publish a handler for pos, NULL cb to drop the frames */
+  static void setH264Callback(LiveView::LiveViewCameraPosition pos,
+                              H264Callback cb, void *userData);
+
+  /*! Dispatch of the H.264 packs of all positions, userData is the table */
   static E_OsdkStat RecordStreamHandler(struct _CommandHandle *cmdHandle,
                                         const T_CmdInfo *cmdInfo,
                                         const uint8_t *cmdData,
                                         void *userData);
+  static H264CallbackSlot h264CbHandlerTable[LiveView::OSDK_CAMERA_POSITION_FPV + 1];
+  static std::mutex h264CbMutex;
+  /*! Publish the handler noting frames of pos if none is set */
+  static void setDefaultH264Callback(LiveView::LiveViewCameraPosition pos);
+  static T_RecvCmdItem bulkCmdList[];
   static E_OsdkStat getCameraPushing(struct _CommandHandle *cmdHandle,
                                      const T_CmdInfo *cmdInfo,
                                      const uint8_t *cmdData, void *userData);
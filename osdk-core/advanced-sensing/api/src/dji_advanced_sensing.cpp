@@ -83,10 +83,14 @@ AdvancedSensing::AdvancedSensing(Vehicle* vehiclePtr) :
   fpvCam_ptr(NULL),
   mainCam_ptr(NULL)
 {
-  stereoHandler.callback  = 0;
-  stereoHandler.userData  = 0;
-  vgaHandler.callback     = 0;
-  vgaHandler.userData     = 0;
+  stereoHandler.callback     = 0;
+  stereoHandler.userData     = 0;
+  vgaHandler.callback        = 0;
+  vgaHandler.userData        = 0;
+  stereoViewHandler.callback = 0;
+  stereoViewHandler.userData = 0;
+  vgaViewHandler.callback    = 0;
+  vgaViewHandler.userData    = 0;
   streamDecoder.clear();
   // call a closed-source version of getDroneVersion() to prevent hacking
   internalGetDroneVersion(vehiclePtr);
@@ -228,6 +232,8 @@ AdvancedSensing::subscribeStereoImages(const ImageSelection *select, VehicleCall
 
   uint8_t* data = (uint8_t*)&(config.image_selected);
 
+  stereoViewHandler.callback = 0;
+  stereoViewHandler.userData = 0;
   if (callback)
   {
     stereoHandler.callback = callback;
@@ -246,6 +252,7 @@ AdvancedSensing::subscribeStereoImages(const ImageSelection *select, VehicleCall
 
 typedef struct M300VGAHandlerData {
   VehicleCallBackHandler handler;
+  VehicleViewCallBackHandler viewHandler;
   Vehicle* vehicle;
 } M300VGAHandlerData;
 
@@ -267,7 +274,7 @@ void M300VGAHandleCB(Perception::ImageInfoType info, uint8_t *imageRawBuffer,
     DERROR("Error userdata");
     return;
   }
-  if (!m300Handler->handler.callback) {
+  if ((!m300Handler->handler.callback) && (!m300Handler->viewHandler.callback)) {
     DERROR("Error callback");
     return;
   }
@@ -289,10 +296,18 @@ void M300VGAHandleCB(Perception::ImageInfoType info, uint8_t *imageRawBuffer,
           (stereoVGAImg.time_stamp == info.timeStamp)) {
         DSTATUS("#### ( 2 ) get the second VGA image");
         memcpy(stereoVGAImg.img_vec[1], imageRawBuffer, 480 * 640);
-        RecvContainer recvFrame = {0};
-        recvFrame.recvData.stereoVGAImgData = &stereoVGAImg;
-        m300Handler->handler.callback(m300Handler->vehicle, recvFrame,
-                                      m300Handler->handler.userData);
+        if (m300Handler->viewHandler.callback) {
+          RecvFrameView view = {};
+          view.data = (const uint8_t *) &stereoVGAImg;
+          view.dataLen = sizeof(stereoVGAImg);
+          m300Handler->viewHandler.callback(m300Handler->vehicle, view,
+                                            m300Handler->viewHandler.userData);
+        } else {
+          RecvContainer recvFrame = {0};
+          recvFrame.recvData.stereoVGAImgData = &stereoVGAImg;
+          m300Handler->handler.callback(m300Handler->vehicle, recvFrame,
+                                        m300Handler->handler.userData);
+        }
         stereoVGAImg.num_imgs = 0;
       } else {
         /*! replace the first VGA image */
@@ -338,6 +353,8 @@ AdvancedSensing::subscribeFrontStereoVGA(const uint8_t freq,
 
     uint8_t *data = (uint8_t *) &(config.vga_subscription);
 
+    vgaViewHandler.callback = 0;
+    vgaViewHandler.userData = 0;
     if (callback) {
       vgaHandler.callback = callback;
       vgaHandler.userData = userData;
@@ -356,6 +373,7 @@ AdvancedSensing::subscribeFrontStereoVGA(const uint8_t freq,
     static M300VGAHandlerData m300handler;
     m300handler.vehicle = vehicle_ptr;
     m300handler.handler = {callback, userData};
+    m300handler.viewHandler = {NULL, NULL};
     perception->subscribePerceptionImage(Perception::RECTIFY_FRONT, M300VGAHandleCB, &m300handler);
   }
 }
@@ -381,6 +399,8 @@ AdvancedSensing::subscribeFrontStereoDisparity(VehicleCallBack callback, UserDat
 
   uint8_t* data = (uint8_t*)&(config.image_selected);
 
+  stereoViewHandler.callback = 0;
+  stereoViewHandler.userData = 0;
   if (callback)
   {
     stereoHandler.callback = callback;
@@ -397,6 +417,46 @@ AdvancedSensing::subscribeFrontStereoDisparity(VehicleCallBack callback, UserDat
   sendCommonCmd(NULL, 0, AdvancedSensingProtocol::START_CMD_ID);
 }
 
+void
+AdvancedSensing::subscribeStereoImages(const ImageSelection *select,
+                                       VehicleViewCallBack callback,
+                                       UserData userData)
+{
+  subscribeStereoImages(select, (VehicleCallBack)0, NULL);
+  stereoViewHandler.callback = callback;
+  stereoViewHandler.userData = userData;
+}
+
+void
+AdvancedSensing::subscribeFrontStereoVGA(const uint8_t freq,
+                                         VehicleViewCallBack callback,
+                                         UserData userData)
+{
+  if (vehicle_ptr->isM300()) {
+    DSTATUS("M300 VGA freq is running at a default value at 20Hz. So the "
+            "parameter freq is useless here.");
+    static M300VGAHandlerData m300handler;
+    m300handler.vehicle = vehicle_ptr;
+    m300handler.handler = {NULL, NULL};
+    m300handler.viewHandler = {callback, userData};
+    perception->subscribePerceptionImage(Perception::RECTIFY_FRONT, M300VGAHandleCB, &m300handler);
+    return;
+  }
+
+  subscribeFrontStereoVGA(freq, (VehicleCallBack)0, NULL);
+  vgaViewHandler.callback = callback;
+  vgaViewHandler.userData = userData;
+}
+
+void
+AdvancedSensing::subscribeFrontStereoDisparity(VehicleViewCallBack callback,
+                                               UserData userData)
+{
+  subscribeFrontStereoDisparity((VehicleCallBack)0, NULL);
+  stereoViewHandler.callback = callback;
+  stereoViewHandler.userData = userData;
+}
+
 void
 AdvancedSensing::unsubscribeStereoImages()
 {
@@ -475,10 +535,17 @@ void H264ToRGBCb(uint8_t* buf, int bufLen, void* userData) {
 
 bool AdvancedSensing::startFPVCameraStream(CameraImageCallback cb,
                                            void *cbParam) {
+  return startFPVCameraStream(CameraImageOutputConfig(), cb, cbParam);
+}
+
+bool AdvancedSensing::startFPVCameraStream(const CameraImageOutputConfig& config,
+                                           CameraImageCallback cb,
+                                           void *cbParam) {
   if (vehicle_ptr->isM300()) {
     auto deocderPair = streamDecoder.find(LiveView::OSDK_CAMERA_POSITION_FPV);
     if ((deocderPair != streamDecoder.end()) && deocderPair->second) {
       deocderPair->second->init();
+      deocderPair->second->setOutputConfig(config);
       deocderPair->second->registerCallback(cb, cbParam);
       return (LiveView::OSDK_LIVEVIEW_PASS
           == startH264Stream(LiveView::OSDK_CAMERA_POSITION_FPV, H264ToRGBCb,
@@ -487,17 +554,25 @@ bool AdvancedSensing::startFPVCameraStream(CameraImageCallback cb,
       return false;
     }
   } else {
+    fpvCam_ptr->setOutputConfig(config);
     return fpvCam_ptr->startCameraStream(cb, cbParam);
   }
 }
 
 bool AdvancedSensing::startMainCameraStream(CameraImageCallback cb, void * cbParam)
+{
+  return startMainCameraStream(CameraImageOutputConfig(), cb, cbParam);
+}
+
+bool AdvancedSensing::startMainCameraStream(const CameraImageOutputConfig& config,
+                                            CameraImageCallback cb, void * cbParam)
 {
   // Use the keep_camera_x5s_state to prevent x5s become a storage device, otherwise could not get the stream
   if (vehicle_ptr->isM300()) {
     auto deocderPair = streamDecoder.find(LiveView::OSDK_CAMERA_POSITION_NO_1);
     if ((deocderPair != streamDecoder.end()) && deocderPair->second) {
       deocderPair->second->init();
+      deocderPair->second->setOutputConfig(config);
       deocderPair->second->registerCallback(cb, cbParam);
       return (LiveView::OSDK_LIVEVIEW_PASS
           == startH264Stream(LiveView::OSDK_CAMERA_POSITION_NO_1, H264ToRGBCb,
@@ -506,6 +581,7 @@ bool AdvancedSensing::startMainCameraStream(CameraImageCallback cb, void * cbPar
       return false;
     }
   } else {
+    mainCam_ptr->setOutputConfig(config);
     return mainCam_ptr->startCameraStream(cb, cbParam);
   }
 }
@@ -592,6 +668,34 @@ bool AdvancedSensing::getFPVCameraImage(CameraRGBImage& copyOfImage)
   return ret;
 }
 
+bool AdvancedSensing::getMainCameraImageView(CameraRGBImageView& view)
+{
+  bool ret = false;
+  if (vehicle_ptr->isM300()) {
+    auto deocderPair = streamDecoder.find(LiveView::OSDK_CAMERA_POSITION_NO_1);
+    if ((deocderPair != streamDecoder.end()) && deocderPair->second) {
+      ret = deocderPair->second->getNewImageView(view, 20);
+    }
+  } else {
+    ret = mainCam_ptr->getCurrentImageView(view);
+  }
+  return ret;
+}
+
+bool AdvancedSensing::getFPVCameraImageView(CameraRGBImageView& view)
+{
+  bool ret = false;
+  if (vehicle_ptr->isM300()) {
+    auto deocderPair = streamDecoder.find(LiveView::OSDK_CAMERA_POSITION_FPV);
+    if ((deocderPair != streamDecoder.end()) && deocderPair->second) {
+      ret = deocderPair->second->getNewImageView(view, 20);
+    }
+  } else {
+    ret = fpvCam_ptr->getCurrentImageView(view);
+  }
+  return ret;
+}
+
 void AdvancedSensing::setAcmDevicePath(const char *acm_path)
 {
     this->acm_dev=acm_path;
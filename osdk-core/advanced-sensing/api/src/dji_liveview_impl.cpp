@@ -61,23 +61,24 @@ void defaultH264CB(uint8_t* buf, int bufLen, void* userData) {
   *(uint8_t *)userData = 1;
 }
 
-std::map<LiveView::LiveViewCameraPosition, LiveViewImpl::H264CallbackHandler> LiveViewImpl::h264CbHandlerMap = {
-        {LiveView::OSDK_CAMERA_POSITION_NO_1, {defaultH264CB, (void *)&(defUserData[LiveView::OSDK_CAMERA_POSITION_NO_1])}},
-        {LiveView::OSDK_CAMERA_POSITION_NO_2, {defaultH264CB, (void *)&(defUserData[LiveView::OSDK_CAMERA_POSITION_NO_2])}},
-        {LiveView::OSDK_CAMERA_POSITION_NO_3, {defaultH264CB, (void *)&(defUserData[LiveView::OSDK_CAMERA_POSITION_NO_3])}},
-        {LiveView::OSDK_CAMERA_POSITION_FPV,  {defaultH264CB, (void *)&(defUserData[LiveView::OSDK_CAMERA_POSITION_FPV])}},
-    };
+LiveViewImpl::H264CallbackSlot LiveViewImpl::h264CbHandlerTable[LiveView::OSDK_CAMERA_POSITION_FPV + 1];
+std::mutex LiveViewImpl::h264CbMutex;
 
 T_RecvCmdItem LiveViewImpl::bulkCmdList[] = {
-    PROT_CMD_ITEM(0, 0, LIVEVIEW_TEMP_CMD_SET, LIVEVIEW_FPV_CAM_TEMP_CMD_ID,  MASK_HOST_DEVICE_SET_ID, (void *)&h264CbHandlerMap, RecordStreamHandler),
-    PROT_CMD_ITEM(0, 0, LIVEVIEW_TEMP_CMD_SET, LIVEVIEW_MAIN_CAM_TEMP_CMD_ID, MASK_HOST_DEVICE_SET_ID, (void *)&h264CbHandlerMap, RecordStreamHandler),
-    PROT_CMD_ITEM(0, 0, LIVEVIEW_TEMP_CMD_SET, LIVEVIEW_VICE_CAM_TEMP_CMD_ID, MASK_HOST_DEVICE_SET_ID, (void *)&h264CbHandlerMap, RecordStreamHandler),
-    PROT_CMD_ITEM(0, 0, LIVEVIEW_TEMP_CMD_SET, LIVEVIEW_TOP_CAM_TEMP_CMD_ID,  MASK_HOST_DEVICE_SET_ID, (void *)&h264CbHandlerMap, RecordStreamHandler),
+    PROT_CMD_ITEM(0, 0, LIVEVIEW_TEMP_CMD_SET, LIVEVIEW_FPV_CAM_TEMP_CMD_ID,  MASK_HOST_DEVICE_SET_ID, (void *)h264CbHandlerTable, RecordStreamHandler),
+    PROT_CMD_ITEM(0, 0, LIVEVIEW_TEMP_CMD_SET, LIVEVIEW_MAIN_CAM_TEMP_CMD_ID, MASK_HOST_DEVICE_SET_ID, (void *)h264CbHandlerTable, RecordStreamHandler),
+    PROT_CMD_ITEM(0, 0, LIVEVIEW_TEMP_CMD_SET, LIVEVIEW_VICE_CAM_TEMP_CMD_ID, MASK_HOST_DEVICE_SET_ID, (void *)h264CbHandlerTable, RecordStreamHandler),
+    PROT_CMD_ITEM(0, 0, LIVEVIEW_TEMP_CMD_SET, LIVEVIEW_TOP_CAM_TEMP_CMD_ID,  MASK_HOST_DEVICE_SET_ID, (void *)h264CbHandlerTable, RecordStreamHandler),
 };
 
 LiveViewImpl::LiveViewImpl(Vehicle* vehiclePtr) :
     vehicle(vehiclePtr)
 {
+  setDefaultH264Callback(LiveView::OSDK_CAMERA_POSITION_NO_1);
+  setDefaultH264Callback(LiveView::OSDK_CAMERA_POSITION_NO_2);
+  setDefaultH264Callback(LiveView::OSDK_CAMERA_POSITION_NO_3);
+  setDefaultH264Callback(LiveView::OSDK_CAMERA_POSITION_FPV);
+
   T_RecvCmdHandle recvCmdHandle;
   recvCmdHandle.cmdList = bulkCmdList;
   recvCmdHandle.cmdCount = sizeof(bulkCmdList) / sizeof(T_RecvCmdItem);
@@ -110,8 +111,7 @@ E_OsdkStat LiveViewImpl::RecordStreamHandler(struct _CommandHandle *cmdHandle,
     return OSDK_STAT_ERR;
   }
 
-  std::map<LiveView::LiveViewCameraPosition, H264CallbackHandler> handlerMap =
-      *(std::map<LiveView::LiveViewCameraPosition, H264CallbackHandler> *)userData;
+  H264CallbackSlot *handlerTable = (H264CallbackSlot *)userData;
 
   LiveView::LiveViewCameraPosition pos;
   switch (cmdInfo->cmdId) {
@@ -131,15 +131,55 @@ E_OsdkStat LiveViewImpl::RecordStreamHandler(struct _CommandHandle *cmdHandle,
       return OSDK_STAT_ERR_OUT_OF_RANGE;
   }
 
-  if((handlerMap.find(pos) != handlerMap.end()) && (handlerMap[pos].cb != NULL)) {
-    handlerMap[pos].cb((uint8_t *)cmdData, cmdInfo->dataLen, handlerMap[pos].userData);
+  H264CallbackSlot *slot = &handlerTable[pos];
+  slot->readers.fetch_add(1, std::memory_order_seq_cst);
+  const H264CallbackHandler *handler =
+      slot->active.load(std::memory_order_seq_cst);
+  if (handler && handler->cb) {
+    handler->cb((uint8_t *)cmdData, cmdInfo->dataLen, handler->userData);
   } else {
-    //DERROR("Can't find valid cb in handlerMap, pos = %d", pos);
+    //DERROR("Can't find valid cb in handlerTable, pos = %d", pos);
   }
+  slot->readers.fetch_sub(1, std::memory_order_release);
 
   return OSDK_STAT_OK;
 }
 
+void LiveViewImpl::setH264Callback(LiveView::LiveViewCameraPosition pos,
+                                   H264Callback cb, void *userData) {
+  H264CallbackSlot *slot = &h264CbHandlerTable[pos];
+  H264CallbackHandler *handler = new H264CallbackHandler;
+  handler->cb = cb;
+  handler->userData = userData;
+
+  std::lock_guard<std::mutex> lock(h264CbMutex);
+  const H264CallbackHandler *old =
+      slot->active.exchange(handler, std::memory_order_seq_cst);
+  if (old) slot->retired.push_back(old);
+  /*! A dispatch counting itself in from now on loads the new handler, so
+   *  with none running no one holds a replaced one. Otherwise, e.g. when
+   *  called from the callback itself, they are freed by a later set. */
+  if (slot->readers.load(std::memory_order_seq_cst) == 0) {
+    for (auto retired : slot->retired) delete retired;
+    slot->retired.clear();
+  }
+}
+
+void LiveViewImpl::setDefaultH264Callback(LiveView::LiveViewCameraPosition pos) {
+  H264CallbackSlot *slot = &h264CbHandlerTable[pos];
+  H264CallbackHandler *handler = new H264CallbackHandler;
+  handler->cb = defaultH264CB;
+  handler->userData = &defUserData[pos];
+
+  /*! Keep a callback another instance already set */
+  std::lock_guard<std::mutex> lock(h264CbMutex);
+  const H264CallbackHandler *none = NULL;
+  if (!slot->active.compare_exchange_strong(none, handler,
+                                            std::memory_order_seq_cst)) {
+    delete handler;
+  }
+}
+
 E_OsdkStat LiveViewImpl::getCameraPushing(struct _CommandHandle *cmdHandle,
                                           const T_CmdInfo *cmdInfo,
                                           const uint8_t *cmdData,
@@ -429,8 +469,9 @@ void *LiveViewImpl::heartBeatTask(void *p) {
   sendInfo.sender = vehicle->linker->getLocalSenderId();
   sendInfo.receiver = 0x08;
 
+  PeriodicTimer heartBeatTimer(1000 * 1000);
   while (1) {
-    OsdkOsal_TaskSleepMs(1000);
+    heartBeatTimer.wait();
     result = vehicle->linker->send(&sendInfo, &data);
     if (result != OSDK_STAT_OK) {
       DERROR("heart beat task send failed!\n");
@@ -467,10 +508,7 @@ LiveView::LiveViewErrCode LiveViewImpl::startH264Stream(LiveView::LiveViewCamera
     return LiveView::OSDK_LIVEVIEW_CAM_NOT_MOUNTED;
   }
 
-  if (h264CbHandlerMap.find(pos) != h264CbHandlerMap.end()) {
-    h264CbHandlerMap[pos].cb = cb;
-    h264CbHandlerMap[pos].userData = userData;
-  }
+  setH264Callback(pos, cb, userData);
 
   if(subscribeLiveViewData(targetCamType, pos) == -1) {
     //vehicle->linker->destroyLiveViewTask();
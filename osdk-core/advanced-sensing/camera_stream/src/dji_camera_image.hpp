@@ -9,19 +9,73 @@
 #ifndef ADVANCED_SENSING_DJI_CAMERA_IMAGE_HPP
 #define ADVANCED_SENSING_DJI_CAMERA_IMAGE_HPP
 #include <cstdint>
+#include <memory>
 #include <vector>
 
+/*! @brief Pixel format of the decoded image frames
+ */
+enum CameraImagePixelFormat
+{
+  CAMERA_PIX_FMT_RGB24   = 0, /*!< packed RGB 8:8:8, 3 bytes per pixel */
+  CAMERA_PIX_FMT_BGR24   = 1, /*!< packed BGR 8:8:8, 3 bytes per pixel */
+  CAMERA_PIX_FMT_GRAY8   = 2, /*!< 8 bit luma only, 1 byte per pixel */
+  CAMERA_PIX_FMT_NV12    = 3, /*!< Y plane then interleaved UV plane */
+  CAMERA_PIX_FMT_YUV420P = 4, /*!< Y, U and V planes, decoder native layout */
+};
+
+/*! @brief Scaling algorithm used when the output size differs from the
+ *         stream size. Faster algorithms give softer images.
+ */
+enum CameraImageScaler
+{
+  CAMERA_SCALER_POINT         = 0,
+  CAMERA_SCALER_FAST_BILINEAR = 1,
+  CAMERA_SCALER_BILINEAR      = 2,
+  CAMERA_SCALER_BICUBIC       = 3,
+  CAMERA_SCALER_AREA          = 4,
+};
+
+/*! @brief Output configuration of the camera stream decoder
+ *
+ *  @note Converting to YUV420P at the stream size skips swscale entirely,
+ *        GRAY8/NV12 and smaller output sizes make the conversion cheaper
+ *        than the default full size RGB24.
+ */
+struct CameraImageOutputConfig
+{
+  CameraImagePixelFormat pixelFormat;
+  int                    width;  /*!< 0 keeps the stream width */
+  int                    height; /*!< 0 keeps the stream height */
+  CameraImageScaler      scaler;
+
+  CameraImageOutputConfig(CameraImagePixelFormat fmt = CAMERA_PIX_FMT_RGB24,
+                          int w = 0, int h = 0,
+                          CameraImageScaler alg = CAMERA_SCALER_BICUBIC)
+    : pixelFormat(fmt), width(w), height(h), scaler(alg)
+  {
+  }
+};
+
 /*! @brief Data structure for the image frames from the
  *         FPV camera or main camera
  */
 struct CameraRGBImage
 {
-  // rawData.size should be height x width x 3 x sizeof(char)
+  // rawData holds one frame in pixelFormat, tightly packed without padding,
+  // e.g. height x width x 3 bytes for RGB24 (the default).
   std::vector<uint8_t> rawData;
   int height;
   int width;
+  CameraImagePixelFormat pixelFormat;
 };
 
+/*! @brief Read-only, reference counted view of a decoded image frame.
+ *         The frame belongs to the decoder's frame pool and is not reused
+ *         for new frames as long as a view to it is alive, so keep views
+ *         short-lived and copy the image if it has to be kept or modified.
+ */
+typedef std::shared_ptr<const CameraRGBImage> CameraRGBImageView;
+
 /*! @brief User callback function called by OSDK (in a dedicated thread)
  *  when a new image frame from camera is received.
  */
@@ -24,11 +24,20 @@
  */
 
 #include "dji_camera_image_handler.hpp"
+#include <atomic>
+#include <cstring>
 
-DJICameraImageHandler::DJICameraImageHandler():m_newImageFlag(false)
+DJICameraImageHandler::DJICameraImageHandler()
+  : m_newImageFlag(false),
+    m_writingIdx(-1)
 {
   pthread_mutex_init(&m_mutex, NULL);
   pthread_cond_init(&m_condv, NULL);
+
+  for (int i = 0; i < DEFAULT_POOL_SIZE; i++)
+  {
+    m_pool.push_back(std::make_shared<CameraRGBImage>());
+  }
 }
 
 DJICameraImageHandler::~DJICameraImageHandler()
@@ -37,56 +46,129 @@ DJICameraImageHandler::~DJICameraImageHandler()
   pthread_cond_destroy(&m_condv);
 }
 
-bool DJICameraImageHandler::getNewImageWithLock(CameraRGBImage & copyOfImage, int timeoutMilliSec)
+bool DJICameraImageHandler::getNewImageView(CameraRGBImageView& view, int timeoutMilliSec)
 {
-  int result = -1;
+  int result = 0;
 
   /*! @note
    * Here result == 0 means successful.
    * Because this is the behavior of pthread_cond_timedwait.
    */
   pthread_mutex_lock(&m_mutex);
-  if(m_newImageFlag)
-  {
-    /* At this point, a copy of m_img is made, so it is safe to 
-     * do any modifications to copyOfImage in user code.
-     */
-    copyOfImage = m_img;
-    m_newImageFlag = false;
-    result = 0;
-  }
-  else
+  if(!m_newImageFlag)
   {
     struct timespec absTimeout;
     clock_gettime(CLOCK_REALTIME, &absTimeout);
-    absTimeout.tv_nsec += timeoutMilliSec * 1e6;
-    result = pthread_cond_timedwait(&m_condv, &m_mutex, &absTimeout);
+    absTimeout.tv_sec  += timeoutMilliSec / 1000;
+    absTimeout.tv_nsec += (timeoutMilliSec % 1000) * 1000000L;
+    if (absTimeout.tv_nsec >= 1000000000L)
+    {
+      absTimeout.tv_sec  += 1;
+      absTimeout.tv_nsec -= 1000000000L;
+    }
 
-    if(result == 0)
+    while(!m_newImageFlag && result == 0)
     {
-      copyOfImage = m_img;
-      m_newImageFlag = false;
+      result = pthread_cond_timedwait(&m_condv, &m_mutex, &absTimeout);
     }
   }
+
+  if(m_newImageFlag)
+  {
+    /* Only the reference is handed out, the pixels are not copied. */
+    view = m_latest;
+    m_newImageFlag = false;
+    result = 0;
+  }
   pthread_mutex_unlock(&m_mutex);
   return (result == 0) ? true : false;
 }
 
+bool DJICameraImageHandler::getNewImageWithLock(CameraRGBImage & copyOfImage, int timeoutMilliSec)
+{
+  CameraRGBImageView view;
+  if(!getNewImageView(view, timeoutMilliSec))
+  {
+    return false;
+  }
+
+  /* At this point, a copy of the frame is made outside of the lock, so it
+   * is safe to do any modifications to copyOfImage in user code.
+   */
+  copyOfImage = *view;
+  return true;
+}
+
 bool DJICameraImageHandler::newImageIsReady()
 {
   return m_newImageFlag;
 }
 
-void DJICameraImageHandler::writeNewImageWithLock(uint8_t* buf, int bufSize, int width, int height)
+CameraRGBImage* DJICameraImageHandler::beginWriteImage(int bufSize, int width, int height,
+                                                       CameraImagePixelFormat pixelFormat)
 {
   pthread_mutex_lock(&m_mutex);
+  /* A frame is free when the pool holds the only reference to it, which
+   * also rules out the published one since m_latest refers to it.
+   */
+  m_writingIdx = -1;
+  for (int i = 0; i < (int)m_pool.size(); i++)
+  {
+    if (m_pool[i].use_count() == 1)
+    {
+      /* use_count() is a relaxed load, pair it with the release of the
+       * last view so its reads of the pixels happen before we overwrite
+       * them.
+       */
+      std::atomic_thread_fence(std::memory_order_acquire);
+      m_writingIdx = i;
+      break;
+    }
+  }
+  if (m_writingIdx < 0)
+  {
+    if ((int)m_pool.size() >= MAX_POOL_SIZE)
+    {
+      pthread_mutex_unlock(&m_mutex);
+      return NULL;
+    }
+    m_pool.push_back(std::make_shared<CameraRGBImage>());
+    m_writingIdx = (int)m_pool.size() - 1;
+  }
+  CameraRGBImage* img = m_pool[m_writingIdx].get();
+  pthread_mutex_unlock(&m_mutex);
 
-  m_img.rawData.assign(buf, buf+bufSize);
-  m_img.height = height;
-  m_img.width  = width;
-  m_newImageFlag = true;
+  /* Nobody else can see this frame, fill it without holding the lock.
+   * The vector keeps its capacity, so this only allocates on the first
+   * frames or when the resolution grows.
+   */
+  img->rawData.resize(bufSize);
+  img->height = height;
+  img->width  = width;
+  img->pixelFormat = pixelFormat;
+  return img;
+}
 
-  pthread_cond_signal(&m_condv);
+void DJICameraImageHandler::endWriteImage()
+{
+  pthread_mutex_lock(&m_mutex);
+  if (m_writingIdx >= 0)
+  {
+    m_latest       = m_pool[m_writingIdx];
+    m_writingIdx   = -1;
+    m_newImageFlag = true;
+    pthread_cond_signal(&m_condv);
+  }
   pthread_mutex_unlock(&m_mutex);
 }
 
+void DJICameraImageHandler::writeNewImageWithLock(uint8_t* buf, int bufSize, int width, int height)
+{
+  CameraRGBImage* img = beginWriteImage(bufSize, width, height);
+  if (!img)
+  {
+    return;
+  }
+  memcpy(img->rawData.data(), buf, bufSize);
+  endWriteImage();
+}
@@ -26,11 +26,36 @@ public:
   void writeNewImageWithLock(uint8_t* buf, int bufSize, int width, int height);
   bool getNewImageWithLock(CameraRGBImage & copyOfImage, int timeoutMilliSec);
 
+  /*!
+   * Zero-copy handoff between the decoder and the consumers.
+   *
+   * The writer gets a pooled frame from beginWriteImage(), fills rawData in
+   * place and publishes it with endWriteImage(). Readers get a view of the
+   * newest published frame; frames published in between are skipped, so a
+   * slow consumer always catches up to the latest image.
+   *
+   * Frames are only recycled once no view refers to them. The pool starts
+   * with three frames (one being written, one published, one being read)
+   * and grows up to MAX_POOL_SIZE if consumers hold on to more views than
+   * that. With all of those held, beginWriteImage() returns NULL and the
+   * decoder drops the frame.
+   */
+  CameraRGBImage* beginWriteImage(int bufSize, int width, int height,
+                                  CameraImagePixelFormat pixelFormat = CAMERA_PIX_FMT_RGB24);
+  void endWriteImage();
+  bool getNewImageView(CameraRGBImageView& view, int timeoutMilliSec);
+
 private:
+  static const int DEFAULT_POOL_SIZE = 3;
+  static const int MAX_POOL_SIZE     = 8;
+
   pthread_mutex_t m_mutex;
   pthread_cond_t  m_condv;
-  CameraRGBImage  m_img;
   bool            m_newImageFlag;
+
+  std::vector<std::shared_ptr<CameraRGBImage> > m_pool;
+  std::shared_ptr<CameraRGBImage>               m_latest;
+  int                                           m_writingIdx;
 };
 
 #endif
@@ -94,6 +94,11 @@ bool DJICameraStream::startCameraStream(CameraImageCallback cb, void* cbParam)
   return true;
 }
 
+void DJICameraStream::setOutputConfig(const CameraImageOutputConfig& config)
+{
+  decoder->setOutputConfig(config);
+}
+
 void DJICameraStream::stopCameraStream()
 {
   decoder->registerCallback(NULL, NULL);
@@ -107,6 +112,11 @@ bool DJICameraStream::getCurrentImage(CameraRGBImage& copyOfImage)
   return decoder->decodedImageHandler.getNewImageWithLock(copyOfImage, 20);
 }
 
+bool DJICameraStream::getCurrentImageView(CameraRGBImageView& view)
+{
+  return decoder->decodedImageHandler.getNewImageView(view, 20);
+}
+
 bool DJICameraStream::newImageIsReady()
 {
   return decoder->decodedImageHandler.newImageIsReady();
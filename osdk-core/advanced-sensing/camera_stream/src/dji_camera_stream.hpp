@@ -30,8 +30,12 @@ public:
 
   bool getCurrentImage(CameraRGBImage& copyOfImage);
 
+  bool getCurrentImageView(CameraRGBImageView& view);
+
   bool startCameraStream(CameraImageCallback cb = NULL, void * cbParam = NULL);
 
+  void setOutputConfig(const CameraImageOutputConfig& config);
+
   void stopCameraStream();
 
   bool startCameraH264(H264Callback cb = NULL, void * cbParam = NULL);
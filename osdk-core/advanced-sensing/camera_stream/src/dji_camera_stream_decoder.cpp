@@ -28,6 +28,42 @@
 #include "unistd.h"
 #include "pthread.h"
 
+static AVPixelFormat toAVPixelFormat(CameraImagePixelFormat fmt)
+{
+  switch (fmt)
+  {
+    case CAMERA_PIX_FMT_BGR24:
+      return AV_PIX_FMT_BGR24;
+    case CAMERA_PIX_FMT_GRAY8:
+      return AV_PIX_FMT_GRAY8;
+    case CAMERA_PIX_FMT_NV12:
+      return AV_PIX_FMT_NV12;
+    case CAMERA_PIX_FMT_YUV420P:
+      return AV_PIX_FMT_YUV420P;
+    case CAMERA_PIX_FMT_RGB24:
+    default:
+      return AV_PIX_FMT_RGB24;
+  }
+}
+
+static int toSwsFlags(CameraImageScaler scaler)
+{
+  switch (scaler)
+  {
+    case CAMERA_SCALER_POINT:
+      return SWS_POINT;
+    case CAMERA_SCALER_FAST_BILINEAR:
+      return SWS_FAST_BILINEAR;
+    case CAMERA_SCALER_BILINEAR:
+      return SWS_BILINEAR;
+    case CAMERA_SCALER_AREA:
+      return SWS_AREA;
+    case CAMERA_SCALER_BICUBIC:
+    default:
+      return SWS_BICUBIC;
+  }
+}
+
 DJICameraStreamDecoder::DJICameraStreamDecoder()
   : initSuccess(false),
     cbThreadIsRunning(false),
@@ -40,8 +76,9 @@ DJICameraStreamDecoder::DJICameraStreamDecoder()
     pSwsCtx(NULL),
     pFrameYUV(NULL),
     pFrameRGB(NULL),
-    rgbBuf(NULL),
-    bufSize(0)
+    bufSize(0),
+    outputWidth(0),
+    outputHeight(0)
 {
   pthread_mutex_init(&decodemutex, NULL);
 }
@@ -117,6 +154,11 @@ bool DJICameraStreamDecoder::getNewImage(CameraRGBImage & copyOfImage, int timeo
   return decodedImageHandler.getNewImageWithLock(copyOfImage, timeoutMilliSec);
 }
 
+bool DJICameraStreamDecoder::getNewImageView(CameraRGBImageView & view, int timeoutMilliSec)
+{
+  return decodedImageHandler.getNewImageView(view, timeoutMilliSec);
+}
+
 void DJICameraStreamDecoder::cleanup()
 {
   pthread_mutex_lock(&decodemutex);
@@ -152,11 +194,9 @@ void DJICameraStreamDecoder::cleanup()
     pCodecCtx = NULL;
   }
 
-  if (NULL != rgbBuf )
-  {
-    av_free(rgbBuf);
-    rgbBuf = NULL;
-  }
+  bufSize = 0;
+  outputWidth = 0;
+  outputHeight = 0;
 
   if (NULL != pFrameRGB)
   {
@@ -179,8 +219,8 @@ void DJICameraStreamDecoder::callbackThreadFunc()
 {
   while(cbThreadIsRunning)
   {
-    CameraRGBImage copyOfImage;
-    if(!decodedImageHandler.getNewImageWithLock(copyOfImage, 1000))
+    CameraRGBImageView image;
+    if(!decodedImageHandler.getNewImageView(image, 1000))
     {
       DDEBUG_PRIVATE("Decoder Callback Thread: Get image time out\n");
       continue;
@@ -188,7 +228,7 @@ void DJICameraStreamDecoder::callbackThreadFunc()
 
     if(cb)
     {
-      (*cb)(copyOfImage, cbUserParam);
+      (*cb)(*image, cbUserParam);
     }
   }
   DSTATUS_PRIVATE("Decoder Callback Thread Stopped...\n");
@@ -230,32 +270,67 @@ void DJICameraStreamDecoder::decodeBuffer(uint8_t* buf, int bufLen)
       {
         int w = pFrameYUV->width;
         int h = pFrameYUV->height;
+        int outW = outputConfig.width  > 0 ? outputConfig.width  : w;
+        int outH = outputConfig.height > 0 ? outputConfig.height : h;
+        AVPixelFormat outFmt = toAVPixelFormat(outputConfig.pixelFormat);
         //DSTATUS_PRIVATE("Got picture! size=%dx%d\n", w, h);
 
-        if(NULL == pSwsCtx)
+        if((outW != outputWidth) || (outH != outputHeight))
         {
-          pSwsCtx = sws_getContext(w, h, pCodecCtx->pix_fmt,
-                                   w, h, AV_PIX_FMT_RGB24,
-                                   4, NULL, NULL, NULL);
+          bufSize      = 0;
+          outputWidth  = outW;
+          outputHeight = outH;
         }
 
-        if(NULL == rgbBuf)
+        if(0 == bufSize)
         {
-          bufSize = avpicture_get_size(AV_PIX_FMT_RGB24, w, h);
-          rgbBuf = (uint8_t*) av_malloc(bufSize);
-          avpicture_fill((AVPicture*)pFrameRGB, rgbBuf, AV_PIX_FMT_RGB24, w, h);
+          bufSize = avpicture_get_size(outFmt, outW, outH);
         }
 
-        if(NULL != pSwsCtx && NULL != rgbBuf)
-        {
-          sws_scale(pSwsCtx,
-                    (uint8_t const *const *) pFrameYUV->data, pFrameYUV->linesize, 0, pFrameYUV->height,
-                             pFrameRGB->data, pFrameRGB->linesize);
+        /* The decoder already outputs planar YUV420, so there is nothing to
+         * convert: lay the planes out into a pooled frame and skip swscale.
+         */
+        bool passthrough = (outFmt == AV_PIX_FMT_YUV420P) &&
+                           (outW == w) && (outH == h) &&
+                           ((pCodecCtx->pix_fmt == AV_PIX_FMT_YUV420P) ||
+                            (pCodecCtx->pix_fmt == AV_PIX_FMT_YUVJ420P));
 
-          pFrameRGB->height = h;
-          pFrameRGB->width = w;
+        if(!passthrough)
+        {
+          /* Reuses the current context unless a parameter changed. */
+          pSwsCtx = sws_getCachedContext(pSwsCtx, w, h, pCodecCtx->pix_fmt,
+                                         outW, outH, outFmt,
+                                         toSwsFlags(outputConfig.scaler),
+                                         NULL, NULL, NULL);
+        }
 
-          decodedImageHandler.writeNewImageWithLock(pFrameRGB->data[0], bufSize, w, h);
+        if((passthrough || NULL != pSwsCtx) && 0 != bufSize)
+        {
+          /* Convert straight into a pooled frame, no intermediate buffer. */
+          CameraRGBImage* img = decodedImageHandler.beginWriteImage(bufSize, outW, outH,
+                                                                    outputConfig.pixelFormat);
+          /* NULL when consumers hold every pooled frame, drop this one. */
+          if(NULL != img)
+          {
+            if(passthrough)
+            {
+              avpicture_layout((const AVPicture*)pFrameYUV, pCodecCtx->pix_fmt, w, h,
+                               img->rawData.data(), bufSize);
+            }
+            else
+            {
+              avpicture_fill((AVPicture*)pFrameRGB, img->rawData.data(), outFmt, outW, outH);
+
+              sws_scale(pSwsCtx,
+                        (uint8_t const *const *) pFrameYUV->data, pFrameYUV->linesize, 0, pFrameYUV->height,
+                                 pFrameRGB->data, pFrameRGB->linesize);
+
+              pFrameRGB->height = outH;
+              pFrameRGB->width = outW;
+            }
+
+            decodedImageHandler.endWriteImage();
+          }
         }
       }
     }
@@ -264,6 +339,14 @@ void DJICameraStreamDecoder::decodeBuffer(uint8_t* buf, int bufLen)
   av_free_packet(&pkt);
 }
 
+void DJICameraStreamDecoder::setOutputConfig(const CameraImageOutputConfig& config)
+{
+  pthread_mutex_lock(&decodemutex);
+  outputConfig = config;
+  bufSize      = 0;
+  pthread_mutex_unlock(&decodemutex);
+}
+
 bool DJICameraStreamDecoder::registerCallback(CameraImageCallback f, void *param)
 {
   cb = f;
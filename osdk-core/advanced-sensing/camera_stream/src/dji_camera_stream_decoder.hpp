@@ -29,6 +29,7 @@ public:
   void cleanup();
 
   bool getNewImage(CameraRGBImage & copyOfImage, int timeoutMilliSec);
+  bool getNewImageView(CameraRGBImageView & view, int timeoutMilliSec);
 
   void callbackThreadFunc();
 
@@ -38,6 +39,12 @@ public:
 
   bool registerCallback(CameraImageCallback f, void* param);
 
+  /*!
+   * Select the pixel format, size and scaling algorithm of the decoded
+   * images. Takes effect from the next decoded frame.
+   */
+  void setOutputConfig(const CameraImageOutputConfig& config);
+
   DJICameraImageHandler decodedImageHandler;
 
 private:
@@ -58,8 +65,11 @@ private:
 
   AVFrame* pFrameYUV;
   AVFrame* pFrameRGB;
-  uint8_t* rgbBuf;
   size_t   bufSize;
+
+  CameraImageOutputConfig outputConfig;
+  int                     outputWidth;
+  int                     outputHeight;
 };
 
 #endif // DJICAMERASTREAMDECODER_HH
@@ -46,6 +46,11 @@ void* monitor(void* s);
 #define UDT_SERVER_PORT_MAIN 	"40001"
 #define UDT_SERVER_PORT_FPV  	"40003"
 #define RECEIVE_SIZE   128000
+/* Room for a key frame and the receives after it. Past a backlog of a few
+ * frames the ring drops up to the next key frame, so the decoder never runs
+ * more than that behind the camera. */
+#define RING_SIZE         (1024 * 1024)
+#define RING_MAX_BACKLOG  (256 * 1024)
 
 // Helper function to free the addresses
 void freeAddresses(struct addrinfo *local, struct addrinfo *peer)
@@ -59,6 +64,8 @@ DJICameraStreamLink::DJICameraStreamLink(CameraType c)
     ip(std::string(UDT_SERVER_IP)),
     fHandle(-1),
     threadStatus(-1),
+    decodeThreadStatus(-1),
+    ring(RING_SIZE, RING_MAX_BACKLOG),
     isRunning(false),
     cb(NULL),
     cbParam(NULL)
@@ -158,16 +165,28 @@ bool DJICameraStreamLink::start()
     return false;
   }
 
+  ring.reset();
+  isRunning = true;
+
+  decodeThreadStatus = pthread_create(&decodeThread, NULL, DJICameraStreamLink::decodeThreadEntry, this);
+  if (decodeThreadStatus != 0)
+  {
+    DERROR_PRIVATE("Error creating camera decoding thread for %s\n", camNameStr.c_str());
+    DERROR_PRIVATE("pthread_create returns %d\n", decodeThreadStatus);
+    isRunning = false;
+    return false;
+  }
+
   threadStatus = pthread_create(&readThread, NULL, DJICameraStreamLink::readThreadEntry, this);
   if (threadStatus != 0)
   {
     DERROR_PRIVATE("Error creating camera reading thread for %s\n", camNameStr.c_str());
     DERROR_PRIVATE("pthread_create returns %d\n", threadStatus);
+    stop();
     return false;
   }
   else
   {
-    isRunning = true;
     return true;
   }
 }
@@ -175,11 +194,17 @@ bool DJICameraStreamLink::start()
 void DJICameraStreamLink::stop()
 {
   isRunning = false;
+  ring.shutdown();
   if(0 == threadStatus)
   {
     pthread_join(readThread, NULL);
     threadStatus = -1;
   }
+  if(0 == decodeThreadStatus)
+  {
+    pthread_join(decodeThread, NULL);
+    decodeThreadStatus = -1;
+  }
 }
 
 void DJICameraStreamLink::cleanup()
@@ -194,6 +219,12 @@ void* DJICameraStreamLink::readThreadEntry(void * c)
   return NULL;
 }
 
+void* DJICameraStreamLink::decodeThreadEntry(void * c)
+{
+  (reinterpret_cast<DJICameraStreamLink*>(c))->decodeThreadFunc();
+  return NULL;
+}
+
 void DJICameraStreamLink::readThreadFunc()
 {
   DSTATUS_PRIVATE("**** %s data reading thread start! ****\n", camNameStr.c_str());
@@ -215,23 +246,21 @@ void DJICameraStreamLink::readThreadFunc()
 //    }
 //  }
 
+  char* rcvBuffer = new char[RECEIVE_SIZE];
+
+  /* UDT::recv blocks until data arrives (or UDT_RCVTIMEO expires), so the
+   * loop runs at the rate data comes in. Decoding happens on the decode
+   * thread, this thread only moves the data into the ring.
+   */
   while (isRunning)
   {
     int rcvLen=0;
-    char rcvBuffer[RECEIVE_SIZE];
     if (UDT::ERROR != (rcvLen = UDT::recv(fHandle, rcvBuffer, RECEIVE_SIZE, 0)))
     {
       retryReading = 0;
       if(rcvLen)
       {
-        //vector<uint8_t> temp(rcvBuffer, rcvBuffer+rcvLen);
-        //cout << "push to buffer: " << rcvLen << " bytes... ";
-        //streamBufferQueue.push(temp);
-        //cout << "done!" << endl;
-        if(cb)
-        {
-          (*cb)(cbParam, reinterpret_cast<uint8_t *>(&rcvBuffer[0]), rcvLen);
-        }
+        ring.write(reinterpret_cast<uint8_t *>(rcvBuffer), rcvLen);
       }
       else
       {
@@ -240,6 +269,7 @@ void DJICameraStreamLink::readThreadFunc()
     }
     else if ((retryReading++) > 10)
     {
+      retryReading = 0;
       DSTATUS_PRIVATE("Unable to read from %s lost, retry connecting ...\n", camNameStr.c_str());
 
       retryConnect = 0;
@@ -249,19 +279,58 @@ void DJICameraStreamLink::readThreadFunc()
         if(10 == retryConnect++)
         {
           isRunning = false;
+          ring.shutdown();
           unInit();
+          delete[] rcvBuffer;
           DERROR_PRIVATE("Unable to reconnect to %s ..., quit reading thread\n", camNameStr.c_str());
           return;
         }
       }
     }
-    usleep(2e4); //50 Hz
+    else
+    {
+      usleep(2e4); // back off on read errors only
+    }
   }
 
+  delete[] rcvBuffer;
   unInit();
   DSTATUS_PRIVATE("**** %s reading thread stopped\n", camNameStr.c_str());
 }
 
+void DJICameraStreamLink::decodeThreadFunc()
+{
+  DSTATUS_PRIVATE("**** %s data decoding thread start! ****\n", camNameStr.c_str());
+
+  while (isRunning)
+  {
+    uint8_t* data = NULL;
+    size_t   len  = ring.readSpan(&data, 100);
+    if (0 == len)
+    {
+      continue;
+    }
+
+    if(cb)
+    {
+      (*cb)(cbParam, data, (int)len);
+    }
+    ring.consume(len);
+  }
+
+  DSTATUS_PRIVATE("**** %s decoding thread stopped\n", camNameStr.c_str());
+}
+
+void DJICameraStreamLink::setOverflowPolicy(DJICameraStreamRing::OverflowPolicy policy)
+{
+  ring.setOverflowPolicy(policy);
+}
+
+uint64_t DJICameraStreamLink::getDroppedBytes()
+{
+  return ring.getDroppedBytes();
+}
+
 void DJICameraStreamLink::registerCallback(CAMCALLBACK f, void* param)
 {
   cb = f;
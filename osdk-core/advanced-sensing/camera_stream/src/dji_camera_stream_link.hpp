@@ -15,6 +15,7 @@
 #include "pthread.h"
 
 #include "dji_camera_image.hpp"
+#include "dji_camera_stream_ring.hpp"
 
 typedef void (*CAMCALLBACK)(void*, uint8_t*, int);
 
@@ -38,11 +39,20 @@ public:
   /* start routine for the data receiving thread*/
   static void* readThreadEntry(void *);
 
+  /* start routine for the thread passing received data to the callback */
+  static void* decodeThreadEntry(void *);
+
   bool isThreadRunning();
 
   /* register a callback function */
   void registerCallback(CAMCALLBACK f, void* param);
 
+  /* select what happens when the decode thread falls behind */
+  void setOverflowPolicy(DJICameraStreamRing::OverflowPolicy policy);
+
+  /* bytes dropped because the decode thread fell behind */
+  uint64_t getDroppedBytes();
+
 private:
   CameraType  camType;
   std::string camNameStr;
@@ -52,6 +62,11 @@ private:
 
   pthread_t readThread;
   int       threadStatus;
+  pthread_t decodeThread;
+  int       decodeThreadStatus;
+
+  /* received data waiting for the decode thread */
+  DJICameraStreamRing ring;
 
   bool isRunning;
 
@@ -63,6 +78,9 @@ private:
 
   /* real function to read data from camera */
   void readThreadFunc();
+
+  /* real function to pass the received data to the callback */
+  void decodeThreadFunc();
 };
 
 #endif // DJICAMERASTREAMLINK_HH
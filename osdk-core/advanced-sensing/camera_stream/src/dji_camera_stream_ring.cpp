@@ -0,0 +1,244 @@
+/*
+ * DJI Onboard SDK Advanced Sensing APIs
+ *
+ * Copyright (c) 2017-2018 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ * @file dji_camera_stream_ring.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ */
+
+#include "dji_camera_stream_ring.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#define H264_NAL_TYPE_IDR 5
+#define H264_NAL_TYPE_SPS 7
+
+static void getAbsTimeout(struct timespec* ts, int timeoutMs)
+{
+  clock_gettime(CLOCK_REALTIME, ts);
+  ts->tv_sec  += timeoutMs / 1000;
+  ts->tv_nsec += (timeoutMs % 1000) * 1000000L;
+  if (ts->tv_nsec >= 1000000000L)
+  {
+    ts->tv_sec  += 1;
+    ts->tv_nsec -= 1000000000L;
+  }
+}
+
+DJICameraStreamRing::DJICameraStreamRing(size_t cap, size_t backlog,
+                                         OverflowPolicy p)
+  : buffer(NULL),
+    capacity(1),
+    mask(0),
+    maxBacklog(backlog),
+    policy(p),
+    head(0),
+    tail(0),
+    dropping(false),
+    isShutdown(false),
+    droppedBytes(0)
+{
+  while (capacity < cap)
+  {
+    capacity <<= 1;
+  }
+  mask   = capacity - 1;
+  if (maxBacklog == 0 || maxBacklog > capacity)
+  {
+    maxBacklog = capacity;
+  }
+  buffer = (uint8_t*)malloc(capacity);
+
+  pthread_mutex_init(&waitMutex, NULL);
+  pthread_cond_init(&dataCond, NULL);
+  pthread_cond_init(&spaceCond, NULL);
+}
+
+DJICameraStreamRing::~DJICameraStreamRing()
+{
+  pthread_cond_destroy(&spaceCond);
+  pthread_cond_destroy(&dataCond);
+  pthread_mutex_destroy(&waitMutex);
+  free(buffer);
+}
+
+long DJICameraStreamRing::findKeyFrameStart(const uint8_t* data, size_t len)
+{
+  for (size_t i = 0; i + 3 < len; i++)
+  {
+    if (data[i] == 0 && data[i + 1] == 0 && data[i + 2] == 1)
+    {
+      uint8_t nalType = data[i + 3] & 0x1F;
+      if (nalType == H264_NAL_TYPE_SPS || nalType == H264_NAL_TYPE_IDR)
+      {
+        return (long)i;
+      }
+    }
+  }
+  return -1;
+}
+
+bool DJICameraStreamRing::write(const uint8_t* data, size_t len)
+{
+  if (!buffer || len == 0)
+  {
+    return false;
+  }
+
+  if (dropping.load(std::memory_order_relaxed))
+  {
+    long start = findKeyFrameStart(data, len);
+    if (start < 0)
+    {
+      droppedBytes.fetch_add(len, std::memory_order_relaxed);
+      return false;
+    }
+    droppedBytes.fetch_add(start, std::memory_order_relaxed);
+    data += start;
+    len  -= start;
+  }
+
+  size_t h    = head.load(std::memory_order_relaxed);
+  size_t used = h - tail.load(std::memory_order_acquire);
+  /* A backlog over the limit means the decoder is behind by more than a few
+   * frames, catch up at the next key frame instead of showing stale ones */
+  if (policy == DROP_TO_IDR && used > maxBacklog)
+  {
+    dropping.store(true, std::memory_order_relaxed);
+    droppedBytes.fetch_add(len, std::memory_order_relaxed);
+    return false;
+  }
+  if (len > capacity - used)
+  {
+    if (policy == BLOCK && len <= capacity)
+    {
+      pthread_mutex_lock(&waitMutex);
+      while (!isShutdown.load(std::memory_order_relaxed) &&
+             len > capacity - (h - tail.load(std::memory_order_acquire)))
+      {
+        struct timespec ts;
+        getAbsTimeout(&ts, 100);
+        pthread_cond_timedwait(&spaceCond, &waitMutex, &ts);
+      }
+      pthread_mutex_unlock(&waitMutex);
+      if (isShutdown.load(std::memory_order_relaxed))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      dropping.store(true, std::memory_order_relaxed);
+      droppedBytes.fetch_add(len, std::memory_order_relaxed);
+      return false;
+    }
+  }
+  dropping.store(false, std::memory_order_relaxed);
+
+  size_t offset = h & mask;
+  size_t first  = (len < capacity - offset) ? len : capacity - offset;
+  memcpy(buffer + offset, data, first);
+  memcpy(buffer, data + first, len - first);
+  head.store(h + len, std::memory_order_release);
+
+  pthread_mutex_lock(&waitMutex);
+  pthread_cond_signal(&dataCond);
+  pthread_mutex_unlock(&waitMutex);
+  return true;
+}
+
+size_t DJICameraStreamRing::readSpan(uint8_t** data, int timeoutMs)
+{
+  size_t t = tail.load(std::memory_order_relaxed);
+  size_t h = head.load(std::memory_order_acquire);
+
+  if (h == t)
+  {
+    pthread_mutex_lock(&waitMutex);
+    struct timespec ts;
+    getAbsTimeout(&ts, timeoutMs);
+    while (!isShutdown.load(std::memory_order_relaxed) &&
+           (h = head.load(std::memory_order_acquire)) == t)
+    {
+      if (0 != pthread_cond_timedwait(&dataCond, &waitMutex, &ts))
+      {
+        break;
+      }
+    }
+    pthread_mutex_unlock(&waitMutex);
+    h = head.load(std::memory_order_acquire);
+    if (h == t)
+    {
+      return 0;
+    }
+  }
+
+  size_t offset = t & mask;
+  size_t avail  = h - t;
+  *data = buffer + offset;
+  return (avail < capacity - offset) ? avail : capacity - offset;
+}
+
+void DJICameraStreamRing::consume(size_t len)
+{
+  tail.store(tail.load(std::memory_order_relaxed) + len,
+             std::memory_order_release);
+
+  if (policy == BLOCK)
+  {
+    pthread_mutex_lock(&waitMutex);
+    pthread_cond_signal(&spaceCond);
+    pthread_mutex_unlock(&waitMutex);
+  }
+}
+
+void DJICameraStreamRing::reset()
+{
+  head.store(0, std::memory_order_relaxed);
+  tail.store(0, std::memory_order_relaxed);
+  dropping.store(false, std::memory_order_relaxed);
+  isShutdown.store(false, std::memory_order_release);
+}
+
+void DJICameraStreamRing::shutdown()
+{
+  pthread_mutex_lock(&waitMutex);
+  isShutdown.store(true, std::memory_order_relaxed);
+  pthread_cond_broadcast(&dataCond);
+  pthread_cond_broadcast(&spaceCond);
+  pthread_mutex_unlock(&waitMutex);
+}
+
+void DJICameraStreamRing::setOverflowPolicy(OverflowPolicy p)
+{
+  policy = p;
+}
+
+size_t DJICameraStreamRing::size()
+{
+  return head.load(std::memory_order_acquire) -
+         tail.load(std::memory_order_acquire);
+}
+
+uint64_t DJICameraStreamRing::getDroppedBytes()
+{
+  return droppedBytes.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,86 @@
+/** @file dji_camera_stream_ring.hpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief Bounded single-producer/single-consumer byte ring between the
+ *  camera stream receive thread and the decode thread
+ *
+ *  @copyright 2017 DJI. All rights reserved.
+ *
+ */
+
+#ifndef DJICAMERASTREAMRING_HH
+#define DJICAMERASTREAMRING_HH
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "pthread.h"
+
+class DJICameraStreamRing
+{
+public:
+  /*! What the producer does when the ring has no room for new data */
+  enum OverflowPolicy
+  {
+    /*! Discard the data, and everything after it until the next SPS or IDR
+     *  NAL unit, so the decoder restarts from a clean key frame. The same
+     *  happens once more than the backlog limit is waiting to be decoded. */
+    DROP_TO_IDR = 0,
+    /*! Wait for the decode thread to make room. */
+    BLOCK       = 1,
+  };
+
+  /*! @param capacity size in bytes, rounded up to a power of two
+   *  @param maxBacklog bytes waiting to be decoded before DROP_TO_IDR starts
+   *  dropping, 0 to only drop when the ring is full */
+  DJICameraStreamRing(size_t capacity, size_t maxBacklog = 0,
+                      OverflowPolicy policy = DROP_TO_IDR);
+  ~DJICameraStreamRing();
+
+  /*! Producer side. Copies len bytes in, or drops them according to the
+   *  overflow policy. Returns false if the data was dropped. */
+  bool write(const uint8_t* data, size_t len);
+
+  /*! Consumer side. Waits up to timeoutMs for data and returns the length
+   *  of the contiguous readable span at *data, 0 on timeout or shutdown.
+   *  The span stays valid until consume() is called. */
+  size_t readSpan(uint8_t** data, int timeoutMs);
+  void consume(size_t len);
+
+  /*! Drop all buffered data, only call while both sides are idle */
+  void reset();
+
+  /*! Wake up both sides, e.g. before joining the threads */
+  void shutdown();
+
+  void setOverflowPolicy(OverflowPolicy p);
+
+  size_t   size();
+  uint64_t getDroppedBytes();
+
+private:
+  static long findKeyFrameStart(const uint8_t* data, size_t len);
+
+  uint8_t*       buffer;
+  size_t         capacity;
+  size_t         mask;
+  size_t         maxBacklog;
+  OverflowPolicy policy;
+
+  /* Monotonic byte counters, head is written by the producer only and
+   * tail by the consumer only. */
+  std::atomic<size_t> head;
+  std::atomic<size_t> tail;
+
+  std::atomic<bool>     dropping;
+  std::atomic<bool>     isShutdown;
+  std::atomic<uint64_t> droppedBytes;
+
+  /* Only used to sleep when the ring is empty or full */
+  pthread_mutex_t waitMutex;
+  pthread_cond_t  dataCond;
+  pthread_cond_t  spaceCond;
+};
+
+#endif // DJICAMERASTREAMRING_HH
@@ -39,21 +39,64 @@ namespace OSDK
 
 #define PRO_PURE_DATA_MAX_SIZE 1007 // 2^10 - header size
 
+/*! @brief Session buffer allocator for OpenProtocol
+ *
+ *  @details A static arena split into fixed size classes. Every class keeps
+ *  a free list of its blocks, so allocMemory and freeMemory are O(1), blocks
+ *  never move and the arena never fragments. A request is served from the
+ *  smallest class that fits, or from the next larger class when that one is
+ *  exhausted. No heap is used, so this works on STM32 as well.
+ */
 class MMU
 {
+public:
+  static const int CLASS_NUM     = 6;
+  static const int MMU_TABLE_NUM = 18;   // blocks over all classes
+  static const int MEMORY_SIZE   = 2816; // bytes over all classes
+
+  //! Usage of one size class
+  typedef struct ClassStats
+  {
+    uint16_t blockSize;
+    uint16_t blockNum;
+    uint16_t inUse;
+    uint16_t highWater;
+    //! Times a request for this class found it empty and spilled over
+    uint32_t exhausted;
+  } ClassStats;
+
+  typedef struct Stats
+  {
+    uint32_t   allocCount;
+    uint32_t   freeCount;
+    //! Requests that could not be served at all
+    uint32_t   failCount;
+    uint32_t   bytesInUse;
+    uint32_t   bytesHighWater;
+    ClassStats classes[CLASS_NUM];
+  } Stats;
+
 public:
   MMU();
   void setupMMU(void);
   void freeMemory(MMU_Tab* mmu_tab);
   MMU_Tab* allocMemory(uint16_t size);
 
-public:
-  static const int MMU_TABLE_NUM = 32;
-  static const int MEMORY_SIZE   = 1024;
+  void getStats(Stats* stats) const;
+  void resetStats(void);
 
 private:
+  static const uint8_t NO_BLOCK = 0xFF;
+
   MMU_Tab memoryTable[MMU_TABLE_NUM];
   uint8_t memory[MEMORY_SIZE];
+
+  //! Free lists, linked through nextFree by table index
+  uint8_t freeHead[CLASS_NUM];
+  uint8_t nextFree[MMU_TABLE_NUM];
+  uint8_t blockClass[MMU_TABLE_NUM];
+
+  Stats stats;
 };
 
 } // OSDK
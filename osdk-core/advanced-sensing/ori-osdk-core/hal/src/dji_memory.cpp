@@ -38,165 +38,168 @@
 
 using namespace DJI::OSDK;
 
+/*! Size classes, in ascending order. Keep the sums in line with
+ *  MMU::MMU_TABLE_NUM and MMU::MEMORY_SIZE. The largest class must hold
+ *  PRO_PURE_DATA_MAX_SIZE, its single block is the one full size buffer the
+ *  former 1KB first-fit arena could hold as well. Most commands and acks fit
+ *  the 32 and 64 byte classes, the 512 byte one keeps buffers a little over
+ *  256 bytes off the full size block.
+ */
+static const struct
+{
+  uint16_t blockSize;
+  uint8_t  blockNum;
+} sizeClass[MMU::CLASS_NUM] = {
+  { 32, 8 }, { 64, 4 }, { 128, 2 }, { 256, 2 }, { 512, 1 }, { 1024, 1 },
+};
+
 MMU::MMU()
 {
+  setupMMU();
 }
 
 void
 MMU::setupMMU()
 {
-  uint32_t i;
-  memoryTable[0].tabIndex  = 0;
-  memoryTable[0].usageFlag = 1;
-  memoryTable[0].pmem      = memory;
-  memoryTable[0].memSize   = 0;
-  for (i = 1; i < (MMU_TABLE_NUM - 1); i++)
+  uint32_t offset = 0;
+  uint8_t  index  = 0;
+
+  memset(&stats, 0, sizeof(stats));
+
+  for (uint8_t c = 0; c < CLASS_NUM; c++)
   {
-    memoryTable[i].tabIndex  = i;
-    memoryTable[i].usageFlag = 0;
+    freeHead[c]                = NO_BLOCK;
+    stats.classes[c].blockSize = sizeClass[c].blockSize;
+    stats.classes[c].blockNum  = 0;
+
+    for (uint8_t n = 0; n < sizeClass[c].blockNum; n++)
+    {
+      if (index >= MMU_TABLE_NUM ||
+          offset + sizeClass[c].blockSize > MEMORY_SIZE)
+      {
+        break;
+      }
+      memoryTable[index].tabIndex  = index;
+      memoryTable[index].usageFlag = 0;
+      memoryTable[index].memSize   = 0;
+      memoryTable[index].pmem      = memory + offset;
+      blockClass[index]            = c;
+
+      //! Push back to front so the lowest address is handed out first
+      nextFree[index] = freeHead[c];
+      freeHead[c]     = index;
+
+      stats.classes[c].blockNum++;
+      offset += sizeClass[c].blockSize;
+      index++;
+    }
+  }
+
+  for (; index < MMU_TABLE_NUM; index++)
+  {
+    memoryTable[index].tabIndex  = index;
+    memoryTable[index].usageFlag = 1;
+    memoryTable[index].memSize   = 0;
+    memoryTable[index].pmem      = (uint8_t*)0;
+    blockClass[index]            = NO_BLOCK;
   }
-  memoryTable[MMU_TABLE_NUM - 1].tabIndex  = MMU_TABLE_NUM - 1;
-  memoryTable[MMU_TABLE_NUM - 1].usageFlag = 1;
-  memoryTable[MMU_TABLE_NUM - 1].pmem      = memory + MEMORY_SIZE;
-  memoryTable[MMU_TABLE_NUM - 1].memSize   = 0;
 }
 
 void
 MMU::freeMemory(MMU_Tab* mmu_tab)
 {
-  if (mmu_tab == (MMU_Tab*)0)
+  if (mmu_tab < memoryTable || mmu_tab >= memoryTable + MMU_TABLE_NUM)
   {
     return;
   }
-  if (mmu_tab->tabIndex == 0 || mmu_tab->tabIndex == (MMU_TABLE_NUM - 1))
+
+  uint8_t index = mmu_tab->tabIndex;
+  uint8_t c     = blockClass[index];
+  if (c == NO_BLOCK || mmu_tab->usageFlag == 0)
   {
     return;
   }
+
+  stats.freeCount++;
+  stats.bytesInUse -= mmu_tab->memSize;
+  stats.classes[c].inUse--;
+
   mmu_tab->usageFlag = 0;
+  mmu_tab->memSize   = 0;
+  nextFree[index]    = freeHead[c];
+  freeHead[c]        = index;
 }
 
 MMU_Tab*
 MMU::allocMemory(uint16_t size)
 {
-  uint32_t mem_used = 0;
-  uint8_t  i;
-  uint8_t  j                = 0;
-  uint8_t  mmu_tab_used_num = 0;
-  uint8_t  mmu_tab_used_index[MMU_TABLE_NUM];
-
-  uint32_t temp32;
-  uint32_t temp_area[2] = { 0xFFFFFFFF, 0xFFFFFFFF };
+  uint8_t c;
 
-  uint32_t record_temp32 = 0;
-  uint8_t  magic_flag    = 0;
-
-  if (size > PRO_PURE_DATA_MAX_SIZE || size > MEMORY_SIZE)
+  if (size > PRO_PURE_DATA_MAX_SIZE)
   {
-    return (MMU_Tab *) 0;
+    stats.failCount++;
+    return (MMU_Tab*)0;
   }
 
-  for (i = 0; i < MMU_TABLE_NUM; i++)
+  for (c = 0; c < CLASS_NUM; c++)
   {
-    if (memoryTable[i].usageFlag == 1)
+    if (size > sizeClass[c].blockSize)
     {
-      mem_used += memoryTable[i].memSize;
-      mmu_tab_used_index[mmu_tab_used_num++] = memoryTable[i].tabIndex;
+      continue;
     }
+    if (freeHead[c] != NO_BLOCK)
+    {
+      break;
+    }
+    stats.classes[c].exhausted++;
   }
 
-  if (MEMORY_SIZE < (mem_used + size))
+  if (c == CLASS_NUM)
   {
-    return (MMU_Tab *) 0;
+    stats.failCount++;
+    return (MMU_Tab*)0;
   }
 
-  if (mem_used == 0)
-  {
-    memoryTable[1].pmem      = memoryTable[0].pmem;
-    memoryTable[1].memSize   = size;
-    memoryTable[1].usageFlag = 1;
-    return &memoryTable[1];
-  }
+  uint8_t index = freeHead[c];
+  freeHead[c]   = nextFree[index];
+
+  MMU_Tab* mmu_tab   = &memoryTable[index];
+  mmu_tab->usageFlag = 1;
+  mmu_tab->memSize   = size;
 
-  for (i = 0; i < (mmu_tab_used_num - 1); i++)
+  stats.allocCount++;
+  stats.bytesInUse += size;
+  if (stats.bytesInUse > stats.bytesHighWater)
   {
-    for (j = 0; j < (mmu_tab_used_num - i - 1); j++)
-    {
-      if (memoryTable[mmu_tab_used_index[j]].pmem >
-          memoryTable[mmu_tab_used_index[j + 1]].pmem)
-      {
-        mmu_tab_used_index[j + 1] ^= mmu_tab_used_index[j];
-        mmu_tab_used_index[j] ^= mmu_tab_used_index[j + 1];
-        mmu_tab_used_index[j + 1] ^= mmu_tab_used_index[j];
-      }
-    }
+    stats.bytesHighWater = stats.bytesInUse;
   }
-  for (i = 0; i < (mmu_tab_used_num - 1); i++)
+  if (++stats.classes[c].inUse > stats.classes[c].highWater)
   {
-    temp32 = static_cast<uint32_t>(memoryTable[mmu_tab_used_index[i + 1]].pmem -
-                                   memoryTable[mmu_tab_used_index[i]].pmem);
-
-    if ((temp32 - memoryTable[mmu_tab_used_index[i]].memSize) >= size)
-    {
-      if (temp_area[1] > (temp32 - memoryTable[mmu_tab_used_index[i]].memSize))
-      {
-        temp_area[0] = memoryTable[mmu_tab_used_index[i]].tabIndex;
-        temp_area[1] = temp32 - memoryTable[mmu_tab_used_index[i]].memSize;
-      }
-    }
-
-    record_temp32 += temp32 - memoryTable[mmu_tab_used_index[i]].memSize;
-    if (record_temp32 >= size && magic_flag == 0)
-    {
-      j          = i;
-      magic_flag = 1;
-    }
+    stats.classes[c].highWater = stats.classes[c].inUse;
   }
 
-  if (temp_area[0] == 0xFFFFFFFF && temp_area[1] == 0xFFFFFFFF)
-  {
-    for (i = 0; i < j; i++)
-    {
-      if (memoryTable[mmu_tab_used_index[i + 1]].pmem >
-          (memoryTable[mmu_tab_used_index[i]].pmem +
-           memoryTable[mmu_tab_used_index[i]].memSize))
-      {
-        memmove(memoryTable[mmu_tab_used_index[i]].pmem +
-                  memoryTable[mmu_tab_used_index[i]].memSize,
-                memoryTable[mmu_tab_used_index[i + 1]].pmem,
-                memoryTable[mmu_tab_used_index[i + 1]].memSize);
-        memoryTable[mmu_tab_used_index[i + 1]].pmem =
-          memoryTable[mmu_tab_used_index[i]].pmem +
-          memoryTable[mmu_tab_used_index[i]].memSize;
-      }
-    }
-
-    for (i = 1; i < (MMU_TABLE_NUM - 1); i++)
-    {
-      if (memoryTable[i].usageFlag == 0)
-      {
-        memoryTable[i].pmem = memoryTable[mmu_tab_used_index[j]].pmem +
-                              memoryTable[mmu_tab_used_index[j]].memSize;
+  return mmu_tab;
+}
 
-        memoryTable[i].memSize   = size;
-        memoryTable[i].usageFlag = 1;
-        return &memoryTable[i];
-      }
-    }
-    return (MMU_Tab*)0;
+void
+MMU::getStats(Stats* out) const
+{
+  if (out)
+  {
+    memcpy(out, &stats, sizeof(stats));
   }
+}
 
-  for (i = 1; i < (MMU_TABLE_NUM - 1); i++)
+void
+MMU::resetStats()
+{
+  stats.allocCount     = 0;
+  stats.freeCount      = 0;
+  stats.failCount      = 0;
+  stats.bytesHighWater = stats.bytesInUse;
+  for (uint8_t c = 0; c < CLASS_NUM; c++)
   {
-    if (memoryTable[i].usageFlag == 0)
-    {
-      memoryTable[i].pmem =
-        memoryTable[temp_area[0]].pmem + memoryTable[temp_area[0]].memSize;
-
-      memoryTable[i].memSize   = size;
-      memoryTable[i].usageFlag = 1;
-      return &memoryTable[i];
-    }
+    stats.classes[c].highWater = stats.classes[c].inUse;
+    stats.classes[c].exhausted = 0;
   }
-
-  return (MMU_Tab*)0;
 }
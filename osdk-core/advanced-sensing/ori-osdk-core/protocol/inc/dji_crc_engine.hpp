@@ -0,0 +1,91 @@
+/** @file dji_crc_engine.hpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Table-sliced and hardware accelerated CRC16/CRC32 for OpenProtocol
+ *
+ *  @Copyright (c) 2016-2017 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef ONBOARDSDK_DJI_CRC_ENGINE_H
+#define ONBOARDSDK_DJI_CRC_ENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace DJI
+{
+namespace OSDK
+{
+
+/*! @brief CRC engine for OpenProtocol frame verification
+ *
+ *  @details Computes the same CRC16 (reflected 0x8005) and CRC32 (reflected
+ *  0x04C11DB7, no final xor) as the byte-wise crc_tab16/crc_tab32 tables in
+ *  dji_crc.hpp, which stay available as the reference implementation.
+ *
+ *  The fastest available kernel is picked once at runtime:
+ *  - ARMv8 CRC32 instructions for CRC32, when the library is built with
+ *    the crc extension (e.g. -march=armv8-a+crc) and the CPU reports it.
+ *  - Slicing-by-8 tables otherwise. They are generated on first use.
+ *  - The byte-wise reference on STM32, to save the 12KB of tables.
+ */
+class CRCEngine
+{
+public:
+  typedef enum Kernel
+  {
+    KERNEL_REFERENCE = 0,
+    KERNEL_SLICING_BY_8,
+    KERNEL_ARMV8_CRC32,
+  } Kernel;
+
+  static uint16_t crc16(uint16_t crc, const uint8_t* pMsg, size_t nLen);
+  static uint32_t crc32(uint32_t crc, const uint8_t* pMsg, size_t nLen);
+
+  //! Byte-at-a-time reference on the dji_crc.hpp tables
+  static uint16_t crc16Reference(uint16_t crc, const uint8_t* pMsg,
+                                 size_t nLen);
+  static uint32_t crc32Reference(uint32_t crc, const uint8_t* pMsg,
+                                 size_t nLen);
+
+  //! Kernels in use, for logging and benchmarking
+  static Kernel getCRC16Kernel();
+  static Kernel getCRC32Kernel();
+  static const char* getKernelName(Kernel kernel);
+
+  //! Run the given kernel instead of the selected one, for testing and
+  //! benchmarking. Returns false if this build or CPU does not have it.
+  static bool crc16WithKernel(Kernel kernel, uint16_t& crc,
+                              const uint8_t* pMsg, size_t nLen);
+  static bool crc32WithKernel(Kernel kernel, uint32_t& crc,
+                              const uint8_t* pMsg, size_t nLen);
+
+private:
+  CRCEngine();
+};
+
+} // OSDK
+} // DJI
+
+#endif // ONBOARDSDK_DJI_CRC_ENGINE_H
@@ -33,6 +33,7 @@
 #include "dji_ack.hpp"
 #include "dji_aes.hpp"
 #include "dji_crc.hpp"
+#include "dji_crc_engine.hpp"
 #include "dji_hard_driver.hpp"
 #include "dji_log.hpp"
 #include "dji_platform_manager.hpp"
@@ -185,6 +186,15 @@ private:
   //! A lot of ACK parsing logic
   bool appHandler(void* protocolHeader);
 
+  //! Block mode hooks, see ProtocolBase::blockHandler
+  uint8_t* findHead(uint8_t* data, uint32_t len);
+
+  uint32_t verifyHeadAt(uint8_t* p_head);
+
+  bool verifyDataAt(uint8_t* p_head, uint32_t len);
+
+  bool callAppAt(uint8_t* p_head);
+
   //! For CMD-Frame data (push data) handling
   bool recvReqData(OpenHeader* protocolHeader);
 
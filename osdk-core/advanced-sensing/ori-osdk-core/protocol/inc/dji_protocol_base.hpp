@@ -121,6 +121,28 @@ protected:
 public:
   virtual bool byteHandler(const uint8_t in_data);
 
+protected:
+  //! step 2, block mode
+  //! Slice whole frames out of the receive window instead of feeding it
+  //! byte by byte, used when block_scan is set
+  virtual bool blockHandler();
+
+  //! helper function for block mode, dispatch the next frame in the window
+  bool sliceFrame();
+
+  //! Block mode hooks, the default implementations find nothing
+  //! Find the next candidate start of frame in data
+  virtual uint8_t* findHead(uint8_t* data, uint32_t len);
+
+  //! Verify a full header in place, return the frame length or 0
+  virtual uint32_t verifyHeadAt(uint8_t* p_head);
+
+  //! Verify a full frame in place
+  virtual bool verifyDataAt(uint8_t* p_head, uint32_t len);
+
+  //! Dispatch a verified frame in place
+  virtual bool callAppAt(uint8_t* p_head);
+
 protected:
   //! step 3
   //! Integrity checks for incoming data.
@@ -217,6 +239,16 @@ protected:
   //! A flag for large data protocol to avoid checking byte by byte
   bool is_large_data_protocol;
 
+  //! A flag to parse frames block by block, see blockHandler
+  bool block_scan;
+
+  //! Block mode receive window, frames are sliced out of it in place and
+  //! only the last partial frame is ever moved back to the front
+  uint8_t* scan_buf;
+  uint32_t scan_size;
+  uint32_t scan_pos;
+  uint32_t scan_end;
+
 }; // class ProtocolBase
 
 } // OSDK
@@ -0,0 +1,301 @@
+/** @file dji_crc_engine.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Table-sliced and hardware accelerated CRC16/CRC32 for OpenProtocol
+ *
+ *  @Copyright (c) 2016-2017 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "dji_crc_engine.hpp"
+#include "dji_crc.hpp"
+
+#if defined(__aarch64__) && defined(__linux__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#include <string.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+#define DJI_CRC_ARMV8 1
+#endif
+
+using namespace DJI;
+using namespace DJI::OSDK;
+
+namespace
+{
+
+#if !STM32
+
+/*
+ * Slicing-by-8: table[k][b] is the CRC of byte b followed by k zero bytes,
+ * so eight message bytes are folded into the CRC with eight independent
+ * lookups instead of eight dependent ones.
+ */
+struct SlicingTables
+{
+  uint16_t crc16[8][256];
+  uint32_t crc32[8][256];
+
+  SlicingTables()
+  {
+    for (int i = 0; i < 256; i++)
+    {
+      crc16[0][i] = crc_tab16[i];
+      crc32[0][i] = crc_tab32[i];
+    }
+    for (int k = 1; k < 8; k++)
+    {
+      for (int i = 0; i < 256; i++)
+      {
+        crc16[k][i] = (crc16[k - 1][i] >> 8) ^ crc_tab16[crc16[k - 1][i] & 0xff];
+        crc32[k][i] = (crc32[k - 1][i] >> 8) ^ crc_tab32[crc32[k - 1][i] & 0xff];
+      }
+    }
+  }
+};
+
+const SlicingTables&
+getSlicingTables()
+{
+  static const SlicingTables tables;
+  return tables;
+}
+
+inline uint32_t
+readLE32(const uint8_t* p)
+{
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+template <typename T>
+inline T
+sliceBy8(const T (*tab)[256], T crc, const uint8_t*& p, size_t& len)
+{
+  while (len >= 8)
+  {
+    uint32_t one = readLE32(p) ^ crc;
+    uint32_t two = readLE32(p + 4);
+    crc = tab[7][one & 0xff] ^ tab[6][(one >> 8) & 0xff] ^
+          tab[5][(one >> 16) & 0xff] ^ tab[4][one >> 24] ^
+          tab[3][two & 0xff] ^ tab[2][(two >> 8) & 0xff] ^
+          tab[1][(two >> 16) & 0xff] ^ tab[0][two >> 24];
+    p += 8;
+    len -= 8;
+  }
+  return crc;
+}
+
+uint16_t
+crc16SlicingBy8(uint16_t crc, const uint8_t* pMsg, size_t nLen)
+{
+  crc = sliceBy8<uint16_t>(getSlicingTables().crc16, crc, pMsg, nLen);
+  return CRCEngine::crc16Reference(crc, pMsg, nLen);
+}
+
+uint32_t
+crc32SlicingBy8(uint32_t crc, const uint8_t* pMsg, size_t nLen)
+{
+  crc = sliceBy8<uint32_t>(getSlicingTables().crc32, crc, pMsg, nLen);
+  return CRCEngine::crc32Reference(crc, pMsg, nLen);
+}
+
+#endif // !STM32
+
+#ifdef DJI_CRC_ARMV8
+/*
+ * The ARMv8 CRC32 instructions implement exactly the reflected 0x04C11DB7
+ * update of crc_tab32, without the usual pre/post inversion.
+ */
+uint32_t
+crc32Armv8(uint32_t crc, const uint8_t* pMsg, size_t nLen)
+{
+  while (nLen && (reinterpret_cast<uintptr_t>(pMsg) & 7))
+  {
+    crc = __crc32b(crc, *pMsg++);
+    nLen--;
+  }
+  while (nLen >= 8)
+  {
+    uint64_t v;
+    memcpy(&v, pMsg, sizeof(v));
+    crc = __crc32d(crc, v);
+    pMsg += 8;
+    nLen -= 8;
+  }
+  while (nLen--)
+  {
+    crc = __crc32b(crc, *pMsg++);
+  }
+  return crc;
+}
+#endif
+
+typedef uint16_t (*CRC16Func)(uint16_t, const uint8_t*, size_t);
+typedef uint32_t (*CRC32Func)(uint32_t, const uint8_t*, size_t);
+
+struct KernelSelection
+{
+  CRC16Func           crc16;
+  CRC32Func           crc32;
+  CRCEngine::Kernel   crc16Kernel;
+  CRCEngine::Kernel   crc32Kernel;
+
+  KernelSelection()
+  {
+#if STM32
+    crc16       = CRCEngine::crc16Reference;
+    crc32       = CRCEngine::crc32Reference;
+    crc16Kernel = CRCEngine::KERNEL_REFERENCE;
+    crc32Kernel = CRCEngine::KERNEL_REFERENCE;
+#else
+    crc16       = crc16SlicingBy8;
+    crc32       = crc32SlicingBy8;
+    crc16Kernel = CRCEngine::KERNEL_SLICING_BY_8;
+    crc32Kernel = CRCEngine::KERNEL_SLICING_BY_8;
+#ifdef DJI_CRC_ARMV8
+    if (getauxval(AT_HWCAP) & HWCAP_CRC32)
+    {
+      crc32       = crc32Armv8;
+      crc32Kernel = CRCEngine::KERNEL_ARMV8_CRC32;
+    }
+#endif
+#endif
+  }
+};
+
+const KernelSelection&
+getKernels()
+{
+  static const KernelSelection kernels;
+  return kernels;
+}
+
+} // namespace
+
+uint16_t
+CRCEngine::crc16(uint16_t crc, const uint8_t* pMsg, size_t nLen)
+{
+  return getKernels().crc16(crc, pMsg, nLen);
+}
+
+uint32_t
+CRCEngine::crc32(uint32_t crc, const uint8_t* pMsg, size_t nLen)
+{
+  return getKernels().crc32(crc, pMsg, nLen);
+}
+
+uint16_t
+CRCEngine::crc16Reference(uint16_t crc, const uint8_t* pMsg, size_t nLen)
+{
+  for (size_t i = 0; i < nLen; i++)
+  {
+    crc = (crc >> 8) ^ crc_tab16[(crc ^ pMsg[i]) & 0xff];
+  }
+  return crc;
+}
+
+uint32_t
+CRCEngine::crc32Reference(uint32_t crc, const uint8_t* pMsg, size_t nLen)
+{
+  for (size_t i = 0; i < nLen; i++)
+  {
+    crc = (crc >> 8) ^ crc_tab32[(crc ^ pMsg[i]) & 0xff];
+  }
+  return crc;
+}
+
+CRCEngine::Kernel
+CRCEngine::getCRC16Kernel()
+{
+  return getKernels().crc16Kernel;
+}
+
+CRCEngine::Kernel
+CRCEngine::getCRC32Kernel()
+{
+  return getKernels().crc32Kernel;
+}
+
+bool
+CRCEngine::crc16WithKernel(Kernel kernel, uint16_t& crc, const uint8_t* pMsg,
+                           size_t nLen)
+{
+  switch (kernel)
+  {
+    case KERNEL_REFERENCE:
+      crc = crc16Reference(crc, pMsg, nLen);
+      return true;
+#if !STM32
+    case KERNEL_SLICING_BY_8:
+      crc = crc16SlicingBy8(crc, pMsg, nLen);
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+bool
+CRCEngine::crc32WithKernel(Kernel kernel, uint32_t& crc, const uint8_t* pMsg,
+                           size_t nLen)
+{
+  switch (kernel)
+  {
+    case KERNEL_REFERENCE:
+      crc = crc32Reference(crc, pMsg, nLen);
+      return true;
+#if !STM32
+    case KERNEL_SLICING_BY_8:
+      crc = crc32SlicingBy8(crc, pMsg, nLen);
+      return true;
+#endif
+#ifdef DJI_CRC_ARMV8
+    case KERNEL_ARMV8_CRC32:
+      if (!(getauxval(AT_HWCAP) & HWCAP_CRC32))
+        return false;
+      crc = crc32Armv8(crc, pMsg, nLen);
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+const char*
+CRCEngine::getKernelName(Kernel kernel)
+{
+  switch (kernel)
+  {
+    case KERNEL_SLICING_BY_8:
+      return "slicing-by-8";
+    case KERNEL_ARMV8_CRC32:
+      return "armv8-crc32";
+    case KERNEL_REFERENCE:
+    default:
+      return "reference";
+  }
+}
@@ -62,6 +62,7 @@ OpenProtocol::~OpenProtocol()
 {
   delete[] p_filter->recvBuf;
   delete p_filter;
+  delete[](scan_buf);
   delete[](buf);
   delete[](encodeSendData);
   delete(p_recvContainer);
@@ -90,6 +91,13 @@ OpenProtocol::init(HardDriver* sDevice, MMU* mmuPtr, bool userCallbackThread)
   buf             = new uint8_t[BUFFER_SIZE];
   encodeSendData  = new uint8_t[BUFFER_SIZE];
 
+  //! Room for one partial frame plus one full read
+  block_scan = true;
+  scan_size  = MAX_RECV_LEN + BUFFER_SIZE;
+  scan_buf   = new uint8_t[scan_size];
+  scan_pos   = 0;
+  scan_end   = 0;
+
   mmu          = mmuPtr;
   buf_read_pos = 0;
   read_len     = 0;
@@ -541,25 +549,18 @@ OpenProtocol::checkStream()
 bool
 OpenProtocol::verifyHead()
 {
-  OpenHeader* p_head = (OpenHeader*)(p_filter->recvBuf);
-
   //! Bool to check if the protocol parser has finished a full frame
   bool isFrame = false;
 
-  if ((p_head->sof == OpenProtocol::SOF) && (p_head->version == 0) &&
-      (p_head->length < OpenProtocol::MAX_RECV_LEN) &&
-      (p_head->reserved0 == 0) && (p_head->reserved1 == 0) &&
-      (crcHeadCheck((uint8_t*)p_head, sizeof(OpenHeader)) == 0))
+  uint32_t frameLen = verifyHeadAt(p_filter->recvBuf);
+  if (frameLen == 0)
   {
-    // check if this head is a ack or simple package
-    if (p_head->length == sizeof(OpenHeader))
-    {
-      isFrame = callApp();
-    }
+    shiftDataStream();
   }
-  else
+  else if (frameLen == sizeof(OpenHeader))
   {
-    shiftDataStream();
+    // this head is a ack or simple package
+    isFrame = callApp();
   }
   return isFrame;
 }
@@ -573,7 +574,7 @@ OpenProtocol::verifyData()
   //! Bool to check if the protocol parser has finished a full frame
   bool isFrame = false;
 
-  if (crcTailCheck((uint8_t*)p_head, p_head->length) == 0)
+  if (verifyDataAt((uint8_t*)p_head, p_head->length))
   {
     isFrame = callApp();
   }
@@ -590,15 +591,53 @@ bool
 OpenProtocol::callApp()
 {
   // pass current data to handler
-  OpenHeader* p_head = (OpenHeader*)p_filter->recvBuf;
-
-  encodeData(p_head, aes256_decrypt_ecb);
-  bool isFrame = appHandler((OpenHeader*)p_filter->recvBuf);
+  bool isFrame = callAppAt(p_filter->recvBuf);
   prepareDataStream();
 
   return isFrame;
 }
 
+//! Block mode, step 2 in ProtocolBase::blockHandler
+uint8_t*
+OpenProtocol::findHead(uint8_t* data, uint32_t len)
+{
+  return (uint8_t*)memchr(data, OpenProtocol::SOF, len);
+}
+
+//! Block mode step 6, also used by verifyHead
+//! @return frame length, 0 if the head is invalid
+uint32_t
+OpenProtocol::verifyHeadAt(uint8_t* p_buf)
+{
+  OpenHeader* p_head = (OpenHeader*)p_buf;
+
+  if ((p_head->sof == OpenProtocol::SOF) && (p_head->version == 0) &&
+      (p_head->length < OpenProtocol::MAX_RECV_LEN) &&
+      (p_head->reserved0 == 0) && (p_head->reserved1 == 0) &&
+      (crcHeadCheck(p_buf, sizeof(OpenHeader)) == 0))
+  {
+    return p_head->length;
+  }
+  return 0;
+}
+
+//! Block mode step 7, also used by verifyData
+bool
+OpenProtocol::verifyDataAt(uint8_t* p_buf, uint32_t len)
+{
+  return crcTailCheck(p_buf, len) == 0;
+}
+
+//! Block mode step 8, also used by callApp
+bool
+OpenProtocol::callAppAt(uint8_t* p_buf)
+{
+  OpenHeader* p_head = (OpenHeader*)p_buf;
+
+  encodeData(p_head, aes256_decrypt_ecb);
+  return appHandler(p_head);
+}
+
 //! Step 9
 bool
 OpenProtocol::appHandler(void* protocolHeader)
@@ -882,29 +921,13 @@ OpenProtocol::crc32Update(uint32_t crc, uint8_t ch)
 uint16_t
 OpenProtocol::crc16Calc(const uint8_t* pMsg, size_t nLen)
 {
-  size_t   i;
-  uint16_t wCRC = CRC_INIT;
-
-  for (i = 0; i < nLen; i++)
-  {
-    wCRC = crc16Update(wCRC, pMsg[i]);
-  }
-
-  return wCRC;
+  return CRCEngine::crc16(CRC_INIT, pMsg, nLen);
 }
 
 uint32_t
 OpenProtocol::crc32Calc(const uint8_t* pMsg, size_t nLen)
 {
-  size_t   i;
-  uint32_t wCRC = CRC_INIT;
-
-  for (i = 0; i < nLen; i++)
-  {
-    wCRC = crc32Update(wCRC, pMsg[i]);
-  }
-
-  return wCRC;
+  return CRCEngine::crc32(CRC_INIT, pMsg, nLen);
 }
 
 /******************* Encryption *********************/
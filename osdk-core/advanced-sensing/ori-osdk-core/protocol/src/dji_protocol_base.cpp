@@ -35,6 +35,11 @@ using namespace DJI::OSDK;
 ProtocolBase::ProtocolBase()
   : reuse_buffer(true)
   , is_large_data_protocol(false)
+  , block_scan(false)
+  , scan_buf(NULL)
+  , scan_size(0)
+  , scan_pos(0)
+  , scan_end(0)
   , BUFFER_SIZE(1024)
 {
 }
@@ -69,6 +74,12 @@ ProtocolBase::receive()
 bool
 ProtocolBase::readPoll()
 {
+  //! Block mode reads straight into its own window
+  if (block_scan)
+  {
+    return blockHandler();
+  }
+
   //! Bool to check if the protocol parser has finished a full frame
   bool isFrame = false;
 
@@ -174,6 +185,123 @@ ProtocolBase::byteHandler(const uint8_t in_data)
   return isFrame;
 }
 
+//! Step 2, block mode
+//! @note The driver reads straight into scan_buf and frames are verified and
+//! dispatched where they lie. Resync keeps the byte-wise semantics, a bad head
+//! or a bad data CRC drops one byte, but the next head is found with memchr
+//! instead of memmove-ing the buffer for every byte.
+bool
+ProtocolBase::blockHandler()
+{
+  //! Frames left over from the last read go first
+  if (sliceFrame())
+  {
+    return true;
+  }
+
+  //! At most one partial frame is left, move it to the front only when the
+  //! next read would not fit behind it
+  if (scan_pos == scan_end)
+  {
+    scan_pos = 0;
+    scan_end = 0;
+  }
+  else if (scan_end + BUFFER_SIZE > scan_size)
+  {
+    memmove(scan_buf, scan_buf + scan_pos, scan_end - scan_pos);
+    scan_end -= scan_pos;
+    scan_pos = 0;
+  }
+
+  int len = deviceDriver->readall(scan_buf + scan_end, BUFFER_SIZE);
+  if (len < 0)
+  {
+    scan_pos = 0;
+    scan_end = 0;
+    return false;
+  }
+  scan_end += len;
+
+#ifdef API_BUFFER_DATA
+  onceRead = len;
+  totalRead += onceRead;
+#endif // API_BUFFER_DATA
+
+  return sliceFrame();
+}
+
+bool
+ProtocolBase::sliceFrame()
+{
+  while (scan_end - scan_pos >= HEADER_LEN)
+  {
+    uint8_t* p_head = findHead(scan_buf + scan_pos, scan_end - scan_pos);
+    if (p_head == NULL)
+    {
+      scan_pos = scan_end;
+      break;
+    }
+
+    scan_pos = p_head - scan_buf;
+    if (scan_end - scan_pos < HEADER_LEN)
+    {
+      break;
+    }
+
+    uint32_t frameLen = verifyHeadAt(p_head);
+    if (frameLen < HEADER_LEN || frameLen > scan_size - BUFFER_SIZE)
+    {
+      //! Same as shiftDataStream, throw one byte
+      scan_pos++;
+      continue;
+    }
+
+    if (scan_end - scan_pos < frameLen)
+    {
+      //! Wait for the rest of the frame
+      break;
+    }
+
+    if (frameLen > HEADER_LEN && !verifyDataAt(p_head, frameLen))
+    {
+      //! Same as reuseDataStream, throw the head byte and rescan the rest
+      scan_pos++;
+      continue;
+    }
+
+    scan_pos += frameLen;
+    if (callAppAt(p_head))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint8_t*
+ProtocolBase::findHead(uint8_t* data, uint32_t len)
+{
+  return NULL;
+}
+
+uint32_t
+ProtocolBase::verifyHeadAt(uint8_t* p_head)
+{
+  return 0;
+}
+
+bool
+ProtocolBase::verifyDataAt(uint8_t* p_head, uint32_t len)
+{
+  return false;
+}
+
+bool
+ProtocolBase::callAppAt(uint8_t* p_head)
+{
+  return false;
+}
+
 //! Step 3
 bool
 ProtocolBase::streamHandler(uint8_t in_data)
@@ -422,10 +422,17 @@ public:
 
 public:
   void setUserBroadcastCallback(VehicleCallBack callback, UserData userData);
-  VehicleCallBackHandler unpackHandler;
+  /*!
+   * @brief Same as setUserBroadcastCallback, but the callback gets a view of
+   * the received frame instead of a RecvContainer copy. Takes precedence over
+   * the by-value callback when both are set.
+   */
+  void setUserBroadcastViewCallback(VehicleViewCallBack callback,
+                                    UserData            userData);
+  VehicleViewCallBackHandler unpackHandler;
 
 public:
-  static void unpackCallback(Vehicle* vehicle, RecvContainer recvFrame,
+  static void unpackCallback(Vehicle* vehicle, const RecvFrameView& recvFrame,
                              UserData userData);
   static void setFrequencyCallback(Vehicle* vehicle, RecvContainer recvFrame,
                                    UserData userData);
@@ -465,23 +472,29 @@ private:
 private:
   /*!
    * @brief Extract broadcast data for A3/N3/M600
-   * @param recvFrame: pointer to the raw data payload
+   * @param recvFrame: view of the raw data payload
    */
-  void unpackData(RecvContainer* recvFrame);
+  void unpackData(const RecvFrameView& recvFrame);
 
   /*!
    * @brief Extract broadcast data for M100
-   * @param recvFrame: pointer to the raw data payload
+   * @param recvFrame: view of the raw data payload
    */
-  void unpackM100Data(RecvContainer* pRecvFrame);
+  void unpackM100Data(const RecvFrameView& recvFrame);
 
   /*!
    * @brief Extract broadcast data for M600 FW 3.2.41.5
-   * @param recvFrame: pointer to the raw data payload
+   * @param recvFrame: view of the raw data payload
    */
-  void unpackOldM600Data(RecvContainer* recvFrame);
+  void unpackOldM600Data(const RecvFrameView& recvFrame);
 
-  inline void unpackOne(FLAG flag, void* data, uint8_t*& buf, size_t size);
+  /*!
+   * @brief Start unpacking a frame, reads the pass flag and returns the
+   * first topic, or NULL if the frame is too short
+   */
+  inline const uint8_t* unpackBegin(const RecvFrameView& recvFrame);
+  inline void unpackOne(FLAG flag, void* data, const uint8_t*& buf,
+                        size_t size);
 
 public:
   void setBroadcastLength(uint16_t length);
@@ -526,7 +539,11 @@ private:
   void lockMSG();
   void freeMSG();
 
-  VehicleCallBackHandler userCbHandler;
+  /* End of the frame being unpacked, only valid under lockMSG() */
+  const uint8_t* unpackEnd;
+
+  VehicleCallBackHandler     userCbHandler;
+  VehicleViewCallBackHandler userViewCbHandler;
 };
 
 } // OSDK
@@ -1738,6 +1738,27 @@ class CameraManager {
    */
   ErrorCode::ErrorCodeType startReqFileList(PayloadIndexType index, FileMgr::FileListReqCBType cb, void *userData);
 
+  /*! @brief start to requeset the filelist of camera page by page, handing
+   * the files over in batches as they are decoded, non-blocking calls
+   *
+   *  @platforms M300
+   *  @note Nothing waits for the whole list, so the first files can be shown
+   * while a long list is still coming in. The camera sends the page given by
+   * startIndex and count of the filter, the amount passed to the callback
+   * tells how many entries there are from startIndex on, which lets the
+   * newest files be asked for alone.
+   *  @param index Camera module index, input limit see enum
+   * DJI::OSDK::PayloadIndexType
+   *  @param filter The page to request and the files to keep, see
+   * DJI::OSDK::FileMgr::FileListFilter
+   *  @param cb Called with each batch of files and a last time with finished
+   * set. The detail of the callback ref to the
+   * DJI::OSDK::FileMgr::FileListBatchCBType
+   *  @param userData The parameter to pass user data into the cb
+   *  @return ErrorCode::ErrorCodeType error code
+   */
+  ErrorCode::ErrorCodeType startReqFileListStream(PayloadIndexType index, const FileMgr::FileListFilter &filter, FileMgr::FileListBatchCBType cb, void *userData);
+
   /*! @brief start to requeset the files of camera, non-blocking calls
    *
    *  @platforms M300
@@ -1752,6 +1773,60 @@ class CameraManager {
    *  @return ErrorCode::ErrorCodeType error code
    */
   ErrorCode::ErrorCodeType startReqFileData(PayloadIndexType index, int fileIndex, std::string localPath, FileMgr::FileDataReqCBType cb, void *userData);
+
+  /*! @brief resume the download of a file of camera, non-blocking calls
+   *
+   *  @platforms M300
+   *  @note A failed download keeps the file and a "<localPath>.part" file
+   * naming the ranges received. Only the missing ranges are requested then,
+   * or the whole file if there is nothing to resume.
+   *  @param index Camera module index, input limit see enum
+   * DJI::OSDK::PayloadIndexType
+   *  @param fileIndex The file index of the target file. The file index can be
+   * got from the file list.
+   *  @param localPath The path the earlier download saved the file to.
+   *  @param cb The download result will be called by this cb. The detail
+   * of the callback ref to the DJI::OSDK::FileMgr::FileDataReqCBType
+   *  @param userData The parameter to pass user data into the cb
+   *  @return ErrorCode::ErrorCodeType error code
+   */
+  ErrorCode::ErrorCodeType startResumeFileData(PayloadIndexType index, int fileIndex, std::string localPath, FileMgr::FileDataReqCBType cb, void *userData);
+
+  /*! @brief One media file of a batch download */
+  typedef struct MediaDownloadJob {
+    PayloadIndexType index;
+    int fileIndex;
+    std::string localPath;
+  } MediaDownloadJob;
+
+  /*! @brief start to download a batch of files from one or more cameras,
+   * non-blocking calls once the cameras are set up
+   *
+   *  @platforms M300
+   *  @note Each camera of the batch is first switched to playback mode and
+   * given the download right, blocking for up to 4s per camera. Cameras then
+   * download in parallel, files of a camera one after the other in the given
+   * order. Files are resumed like with startResumeFileData.
+   *  @param jobs The files to download. The file index can be got from the
+   * file list.
+   *  @param fileCb Called once per file with its position in jobs. The detail
+   * of the callback ref to the DJI::OSDK::FileMgr::BatchFileCBType
+   *  @param progressCb Called about once a second with the aggregate progress
+   * and throughput, and a last time when the batch is over. The detail of the
+   * callback ref to the DJI::OSDK::FileMgr::BatchProgressCBType
+   *  @param userData The parameter to pass user data into the callbacks
+   *  @return ErrorCode::ErrorCodeType error code
+   */
+  ErrorCode::ErrorCodeType startBatchDownload(const std::vector<MediaDownloadJob> &jobs,
+                                              FileMgr::BatchFileCBType fileCb,
+                                              FileMgr::BatchProgressCBType progressCb,
+                                              void *userData);
+
+  /*! @brief stop the running batch download
+   *
+   *  @platforms M300
+   */
+  void cancelBatchDownload();
 #endif
  private:
 #if defined(__linux__)
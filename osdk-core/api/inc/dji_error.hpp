@@ -158,10 +158,21 @@ class ErrorCode {
    */
   typedef std::map<const RawRetCodeType, ErrorCodeMsg> ErrorCodeMapType;
 
+  /*! @brief One entry of a function's error message table. The tables are
+   *  constexpr arrays sorted by rawRetCode and searched with binary search.
+   */
+  typedef struct ErrorCodeMsgEntry
+  {
+    RawRetCodeType rawRetCode;
+    const char*    errorMsg;
+    const char*    solutionMsg;
+  } ErrorCodeMsgEntry;
+
   typedef struct FunctionDataType
   {
-    const char* FunctionName;
-    const ErrorCodeMapType (*getMap)();
+    const char*              FunctionName;
+    const ErrorCodeMsgEntry* table;
+    uint32_t                 tableSize;
   } FunctionDataType;
 
   typedef struct ModuleDataType
@@ -212,16 +223,25 @@ class ErrorCode {
    *  @param errCode Unified error type
    *  @return Function name
    */
-  static ErrorCode::RawRetCodeType getRawRetCode(ErrorCodeType errCode);
+  static constexpr ErrorCode::RawRetCodeType getRawRetCode(
+      ErrorCodeType errCode) {
+    return (RawRetCodeType)(errCode & 0xFFFFFFFF);
+  }
 
   static ErrorCode::ErrorCodeType getLinkerErrorCode(E_OsdkStat cb_type);
 
   /*! @brief Get error code messages from errCode
    *  @param errCode Unified error type
-   *  @return Releated error code messages
+   *  @return Releated error code messages, the strings are static
    */
   static ErrorCodeMsg getErrorCodeMsg(int64_t errCode);
 
+  /*! @brief Look up the message table entry of errCode
+   *  @param errCode Unified error type
+   *  @return The entry, or NULL if errCode is unknown
+   */
+  static const ErrorCodeMsgEntry* findErrorCodeMsg(int64_t errCode);
+
   /*! @brief Print error code messages to console
    *  @param errCode Unified error type
    */
@@ -1304,58 +1324,19 @@ class ErrorCode {
   static const uint8_t moduleIDLeftMove = 40;
   static const uint8_t functionIDLeftMove = 32;
 
-  /*! @brief The err code message data of the PSDKCommonErr error code messages.
-   */
-  static const std::pair<const ErrorCode::ErrorCodeType, ErrorCode::ErrorCodeMsg> PSDKCommonErrData[];
-
-  /*! @brief Get the map container of the PSDKCommonErr error code messages.
-   */
-  static const ErrorCodeMapType getPSDKCommonErrorMap();
-
-  /*! @brief The err code message data of the CameraCommonErr error code messages.
-   */
-  static const std::pair<const ErrorCode::ErrorCodeType, ErrorCode::ErrorCodeMsg> CameraCommonErrData[];
-
-  /*! @brief Get the map container of the CameraCommonErr error code messages.
-   */
-  static const ErrorCodeMapType getCameraCommonErrorMap();
-
-  /*! @brief The err code message data of the GimbalCommonErr error code messages.
-   */
-  static const std::pair<const ErrorCode::ErrorCodeType, ErrorCode::ErrorCodeMsg> GimbalCommonErrData[];
-
-  /*! @brief Get the map container of the GimbalCommonErr error code messages.
-   */
-  static const ErrorCodeMapType getGimbalCommonErrorMap();
-
-  /*! @brief The err code message data of the SystemCommonErr error code messages.
-   */
-  static const std::pair<const ErrorCode::ErrorCodeType, ErrorCode::ErrorCodeMsg> SystemCommonErrData[];
-
-  /*! @brief The err code message data of the WaypointV2 error code messages.
- */
-  static const ErrorCodeMapType getWaypointV2CommonErrorMap();
-
-  static const std::pair<const ErrorCode::ErrorCodeType, ErrorCode::ErrorCodeMsg> WaypointV2CommonErrData[];
-
-
-  /*! @brief Get the map container of the SystemCommonErr error code messages.
-   */
-  static const ErrorCodeMapType getSystemCommonErrorMap();
-
-  /*! @brief The array to contain all the function maps of gimbal.
+  /*! @brief The array to contain all the function tables of gimbal.
    */
   static const FunctionDataType GimbalFunction[functionMaxCnt];
 
-  /*! @brief The array to contain all the function maps of camera.
+  /*! @brief The array to contain all the function tables of camera.
    */
   static const FunctionDataType CameraFunction[functionMaxCnt];
 
-  /*! @brief The array to contain all the function maps of psdk.
+  /*! @brief The array to contain all the function tables of psdk.
    */
   static const FunctionDataType PSDKFunction[functionMaxCnt];
 
-  /*! @brief The array to contain all the function maps of System.
+  /*! @brief The array to contain all the function tables of System.
    */
   static const FunctionDataType SystemFunction[functionMaxCnt];
 
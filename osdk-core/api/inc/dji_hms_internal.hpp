@@ -38,15 +38,39 @@ namespace OSDK{
 /*! the type of HMS's error code information*/
 typedef struct HMSErrCodeInfo {
     uint32_t alarmId;            /*! error code*/
-    std::string groundAlarmInfo; /*! alarm information when the flight is on the ground*/
-    std::string flyAlarmInfo;    /*! alarm information when the flight is in the air*/
+    const char *groundAlarmInfo; /*! alarm information when the flight is on the ground*/
+    const char *flyAlarmInfo;    /*! alarm information when the flight is in the air*/
 } HMSErrCodeInfo;
 
-/*! the length of HMS's error code table*/
+/*! the max length of HMS's error code table*/
 const uint32_t dbHMSErrNum = 700;
 
+/*! the buffer size which is enough for any formatted alarm information*/
+const uint32_t hmsAlarmInfoMaxLen = 256;
+
 extern void encodeSender(const uint8_t sender,uint8_t & deviceType, uint8_t & deviceIndex);
 extern bool replaceStr(string &str, const string oldReplaceStr, const string newReplaceStr);
+
+/*! @brief Binary search HMS's error code table
+ *  @param alarmId error code of HMS's pushing data
+ *  @return the table entry, or NULL if the error code is unknown
+ */
+extern const HMSErrCodeInfo *findHMSErrCodeInfo(uint32_t alarmId);
+
+/*! @brief HMS's error code table, sorted by alarmId
+ *  @param size the count of entries in the table
+ *  @return the first entry of the table
+ */
+extern const HMSErrCodeInfo *getHMSErrCodeInfoTbl(uint32_t &size);
+
+/*! @brief Expand an alarm information template into buf in one pass,
+ *  %alarmid <-> 0x1a010040 , %index <-> 1, %component_index <-> 1. As with
+ *  replaceStr(), only the first occurrence of each placeholder is replaced.
+ *  @return length of the formatted string, it's truncated to bufSize - 1
+ */
+extern uint32_t formatHMSAlarmInfo(char *buf, uint32_t bufSize, const char *alarmInfo,
+                                   uint32_t alarmId, uint8_t sensorIndex,
+                                   uint8_t componentIndex);
  }
   }
 #endif //ONBOARDSDK_DJI_HMS_INTERNAL_HPP
\ No newline at end of file
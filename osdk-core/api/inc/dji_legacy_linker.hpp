@@ -120,8 +120,12 @@ public:
 public:
   void send(const uint8_t cmd[], void *pdata, size_t len);
 
+  /*! The request context comes from AsyncContextPool. With releaseUserData
+   *  set, userData must come from AsyncContextPool as well, and is released
+   *  with the context once the request completes or fails. */
   void sendAsync(const uint8_t cmd[], void *pdata, size_t len, int timeout,
-                 int retry_time, VehicleCallBack callback, UserData userData);
+                 int retry_time, VehicleCallBack callback, UserData userData,
+                 bool releaseUserData = false);
 
   void* sendSync(const uint8_t cmd[], void *pdata, size_t len,
                           int timeout, int retry_time);
@@ -129,12 +133,21 @@ public:
   bool registerCMDCallback(uint8_t cmdSet, uint8_t cmdID,
                            VehicleCallBack &callback, UserData &userData);
 
+  /*! Same as above, but the callback gets a view over the receive buffer
+   *  of the linker instead of a RecvContainer copy. */
+  bool registerCMDCallback(uint8_t cmdSet, uint8_t cmdID,
+                           VehicleViewCallBack callback, UserData userData);
+
  private:
   Vehicle* vehicle;
 
   void initX5SEnableThread();
+  bool registerAdaptingCallback(uint8_t cmdSet, uint8_t cmdID,
+                                VehicleCallBack callback,
+                                VehicleViewCallBack viewCallback,
+                                UserData userData);
   void *decodeAck(E_OsdkStat ret, uint8_t cmdSet, uint8_t cmdId,
-                  RecvContainer recvFrame);
+                  const RecvContainer &recvFrame);
  private:
   uint8_t rawVersionACK[MAX_ACK_SIZE];
 
@@ -33,8 +33,10 @@
 #include "dji_log.hpp"
 #include "dji_telemetry.hpp"
 #include "dji_vehicle_callback.hpp"
+#include <tuple>
 
 #ifdef __linux__
+#include <atomic>
 #include <cstring>
 #elif STM32
 //! handle array of characters
@@ -103,6 +105,8 @@ public:
 
   void setUserUnpackCallback(VehicleCallBack userFunctionAfterPackageExtraction,
                              UserData        userData);
+  void setUserUnpackViewCallback(
+    VehicleViewCallBack userFunctionAfterPackageExtraction, UserData userData);
 
   bool isOccupied();
   void setOccupied(bool status);
@@ -118,6 +122,18 @@ public:
   uint8_t*               getDataBuffer();
   uint32_t               getBufferSize();
   VehicleCallBackHandler getUnpackHandler();
+  VehicleViewCallBackHandler getUnpackViewHandler();
+
+  /*!
+   * @brief Seqlock guarding the data buffer. The counter is odd while the
+   * decode thread is copying a new package in and even once the copy is
+   * complete, so each even value identifies one package generation.
+   *
+   * @note Only the decode thread may call beginWrite()/endWrite().
+   */
+  void     beginWrite();
+  void     endWrite();
+  uint32_t getSequence();
 
   /*!
   * @brief Helper function to do post processing when adding package is
@@ -160,12 +176,27 @@ private: // Private variables
    */
   uint8_t* incomingDataBuffer;
 
+#if STM32
+  typedef volatile uint32_t SequenceCounter;
+#elif defined(__linux__)
+  typedef std::atomic<uint32_t> SequenceCounter;
+#endif
+  /*!
+   * @brief Generation counter of incomingDataBuffer, see beginWrite()
+   */
+  SequenceCounter sequence;
+
   /*!
    * @brief Advanced users can optionally register a callback function
    *        (for each package) to run after every package is received.
    *        This function is called in the end of decodeCallback function.
    */
   VehicleCallBackHandler userUnpackHandler;
+  /*!
+   * @brief Same as userUnpackHandler, but called with a view of the received
+   *        frame so the payload is not copied. Takes precedence when set.
+   */
+  VehicleViewCallBackHandler userUnpackViewHandler;
 }; // class SubscriptionPackage
 
 /*! @brief Telemetry API through asynchronous "Subscribe"-style messages
@@ -296,6 +327,18 @@ public: // public methods
     int packageID, VehicleCallBack userFunctionAfterPackageExtraction,
     UserData userData = NULL);
 
+  /*!
+   * @brief Same as registerUserPackageUnpackCallback, but the callback gets a
+   *        view of the received frame instead of a RecvContainer copy
+   *
+   * @platforms M210V2, M300
+   * @param packageID
+   * @param userFunctionAfterPackageExtraction
+   */
+  void registerUserPackageUnpackViewCallback(
+    int packageID, VehicleViewCallBack userFunctionAfterPackageExtraction,
+    UserData userData = NULL);
+
   // Not implemented yet
   // bool pausePackage(int packageID);
   // bool resumePackage(int packageID);
@@ -330,47 +373,131 @@ public: // public methods
    * @param header
    * @param subHandle: The pointer to the subscription object.
    */
-  static void decodeCallback(Vehicle* vehiclePtr, RecvContainer rcvContainer,
+  static void decodeCallback(Vehicle* vehiclePtr,
+                             const RecvFrameView& recvFrame,
                              UserData subscriptionPtr);
 
+  /*!
+   * @brief Get the latest value of a subscribed topic.
+   *
+   * @details Lock-free: the decode thread never waits for readers and readers
+   * never wait for each other. A reader racing with the decode thread simply
+   * retries until it copied a complete package generation.
+   *
+   * @platforms M210V2, M300
+   * @return Latest value, or all bytes 0xFF if the topic is not subscribed
+   */
   template <Telemetry::TopicName           topic>
   typename Telemetry::TypeMap<topic>::type getValue()
   {
     typename Telemetry::TypeMap<topic>::type ans;
+    uint32_t seq;
 
-    void* p = Telemetry::TopicDataBase[topic].latest;
-
-    lockMSG();
-    if (p)
+    do
     {
-      ans = *reinterpret_cast<typename Telemetry::TypeMap<topic>::type*>(p);
-      freeMSG();
-      return ans;
-    }
-    else
+      seq = beginRead(topic);
+      if (!readTopic(topic, &ans, sizeof(ans)))
+      {
+        DERROR("Topic 0x%X value memory not initialized, return default",
+               topic);
+        memset(&ans, 0xFF, sizeof(ans));
+        return ans;
+      }
+    } while (!endRead(topic, seq));
+
+    return ans;
+  }
+
+  /*!
+   * @brief Get the latest values of several subscribed topics at once.
+   *
+   * @details All the values are copied from the same generation of their
+   * packages, so topics subscribed in one package are always consistent with
+   * each other, e.g.
+   * @code
+   * auto v = subscribe->getValues<TOPIC_QUATERNION, TOPIC_VELOCITY>();
+   * @endcode
+   * Topics which are not subscribed are filled with 0xFF like getValue().
+   *
+   * @platforms M210V2, M300
+   * @return std::tuple of the values in the order of the template arguments
+   */
+  template <Telemetry::TopicName... topics>
+  std::tuple<typename Telemetry::TypeMap<topics>::type...> getValues()
+  {
+    const Telemetry::TopicName topicList[] = { topics... };
+    const int                  topicNum    = sizeof...(topics);
+    std::tuple<typename Telemetry::TypeMap<topics>::type...> ans;
+    uint32_t seq[sizeof...(topics)];
+    bool     consistent;
+
+    do
     {
-      DERROR("Topic 0x%X value memory not initialized, return default", topic);
-    }
-    freeMSG();
+      for (int i = 0; i < topicNum; i++)
+      {
+        seq[i] = beginRead(topicList[i]);
+      }
+      TopicTupleReader<0, topics...>::read(this, ans);
+      consistent = true;
+      for (int i = 0; i < topicNum; i++)
+      {
+        consistent = endRead(topicList[i], seq[i]) && consistent;
+      }
+    } while (!consistent);
 
-    memset(&ans, 0xFF, sizeof(ans));
     return ans;
   }
 
 public: // public variables
-  const static uint8_t   MAX_NUMBER_OF_PACKAGE = 7;
-  VehicleCallBackHandler subscriptionDataDecodeHandler;
+  const static uint8_t       MAX_NUMBER_OF_PACKAGE = 7;
+  VehicleViewCallBackHandler subscriptionDataDecodeHandler;
 
 private: // private variables
   Vehicle*            vehicle;
   SubscriptionPackage package[MAX_NUMBER_OF_PACKAGE];
 
 private: // private methods
-  void extractOnePackage(RecvContainer*       pRcvContainer,
+  void extractOnePackage(const RecvFrameView& recvFrame,
                          SubscriptionPackage* pkg);
-  T_OsdkMutexHandle m_msgLock;
-  void lockMSG();
-  void freeMSG();
+
+  /*!
+   * @brief Seqlock read side. beginRead() waits for the package holding the
+   * topic to be stable and returns its sequence, endRead() tells whether the
+   * data copied in between is still from that sequence.
+   */
+  uint32_t beginRead(Telemetry::TopicName topic);
+  bool endRead(Telemetry::TopicName topic, uint32_t seq);
+
+  /*!
+   * @brief Copy the latest data of the topic to the buffer.
+   * @return false if the topic has no data buffer.
+   */
+  bool readTopic(Telemetry::TopicName topic, void* buf, size_t size);
+
+  template <int index, Telemetry::TopicName... topics>
+  struct TopicTupleReader
+  {
+    template <typename Tuple>
+    static void read(DataSubscription* sub, Tuple& ans)
+    {
+    }
+  };
+
+  template <int index, Telemetry::TopicName topic,
+            Telemetry::TopicName... rest>
+  struct TopicTupleReader<index, topic, rest...>
+  {
+    template <typename Tuple>
+    static void read(DataSubscription* sub, Tuple& ans)
+    {
+      void* p = &std::get<index>(ans);
+      if (!sub->readTopic(topic, p, sizeof(std::get<index>(ans))))
+      {
+        memset(p, 0xFF, sizeof(std::get<index>(ans)));
+      }
+      TopicTupleReader<index + 1, rest...>::read(sub, ans);
+    }
+  };
 };
 }
 }
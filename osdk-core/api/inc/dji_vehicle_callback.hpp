@@ -29,6 +29,7 @@
 #ifndef DJI_VEHICLECALLBACK_H
 #define DJI_VEHICLECALLBACK_H
 
+#include <cstring>
 #include "dji_ack.hpp"
 #include "dji_log.hpp"
 #include "dji_type.hpp"
@@ -63,6 +64,21 @@ typedef struct RecvContainer
   DJI::OSDK::DispatchInfo   dispatchInfo;
 } RecvContainer;
 
+/*! @brief Read-only view of a received frame
+ *  @details recvInfo carries the decoded header fields (cmd_set, cmd_id,
+ *           seqNumber and len, the package length including the protocol
+ *           overhead). data points at the payload inside the receive buffer
+ *           of the linker, or of the advanced sensing protocol, and is only
+ *           valid until the callback returns. Copy out whatever has to
+ *           outlive the callback.
+ */
+typedef struct RecvFrameView
+{
+  DJI::OSDK::ACK::Entry recvInfo;
+  const uint8_t*        data;
+  size_t                dataLen;
+} RecvFrameView;
+
 
 //! @todo move definition below to class Vehicle
 //! so that we could remove this file
@@ -86,6 +102,42 @@ typedef struct VehicleCallBackHandler
   UserData        userData;
 } VehicleCallBackHandler;
 
+/*! @brief Callback prototype receiving a frame without copying it
+ *
+ * @details Preferred over VehicleCallBack on high rate receive paths, the
+ * frame is not copied into a RecvContainer before the call.
+ *
+ */
+typedef void (*VehicleViewCallBack)(Vehicle*             vehicle,
+                                    const RecvFrameView& recvFrame,
+                                    UserData             userData);
+
+typedef struct VehicleViewCallBackHandler
+{
+  VehicleViewCallBack callback;
+  UserData            userData;
+} VehicleViewCallBackHandler;
+
+/*! @brief Build a RecvContainer from a view, for callers of the by-value
+ *  VehicleCallBack API. The payload is truncated to the size of recvData.
+ */
+inline void
+recvContainerFromView(const RecvFrameView& view, RecvContainer* recvFrame)
+{
+  size_t len = view.dataLen < sizeof(recvFrame->recvData)
+                 ? view.dataLen
+                 : sizeof(recvFrame->recvData);
+
+  memset(recvFrame, 0, sizeof(RecvContainer));
+  recvFrame->recvInfo                = view.recvInfo;
+  recvFrame->dispatchInfo.isAck      = true;
+  recvFrame->dispatchInfo.isCallback = true;
+  if (view.data)
+  {
+    memcpy(recvFrame->recvData.raw_ack_array, view.data, len);
+  }
+}
+
 /*! @brief The CallBackHandler struct allows users to encapsulate callbacks and
  * data in one struct. This is a more common method.
  *
@@ -46,6 +46,16 @@ namespace OSDK
                                      const T_CmdInfo *cmdInfo,
                                      const uint8_t *cmdData, void *userData);
 
+  /*! @brief callback type to report the progress of a mission or action
+   *  upload
+   *
+   *  @platforms M300
+   *  @param done number of waypoints or actions acknowledged so far
+   *  @param total number of waypoints or actions to upload
+   */
+  typedef void (*UploadProgressCallback)(uint16_t done, uint16_t total,
+                                         void *userData);
+
  /*! The waypoint operator is the only object that controls, runs and monitors
   *  Waypoint v2 Missions.
   */
@@ -54,6 +64,10 @@ namespace OSDK
   public:
     const uint16_t MAX_WAYPOINT_NUM_SIGNAL_PUSH = 260;
 
+    /*! Default and max number of upload pushes in flight at once */
+    static const uint8_t DEFAULT_UPLOAD_WINDOW = 4;
+    static const uint8_t MAX_UPLOAD_WINDOW     = 8;
+
     WaypointV2MissionOperator(Vehicle* vehiclePtr);
 
     ~WaypointV2MissionOperator();
@@ -232,7 +246,42 @@ namespace OSDK
     */
     void RegisterMissionStateCallback(void *userData, PushCallback cb = NULL) ;
 
+    /*! @brief Set how many pushes uploadMission and uploadAction keep in
+     *  flight before waiting for their ACKs
+     *
+     *  @platforms M300
+     *  @param windowSize 1 to MAX_UPLOAD_WINDOW, 1 uploads one push per
+     *  round trip
+     */
+    void setUploadWindowSize(uint8_t windowSize);
+
+    /*! @brief Report upload progress of uploadMission and uploadAction
+     *
+     *  @platforms M300
+     *  @param cb callback function, called from the uploading thread.
+     *  NULL to disable
+     *  @param userData passed to cb
+     */
+    void setUploadProgressCallback(UploadProgressCallback cb, void *userData);
+
   private:
+    /*! Encodes the push starting at startIndex, returns true on the last */
+    typedef bool (*ChunkEncoder)(const void *items, uint16_t startIndex,
+                                 uint8_t *pushPtr, uint16_t &len,
+                                 uint16_t &endIndex);
+
+    ErrorCode::ErrorCodeType pipelinedUpload(const uint8_t cmd[],
+                                             ChunkEncoder encoder,
+                                             const void *items,
+                                             uint16_t itemCount,
+                                             bool isMission,
+                                             uint32_t timeoutMs);
+
+    uint8_t                uploadWindow;
+    UploadProgressCallback uploadProgressCb;
+    void                  *uploadProgressUserData;
+    uint8_t                uploadPushBuf[400];
+
     std::vector<WaypointV2> missionV2;
     DJIWaypointV2MissionState currentState;
     DJIWaypointV2MissionState prevState;
@@ -34,27 +34,34 @@ using namespace DJI;
 using namespace DJI::OSDK;
 
 void
-DataBroadcast::unpackCallback(Vehicle* vehicle, RecvContainer recvFrame,
+DataBroadcast::unpackCallback(Vehicle* vehicle, const RecvFrameView& recvFrame,
                               UserData data)
 {
   DataBroadcast* broadcastPtr = (DataBroadcast*)data;
 
   if (broadcastPtr->getVehicle()->isLegacyM600())
   {
-    broadcastPtr->unpackOldM600Data(&recvFrame);
+    broadcastPtr->unpackOldM600Data(recvFrame);
   }
   else if (broadcastPtr->getVehicle()->getFwVersion() != Version::M100_31)
   {
-    broadcastPtr->unpackData(&recvFrame);
+    broadcastPtr->unpackData(recvFrame);
   }
   else
   {
-    broadcastPtr->unpackM100Data(&recvFrame);
+    broadcastPtr->unpackM100Data(recvFrame);
   }
 
-  if (broadcastPtr->userCbHandler.callback)
+  if (broadcastPtr->userViewCbHandler.callback)
   {
-    broadcastPtr->userCbHandler.callback(vehicle, recvFrame,
+    broadcastPtr->userViewCbHandler.callback(
+      vehicle, recvFrame, broadcastPtr->userViewCbHandler.userData);
+  }
+  else if (broadcastPtr->userCbHandler.callback)
+  {
+    RecvContainer recvContainer;
+    recvContainerFromView(recvFrame, &recvContainer);
+    broadcastPtr->userCbHandler.callback(vehicle, recvContainer,
                                          broadcastPtr->userCbHandler.userData);
   }
 }
@@ -64,8 +71,11 @@ DataBroadcast::DataBroadcast(Vehicle* vehiclePtr)
   unpackHandler.callback = unpackCallback;
   unpackHandler.userData = this;
 
-  userCbHandler.callback = 0;
-  userCbHandler.userData = 0;
+  userCbHandler.callback     = 0;
+  userCbHandler.userData     = 0;
+  userViewCbHandler.callback = 0;
+  userViewCbHandler.userData = 0;
+  unpackEnd                  = NULL;
 
   Platform::instance().mutexCreate(&m_msgLock);
   if (vehiclePtr)
@@ -77,6 +87,7 @@ DataBroadcast::DataBroadcast(Vehicle* vehiclePtr)
 DataBroadcast::~DataBroadcast()
 {
   this->setUserBroadcastCallback(0, NULL);
+  this->setUserBroadcastViewCallback(0, NULL);
   unpackHandler.callback = 0;
   unpackHandler.userData = 0;
 }
@@ -422,12 +433,15 @@ DataBroadcast::setBroadcastFreq(uint8_t* dataLenIs16, int timeout)
 }
 
 void
-DataBroadcast::unpackData(RecvContainer* pRecvFrame)
+DataBroadcast::unpackData(const RecvFrameView& recvFrame)
 {
-  uint8_t* pdata = pRecvFrame->recvData.raw_ack_array;
   lockMSG();
-  passFlag = *(uint16_t*)pdata;
-  pdata += sizeof(uint16_t);
+  const uint8_t* pdata = unpackBegin(recvFrame);
+  if (!pdata)
+  {
+    freeMSG();
+    return;
+  }
   // clang-format off
   unpackOne(FLAG_TIME        ,&timeStamp ,pdata,sizeof(timeStamp ));
   unpackOne(FLAG_TIME        ,&syncStamp ,pdata,sizeof(syncStamp ));
@@ -452,12 +466,15 @@ DataBroadcast::unpackData(RecvContainer* pRecvFrame)
 }
 
 void
-DataBroadcast::unpackM100Data(RecvContainer* pRecvFrame)
+DataBroadcast::unpackM100Data(const RecvFrameView& recvFrame)
 {
-  uint8_t* pdata = pRecvFrame->recvData.raw_ack_array;
   lockMSG();
-  passFlag = *(uint16_t*)pdata;
-  pdata += sizeof(uint16_t);
+  const uint8_t* pdata = unpackBegin(recvFrame);
+  if (!pdata)
+  {
+    freeMSG();
+    return;
+  }
   // clang-format off
   unpackOne(FLAG_TIME        ,&legacyTimeStamp   ,pdata,sizeof(legacyTimeStamp ));
   unpackOne(FLAG_QUATERNION  ,&q                 ,pdata,sizeof(q               ));
@@ -476,12 +493,15 @@ DataBroadcast::unpackM100Data(RecvContainer* pRecvFrame)
 }
 
 void
-DataBroadcast::unpackOldM600Data(RecvContainer* pRecvFrame)
+DataBroadcast::unpackOldM600Data(const RecvFrameView& recvFrame)
 {
-  uint8_t* pdata = pRecvFrame->recvData.raw_ack_array;
   lockMSG();
-  passFlag = *(uint16_t*)pdata;
-  pdata += sizeof(uint16_t);
+  const uint8_t* pdata = unpackBegin(recvFrame);
+  if (!pdata)
+  {
+    freeMSG();
+    return;
+  }
   // clang-format off
   unpackOne(FLAG_TIME        ,&legacyTimeStamp   ,pdata,sizeof(legacyTimeStamp ));
   unpackOne(FLAG_QUATERNION  ,&q                 ,pdata,sizeof(q               ));
@@ -501,13 +521,25 @@ DataBroadcast::unpackOldM600Data(RecvContainer* pRecvFrame)
   freeMSG();
 }
 
+const uint8_t*
+DataBroadcast::unpackBegin(const RecvFrameView& recvFrame)
+{
+  if (!recvFrame.data || recvFrame.dataLen < sizeof(uint16_t))
+  {
+    return NULL;
+  }
+  memcpy(&passFlag, recvFrame.data, sizeof(uint16_t));
+  unpackEnd = recvFrame.data + recvFrame.dataLen;
+  return recvFrame.data + sizeof(uint16_t);
+}
+
 void
-DataBroadcast::unpackOne(DataBroadcast::FLAG flag, void* data, uint8_t*& buf,
-                         size_t size)
+DataBroadcast::unpackOne(DataBroadcast::FLAG flag, void* data,
+                         const uint8_t*& buf, size_t size)
 {
-  if (flag & passFlag)
+  if ((flag & passFlag) && (buf + size <= unpackEnd))
   {
-    memcpy((uint8_t*)data, (uint8_t*)buf, size);
+    memcpy((uint8_t*)data, buf, size);
     buf += size;
   }
 }
@@ -661,6 +693,14 @@ DataBroadcast::setUserBroadcastCallback(VehicleCallBack callback,
   userCbHandler.userData = userData;
 }
 
+void
+DataBroadcast::setUserBroadcastViewCallback(VehicleViewCallBack callback,
+                                            UserData            userData)
+{
+  userViewCbHandler.callback = callback;
+  userViewCbHandler.userData = userData;
+}
+
 uint16_t
 DataBroadcast::getPassFlag()
 {
@@ -1190,6 +1190,14 @@ ErrorCode::ErrorCodeType CameraManager::startReqFileList(PayloadIndexType index,
   return ret;
 }
 
+ErrorCode::ErrorCodeType CameraManager::startReqFileListStream(PayloadIndexType index, const FileMgr::FileListFilter &filter, FileMgr::FileListBatchCBType cb, void *userData) {
+  ErrorCode::ErrorCodeType ret;
+  ret = fileMgr->startReqFileListStream(OSDK_COMMAND_DEVICE_TYPE_CAMERA,
+                                        PAYLOAD_INDEX_TO_DEVICE_ID(index),
+                                        filter, cb, userData);
+  return ret;
+}
+
 ErrorCode::ErrorCodeType CameraManager::startReqFileData(PayloadIndexType index, int fileIndex, std::string localPath, FileMgr::FileDataReqCBType cb, void *userData) {
   ErrorCode::ErrorCodeType ret;
   ret = fileMgr->startReqFileData(OSDK_COMMAND_DEVICE_TYPE_CAMERA,
@@ -1197,4 +1205,48 @@ ErrorCode::ErrorCodeType CameraManager::startReqFileData(PayloadIndexType index,
                                   fileIndex, localPath, cb, userData);
   return ret;
 }
+
+ErrorCode::ErrorCodeType CameraManager::startResumeFileData(PayloadIndexType index, int fileIndex, std::string localPath, FileMgr::FileDataReqCBType cb, void *userData) {
+  ErrorCode::ErrorCodeType ret;
+  ret = fileMgr->startResumeFileData(OSDK_COMMAND_DEVICE_TYPE_CAMERA,
+                                     PAYLOAD_INDEX_TO_DEVICE_ID(index),
+                                     fileIndex, localPath, cb, userData);
+  return ret;
+}
+
+ErrorCode::ErrorCodeType CameraManager::startBatchDownload(
+    const std::vector<MediaDownloadJob> &jobs, FileMgr::BatchFileCBType fileCb,
+    FileMgr::BatchProgressCBType progressCb, void *userData) {
+  ErrorCode::ErrorCodeType ret;
+  std::vector<FileMgr::DownloadJob> fileJobs;
+  bool prepared[PAYLOAD_INDEX_CNT] = {false};
+
+  if (fileMgr->isBatchDownloading())
+    return ErrorCode::CameraCommonErr::InvalidState;
+
+  for (auto &job : jobs) {
+    if (job.index >= PAYLOAD_INDEX_CNT)
+      return ErrorCode::SysCommonErr::InstInitParamInvalid;
+    if (!prepared[job.index]) {
+      ret = setModeSync(job.index, CameraModule::WorkMode::PLAYBACK, 2);
+      if (ret != ErrorCode::SysCommonErr::Success) return ret;
+      ret = obtainDownloadRightSync(job.index, true, 2);
+      if (ret != ErrorCode::SysCommonErr::Success) return ret;
+      prepared[job.index] = true;
+    }
+
+    FileMgr::DownloadJob fileJob;
+    fileJob.type = OSDK_COMMAND_DEVICE_TYPE_CAMERA;
+    fileJob.index = PAYLOAD_INDEX_TO_DEVICE_ID(job.index);
+    fileJob.fileIndex = job.fileIndex;
+    fileJob.localPath = job.localPath;
+    fileJobs.push_back(fileJob);
+  }
+
+  return fileMgr->startBatchDownload(fileJobs, fileCb, progressCb, userData);
+}
+
+void CameraManager::cancelBatchDownload() {
+  fileMgr->cancelBatchDownload();
+}
 #endif
@@ -43,13 +43,6 @@ using namespace DJI;
 using namespace DJI::OSDK;
 using namespace DJI::OSDK::Telemetry;
 
-namespace DJI{
-    namespace OSDK{
-        extern HMSErrCodeInfo hmsErrCodeInfoTbl[dbHMSErrNum];
-        extern bool replaceStr(string &str, const string oldReplaceStr, const string newReplaceStr);
-    }
-}
-
 /*! @brief Compare HMS's pushing error code with the error code in the error code table,
 * and print the prompt message.
 *
@@ -63,11 +56,6 @@ namespace DJI{
 */
 static bool MarchErrCodeInfoTbl(DJIHMSImpl * djiHMSImpl, HMSPushData *hmsPushData);
 
-/*! In hmsErrCodeInfoTbl's alarmInfo,we need to replace some identified str with real data.
- *  for example, %alarmid <-> 0x1a010040 , %index <-> 1, %component_index <-> 1*/
-static void replaceHMSIdentifyStr(string &alarmInfo, uint32_t alarmId, uint8_t sensorIndex,
-                                  uint8_t componentIndex);
-
 static E_OsdkStat HMSRecvDataCallBack(struct _CommandHandle *cmdHandle,
                                       const T_CmdInfo *cmdInfo,
                                       const uint8_t *cmdData, void *userData);
@@ -200,64 +188,41 @@ static bool MarchErrCodeInfoTbl(DJIHMSImpl *djiHMSImpl, HMSPushData *hmsPushData
         return false;
     }
 
+    /*! reused by every alarm of this push, the table's templates are never modified */
+    char alarmInfo[hmsAlarmInfoMaxLen];
+    bool inAir = (djiHMSImpl->vehicle->subscribe->getValue<TOPIC_STATUS_FLIGHT>() ==
+                  VehicleStatus::FlightStatus::IN_AIR);
+    uint8_t deviceIndex = djiHMSImpl->getDeviceIndex();
+    uint32_t timeStamp = djiHMSImpl->getHMSPushPacket().timeStamp;
+
     for (int i = 0; i < hmsPushData->errList.size(); i++)
     {
-        for (int j = 0; j < sizeof(DJI::OSDK::hmsErrCodeInfoTbl) / sizeof(HMSErrCodeInfo); j++)
+        const HMSErrCodeInfo *errCodeInfo = findHMSErrCodeInfo(hmsPushData->errList[i].alarmID);
+        if (!errCodeInfo)
         {
-            if (hmsPushData->errList[i].alarmID == DJI::OSDK::hmsErrCodeInfoTbl[j].alarmId)
-            {
-                switch (djiHMSImpl->vehicle->subscribe->getValue<TOPIC_STATUS_FLIGHT>())
-                {
-                    case VehicleStatus::FlightStatus::IN_AIR:
-                    {
-                        if (DJI::OSDK::hmsErrCodeInfoTbl[j].flyAlarmInfo != "")
-                        {
-                            replaceHMSIdentifyStr(DJI::OSDK::hmsErrCodeInfoTbl[j].flyAlarmInfo,
-                                                  hmsPushData->errList[i].alarmID,
-                                                  hmsPushData->errList[i].sensorIndex,
-                                                  djiHMSImpl->getDeviceIndex());
-                            DSTATUS("TimeStamp: %u.Info: %s", djiHMSImpl->getHMSPushPacket().timeStamp,
-                                    DJI::OSDK::hmsErrCodeInfoTbl[j].flyAlarmInfo.c_str());
-                        }
-                        break;
-                    }
-                    default:
-                    {
-                        if (DJI::OSDK::hmsErrCodeInfoTbl[j].groundAlarmInfo != "")
-                        {
-                            replaceHMSIdentifyStr(DJI::OSDK::hmsErrCodeInfoTbl[j].groundAlarmInfo,
-                                                  hmsPushData->errList[i].alarmID,
-                                                  hmsPushData->errList[i].sensorIndex,
-                                                  djiHMSImpl->getDeviceIndex());
-                            DSTATUS("TimeStamp: %u.Info:%s",djiHMSImpl->getHMSPushPacket().timeStamp,
-                                    DJI::OSDK::hmsErrCodeInfoTbl[j].groundAlarmInfo.c_str());
-                        }
-                        break;
-                    }
-                }
-            }
+            continue;
+        }
+
+        const char *alarmInfoTemplate = inAir ? errCodeInfo->flyAlarmInfo
+                                              : errCodeInfo->groundAlarmInfo;
+        if (alarmInfoTemplate[0] == '\0')
+        {
+            continue;
+        }
+
+        formatHMSAlarmInfo(alarmInfo, sizeof(alarmInfo), alarmInfoTemplate,
+                           hmsPushData->errList[i].alarmID,
+                           hmsPushData->errList[i].sensorIndex,
+                           deviceIndex);
+        if (inAir)
+        {
+            DSTATUS("TimeStamp: %u.Info: %s", timeStamp, alarmInfo);
+        }
+        else
+        {
+            DSTATUS("TimeStamp: %u.Info:%s", timeStamp, alarmInfo);
         }
     }
 
     return true;
 }
-
-static void replaceHMSIdentifyStr(string & alarmInfo, uint32_t alarmId, uint8_t sensorIndex,
-                                  uint8_t componentIndex)
-{
-    const string oldReplaceAlarmIdStr        = "%alarmid";
-    const string oldReplaceIndexStr          = "%index";
-    const string oldReplaceComponentIndexStr = "%component_index";
-
-    string newReplaceAlarmIdStr;
-    string newReplaceIndexStr ;
-    string newReplaceComponentIndexStr;
-
-    sprintf((char *)newReplaceAlarmIdStr.data(), "0x%08X" , alarmId);
-    sprintf((char *)newReplaceIndexStr.data(), "%d" , sensorIndex);
-    sprintf((char *)newReplaceComponentIndexStr.data(), "%d" ,componentIndex);
-
-    DJI::OSDK::replaceStr(alarmInfo, oldReplaceAlarmIdStr,newReplaceAlarmIdStr.data());
-    DJI::OSDK::replaceStr(alarmInfo, oldReplaceIndexStr,newReplaceIndexStr.data());
-    DJI::OSDK::replaceStr(alarmInfo, oldReplaceComponentIndexStr, newReplaceComponentIndexStr.data());
-}
\ No newline at end of file
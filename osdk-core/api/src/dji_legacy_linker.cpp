@@ -31,6 +31,7 @@
 #include "dji_linker.hpp"
 #include "osdk_device_id.h"
 #include "dji_internal_command.hpp"
+#include "dji_async_context_pool.hpp"
 
 #define MAX_PARAMETER_VALUE_LENGTH 8
 
@@ -45,6 +46,8 @@ typedef struct legacyAdaptingData {
   VehicleCallBack cb;
   UserData udata;
   Vehicle *vehicle;
+  VehicleViewCallBack viewCb;
+  bool releaseUserData;
 } legacyAdaptingData;
 
 typedef struct CmdListData {
@@ -67,8 +70,9 @@ void *LegacyLinker::legacyX5SEnableTask(void *arg) {
     cmdInfo.addr = GEN_ADDR(0, ADDR_V1_COMMAND_INDEX);
     cmdInfo.receiver = 0x00;
     cmdInfo.sender = linker->getLocalSenderId();
+    PeriodicTimer enableTimer(500 * 1000);
     for(;;) {
-      OsdkOsal_TaskSleepMs(500);
+      enableTimer.wait();
       if (linker->isUSBPlugged()) linker->send(&cmdInfo, (uint8_t *) &data);
     }
   } else {
@@ -107,25 +111,24 @@ CmdListData cmdListData[] = {
 //@clang-format: on
 
 
-RecvContainer recvFrameAdapting(const T_CmdInfo &cmdInfo, const uint8_t *cmdData)
+RecvFrameView recvFrameViewAdapting(const T_CmdInfo &cmdInfo,
+                                    const uint8_t *cmdData)
 {
-  RecvContainer recvFrame = {0};
-
-  recvFrame.dispatchInfo.isAck = true;
-  recvFrame.recvInfo.cmd_set = cmdInfo.cmdSet;
-  recvFrame.recvInfo.cmd_id = cmdInfo.cmdId;
-  if(cmdData) {
-    memcpy(recvFrame.recvData.raw_ack_array, cmdData, cmdInfo.dataLen);
-    recvFrame.recvInfo.len = cmdInfo.dataLen + OpenProtocol::PackageMin;
+  RecvFrameView view = {};
+
+  view.recvInfo.cmd_set = cmdInfo.cmdSet;
+  view.recvInfo.cmd_id = cmdInfo.cmdId;
+  view.recvInfo.seqNumber = cmdInfo.seqNum;
+  view.recvInfo.buf = (uint8_t *) cmdData;
+  if (cmdData) {
+    view.recvInfo.len = cmdInfo.dataLen + OpenProtocol::PackageMin;
+    view.data = cmdData;
+    view.dataLen = cmdInfo.dataLen;
   } else {
-    recvFrame.recvInfo.len = OpenProtocol::PackageMin;
+    view.recvInfo.len = OpenProtocol::PackageMin;
   }
-  recvFrame.dispatchInfo.isCallback = true;
-  recvFrame.dispatchInfo.callbackID = 0; //only valid in before OSDK 4.0
-  recvFrame.recvInfo.buf = (uint8_t *) cmdData;
-  recvFrame.recvInfo.seqNumber = cmdInfo.seqNum;
 
-  return recvFrame;
+  return view;
 }
 
 E_OsdkStat legacyAdaptingRegisterCB(
@@ -134,8 +137,13 @@ E_OsdkStat legacyAdaptingRegisterCB(
     const uint8_t *cmdData, void *userData) {
   legacyAdaptingData *legacyData = (legacyAdaptingData *)userData;
   if (cmdInfo && legacyData && legacyData->vehicle) {
-    if (legacyData->cb) {
-      RecvContainer recvFrame = recvFrameAdapting(*cmdInfo, cmdData);
+    if (legacyData->viewCb) {
+      RecvFrameView view = recvFrameViewAdapting(*cmdInfo, cmdData);
+      legacyData->viewCb(legacyData->vehicle, view, legacyData->udata);
+    } else if (legacyData->cb) {
+      RecvContainer recvFrame;
+      recvContainerFromView(recvFrameViewAdapting(*cmdInfo, cmdData),
+                            &recvFrame);
       legacyData->cb(legacyData->vehicle, recvFrame, legacyData->udata);
     }
     return OSDK_STAT_OK;
@@ -146,7 +154,7 @@ E_OsdkStat legacyAdaptingRegisterCB(
 }
 
 void *LegacyLinker::decodeAck(E_OsdkStat ret, uint8_t cmdSet, uint8_t cmdId,
-                              RecvContainer recvFrame)
+                              const RecvContainer &recvFrame)
 {
   void* pACK;
 
@@ -257,7 +265,7 @@ void *LegacyLinker::decodeAck(E_OsdkStat ret, uint8_t cmdSet, uint8_t cmdId,
     if (memcmp(cmd, OpenProtocolCMD::CMDSet::Control::extendedFunction,
                sizeof(cmd)) == 0) {
       extendedFunctionRspAck.info = recvFrame.recvInfo;
-      extendedFunctionRspAck.info.buf = recvFrame.recvData.raw_ack_array;
+      extendedFunctionRspAck.info.buf = (uint8_t *) recvFrame.recvData.raw_ack_array;
       extendedFunctionRspAck.updated = true;
       pACK = static_cast<void*>(&this->extendedFunctionRspAck);
     }
@@ -346,15 +354,16 @@ void LegacyLinker::send(const uint8_t cmd[], void *pdata, size_t len) {
 void legacyAdaptingAsyncCB(const T_CmdInfo *cmdInfo,
                                          const uint8_t *cmdData,
                                          void *userData, E_OsdkStat cb_type) {
+  legacyAdaptingData *para = (legacyAdaptingData *) userData;
+
   if (cb_type == OSDK_STAT_OK) {
-    if ((!cmdInfo) && (!userData) && (!((legacyAdaptingData *) (userData))->cb)
-        && (!((legacyAdaptingData *) (userData))->vehicle)) {
+    if ((!cmdInfo) || (!para) || (!para->cb) || (!para->vehicle)) {
       DERROR("Parameter invalid.");
     } else {
-      legacyAdaptingData para = *(legacyAdaptingData *) userData;
-
-      RecvContainer recvFrame = recvFrameAdapting(*cmdInfo, cmdData);
-      para.cb(para.vehicle, recvFrame, para.udata);
+      RecvContainer recvFrame;
+      recvContainerFromView(recvFrameViewAdapting(*cmdInfo, cmdData),
+                            &recvFrame);
+      para->cb(para->vehicle, recvFrame, para->udata);
     }
   } else if (cb_type == OSDK_STAT_ERR_TIMEOUT) {
     DERROR("wait for callback time out.");
@@ -362,12 +371,16 @@ void legacyAdaptingAsyncCB(const T_CmdInfo *cmdInfo,
     DERROR("wait for callback error.");
   }
 
-  free(userData);
+  if (para && para->releaseUserData) {
+    AsyncContextPool::instance().release(para->udata);
+  }
+  AsyncContextPool::instance().release(para);
 }
 
 void LegacyLinker::sendAsync(const uint8_t cmd[], void *pdata, size_t len,
                              int timeout, int retry_time,
-                             VehicleCallBack callback, UserData userData) {
+                             VehicleCallBack callback, UserData userData,
+                             bool releaseUserData) {
   T_CmdInfo cmdInfo = {0};
 
   cmdInfo.cmdSet = cmd[0];
@@ -378,9 +391,9 @@ void LegacyLinker::sendAsync(const uint8_t cmd[], void *pdata, size_t len,
   cmdInfo.addr = GEN_ADDR(0, ADDR_SDK_COMMAND_INDEX);
   cmdInfo.encType = (vehicle->getEncryption() == true) ? 1 : 0;
   cmdInfo.channelId = 0;
-  legacyAdaptingData
-      *udata = (legacyAdaptingData *) malloc(sizeof(legacyAdaptingData));
-  *udata = {callback, userData, vehicle};
+  legacyAdaptingData *udata =
+      AsyncContextPool::instance().alloc<legacyAdaptingData>();
+  *udata = {callback, userData, vehicle, NULL, releaseUserData};
 
   vehicle->linker->sendAsync(&cmdInfo, (uint8_t *) pdata, legacyAdaptingAsyncCB,
                              udata, timeout, retry_time);
@@ -409,7 +422,8 @@ void* LegacyLinker::sendSync(const uint8_t cmd[], void *pdata,
   E_OsdkStat ret =
       vehicle->linker->sendSync(&cmdInfo, (uint8_t *) pdata, &ackInfo, ackData,
                                 timeout, retry_time);
-  RecvContainer recvFrame = recvFrameAdapting(ackInfo, ackData);
+  RecvContainer recvFrame;
+  recvContainerFromView(recvFrameViewAdapting(ackInfo, ackData), &recvFrame);
 
   return decodeAck(ret, ackInfo.cmdSet, ackInfo.cmdId, recvFrame);
 }
@@ -417,11 +431,25 @@ void* LegacyLinker::sendSync(const uint8_t cmd[], void *pdata,
 bool LegacyLinker::registerCMDCallback(uint8_t cmdSet, uint8_t cmdID,
                                        VehicleCallBack &callback,
                                        UserData &userData) {
+  return registerAdaptingCallback(cmdSet, cmdID, callback, NULL, userData);
+}
+
+bool LegacyLinker::registerCMDCallback(uint8_t cmdSet, uint8_t cmdID,
+                                       VehicleViewCallBack callback,
+                                       UserData userData) {
+  return registerAdaptingCallback(cmdSet, cmdID, NULL, callback, userData);
+}
+
+bool LegacyLinker::registerAdaptingCallback(uint8_t cmdSet, uint8_t cmdID,
+                                            VehicleCallBack callback,
+                                            VehicleViewCallBack viewCallback,
+                                            UserData userData) {
   for (int i = 0; i < sizeof(cmdListData) / sizeof(CmdListData); i++) {
     if ((cmdListData[i].cmdItemList.cmdSet == cmdSet)
         && (cmdListData[i].cmdItemList.cmdId == cmdID)) {
       legacyAdaptingData *handler = (legacyAdaptingData *)(cmdListData[i].cmdItemList.userData);
       handler->cb = callback;
+      handler->viewCb = viewCallback;
       handler->udata = userData;
       handler->vehicle = vehicle;
       cmdListData[i].cmdItemList.pFunc = legacyAdaptingRegisterCB;
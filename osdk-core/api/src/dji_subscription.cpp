@@ -106,7 +106,6 @@ DataSubscription::DataSubscription(Vehicle* vehiclePtr)
 
   subscriptionDataDecodeHandler.callback = decodeCallback;
   subscriptionDataDecodeHandler.userData = this;
-  Platform::instance().mutexCreate(&m_msgLock);
 }
 
 DataSubscription::~DataSubscription()
@@ -128,13 +127,20 @@ DataSubscription::getVehicle()
  * subscription.
  */
 void
-DataSubscription::decodeCallback(Vehicle*      vehiclePtr,
-                                 RecvContainer rcvContainer, UserData subPtr)
+DataSubscription::decodeCallback(Vehicle*             vehiclePtr,
+                                 const RecvFrameView& recvFrame,
+                                 UserData             subPtr)
 {
   DataSubscription* subscriptionHandle = (DataSubscription*)subPtr;
 
+  if (!recvFrame.data || recvFrame.dataLen < 1)
+  {
+    DERROR("Empty subscription package received.");
+    return;
+  }
+
   // uint8_t pkgID = *(((uint8_t *)header) + sizeof(OpenHeader) + 2);
-  uint8_t pkgID = rcvContainer.recvData.subscribeACK;
+  uint8_t pkgID = recvFrame.data[0];
 
   if (pkgID >= MAX_NUMBER_OF_PACKAGE)
   {
@@ -149,11 +155,20 @@ DataSubscription::decodeCallback(Vehicle*      vehiclePtr,
    * when the program starts,
    */
 
-  subscriptionHandle->extractOnePackage(&rcvContainer, p);
+  subscriptionHandle->extractOnePackage(recvFrame, p);
+
+  VehicleViewCallBackHandler vh = p->getUnpackViewHandler();
+  if (NULL != vh.callback)
+  {
+    (*(vh.callback))(vehiclePtr, recvFrame, vh.userData);
+    return;
+  }
 
   VehicleCallBackHandler h = p->getUnpackHandler();
   if (NULL != h.callback)
   {
+    RecvContainer rcvContainer;
+    recvContainerFromView(recvFrame, &rcvContainer);
     (*(h.callback))(vehiclePtr, rcvContainer, h.userData);
   }
 }
@@ -186,6 +201,15 @@ DataSubscription::registerUserPackageUnpackCallback(
                                            userData);
 }
 
+void
+DataSubscription::registerUserPackageUnpackViewCallback(
+  int packageID, VehicleViewCallBack userFunctionAfterPackageExtraction,
+  UserData userData)
+{
+  package[packageID].setUserUnpackViewCallback(
+    userFunctionAfterPackageExtraction, userData);
+}
+
 //bool
 //DataSubscription::pausePackage(int packageID)
 //{
@@ -364,7 +388,7 @@ DataSubscription::startPackage(int packageID, int timeout)
 
 // adapted from DataSubscribe::Package::unpack
 void
-DataSubscription::extractOnePackage(RecvContainer*       pRcvContainer,
+DataSubscription::extractOnePackage(const RecvFrameView& recvFrame,
                                     SubscriptionPackage* pkg)
 {
   //  uint8_t *data = ((uint8_t *)header) + sizeof(OpenHeader) + 2;
@@ -374,18 +398,24 @@ DataSubscription::extractOnePackage(RecvContainer*       pRcvContainer,
   //          *((uint32_t *)data), *((uint32_t *)data + 1));
   //  data++;
 
-  uint8_t* data = pRcvContainer->recvData.raw_ack_array;
+  const uint8_t* data = recvFrame.data;
+  size_t         len  = recvFrame.dataLen - 1;
   data++; // skip the package ID
 
   /*
    * TODO: Handle the time stamp field if it exists
    */
 
-  lockMSG();
   if (pkg->getDataBuffer())
   {
-    // TODO: the length needs to come from the header, not package
-    memcpy(pkg->getDataBuffer(), data, pkg->getBufferSize());
+    // Copy straight from the receive buffer, never past the end of the frame
+    if (len > pkg->getBufferSize())
+    {
+      len = pkg->getBufferSize();
+    }
+    pkg->beginWrite();
+    memcpy(pkg->getDataBuffer(), data, len);
+    pkg->endWrite();
     // memcpy(pkg->getDataBuffer(), data, header->length - CoreAPI::PackageMin -
     // 3);
   }
@@ -399,7 +429,6 @@ DataSubscription::extractOnePackage(RecvContainer*       pRcvContainer,
       DDEBUG("This was due to unclean quit of the program without restarting the drone.\n");
     }
   }
-  freeMSG();
 }
 
 void
@@ -558,14 +587,51 @@ DataSubscription::reset(int timeout)
   return ack;
 }
 
-void
-DataSubscription::lockMSG() {
-  Platform::instance().mutexLock(m_msgLock);
+uint32_t
+DataSubscription::beginRead(TopicName topic)
+{
+  uint8_t pkgID = TopicDataBase[topic].pkgID;
+  if (pkgID >= MAX_NUMBER_OF_PACKAGE)
+  {
+    return 0;
+  }
+
+  uint32_t seq = package[pkgID].getSequence();
+  while (seq & 1)
+  {
+    // The decode thread is in the middle of a copy, let it finish
+    Platform::instance().taskSleepMs(0);
+    seq = package[pkgID].getSequence();
+  }
+  return seq;
 }
 
-void
-DataSubscription::freeMSG() {
-  Platform::instance().mutexUnlock(m_msgLock);
+bool
+DataSubscription::endRead(TopicName topic, uint32_t seq)
+{
+  uint8_t pkgID = TopicDataBase[topic].pkgID;
+  if (pkgID >= MAX_NUMBER_OF_PACKAGE)
+  {
+    return true;
+  }
+
+#if defined(__linux__)
+  std::atomic_thread_fence(std::memory_order_acquire);
+#endif
+  return package[pkgID].getSequence() == seq;
+}
+
+bool
+DataSubscription::readTopic(TopicName topic, void* buf, size_t size)
+{
+  uint8_t* p = TopicDataBase[topic].latest;
+  if (!p)
+  {
+    return false;
+  }
+
+  memcpy(buf, p, size);
+  return true;
 }
 
 //////////////////////
@@ -574,9 +640,12 @@ SubscriptionPackage::SubscriptionPackage()
   , leftOverDataFlag(false)
   , incomingDataBuffer(NULL)
   , packageDataSize(0)
+  , sequence(0)
 {
-  userUnpackHandler.callback = NULL;
-  userUnpackHandler.userData = NULL;
+  userUnpackHandler.callback     = NULL;
+  userUnpackHandler.userData     = NULL;
+  userUnpackViewHandler.callback = NULL;
+  userUnpackViewHandler.userData = NULL;
 }
 
 SubscriptionPackage::~SubscriptionPackage()
@@ -693,9 +762,11 @@ SubscriptionPackage::cleanUpPackage()
   memset(topicList, 0xFF, sizeof(topicList));
   memset(offsetList, 0, sizeof(offsetList));
 
-  packageDataSize            = 0;
-  userUnpackHandler.callback = NULL;
-  userUnpackHandler.userData = NULL;
+  packageDataSize                = 0;
+  userUnpackHandler.callback     = NULL;
+  userUnpackHandler.userData     = NULL;
+  userUnpackViewHandler.callback = NULL;
+  userUnpackViewHandler.userData = NULL;
   clearDataBuffer();
 }
 
@@ -730,6 +801,14 @@ SubscriptionPackage::setUserUnpackCallback(
   userUnpackHandler.userData = userData;
 }
 
+void
+SubscriptionPackage::setUserUnpackViewCallback(
+  VehicleViewCallBack userFunctionAfterPackageExtraction, UserData userData)
+{
+  userUnpackViewHandler.callback = userFunctionAfterPackageExtraction;
+  userUnpackViewHandler.userData = userData;
+}
+
 SubscriptionPackage::PackageInfo
 SubscriptionPackage::getInfo()
 {
@@ -772,6 +851,57 @@ SubscriptionPackage::getUnpackHandler()
   return userUnpackHandler;
 }
 
+VehicleViewCallBackHandler
+SubscriptionPackage::getUnpackViewHandler()
+{
+  return userUnpackViewHandler;
+}
+
+#if STM32
+void
+SubscriptionPackage::beginWrite()
+{
+  sequence = sequence + 1;
+  __asm volatile("" ::: "memory");
+}
+
+void
+SubscriptionPackage::endWrite()
+{
+  __asm volatile("" ::: "memory");
+  sequence = sequence + 1;
+}
+
+uint32_t
+SubscriptionPackage::getSequence()
+{
+  uint32_t seq = sequence;
+  __asm volatile("" ::: "memory");
+  return seq;
+}
+#elif defined(__linux__)
+void
+SubscriptionPackage::beginWrite()
+{
+  sequence.store(sequence.load(std::memory_order_relaxed) + 1,
+                 std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void
+SubscriptionPackage::endWrite()
+{
+  sequence.store(sequence.load(std::memory_order_relaxed) + 1,
+                 std::memory_order_release);
+}
+
+uint32_t
+SubscriptionPackage::getSequence()
+{
+  return sequence.load(std::memory_order_acquire);
+}
+#endif
+
 void
 SubscriptionPackage::packageAddSuccessHandler()
 {
@@ -32,6 +32,7 @@
 #include "dji_linker.hpp"
 #include "osdk_firewall.hpp"
 #include "dji_internal_command.hpp"
+#include "dji_async_context_pool.hpp"
 #include <new>
 
 using namespace DJI;
@@ -105,6 +106,12 @@ Vehicle::Vehicle(Linker* linker)
 bool
 Vehicle::init()
 {
+  /*! Before any module can send an asynchronous request */
+  if (!AsyncContextPool::instance().init())
+  {
+    DERROR("Failed to set up the async context pool, using the heap.\n");
+  }
+
   if (!initOSDKHeartBeatThread())
   {
     DERROR("Failed to initialize OSDKHeartBeatThread!\n");
@@ -838,7 +845,15 @@ Vehicle::processAdvancedSensingImgs(RecvContainer* receivedFrame)
 {
   if (receivedFrame->recvInfo.cmd_id == AdvancedSensingProtocol::PROCESS_IMG_CMD_ID)
   {
-    if (this->advancedSensing->stereoHandler.callback)
+    if (this->advancedSensing->stereoViewHandler.callback)
+    {
+      RecvFrameView view = {receivedFrame->recvInfo,
+                            (const uint8_t*)receivedFrame->recvData.stereoImgData,
+                            sizeof(ACK::StereoImgData)};
+      this->advancedSensing->stereoViewHandler.callback(
+          this, view, this->advancedSensing->stereoViewHandler.userData);
+    }
+    else if (this->advancedSensing->stereoHandler.callback)
     {
       this->advancedSensing->stereoHandler.callback(
           this, *receivedFrame, this->advancedSensing->stereoHandler.userData);
@@ -858,7 +873,15 @@ Vehicle::processAdvancedSensingImgs(RecvContainer* receivedFrame)
   else if (receivedFrame->recvInfo.cmd_id ==
            AdvancedSensingProtocol::PROCESS_VGA_CMD_ID)
   {
-    if (this->advancedSensing->vgaHandler.callback)
+    if (this->advancedSensing->vgaViewHandler.callback)
+    {
+      RecvFrameView view = {receivedFrame->recvInfo,
+                            (const uint8_t*)receivedFrame->recvData.stereoVGAImgData,
+                            sizeof(ACK::StereoVGAImgData)};
+      this->advancedSensing->vgaViewHandler.callback(
+          this, view, this->advancedSensing->vgaViewHandler.userData);
+    }
+    else if (this->advancedSensing->vgaHandler.callback)
     {
       this->advancedSensing->vgaHandler.callback(this, *receivedFrame,
                                                  this->advancedSensing->vgaHandler.userData);
@@ -1576,21 +1599,13 @@ Vehicle::sendHeartbeatToFCTask(void *arg) {
     DSTATUS("OSDK send heart beat to fc task created.");
     if(arg) {
       Linker *linker = (Linker *) arg;
-      static uint32_t preHeartBeatTimeStamp = 0;
-      static uint32_t curHeartBeatTimeStamp = 0;
+      PeriodicTimer heartBeatTimer(kHeartBeatPackSendTimeInterval * 1000);
       for (;;)
       {
-          OsdkOsal_GetTimeMs(&curHeartBeatTimeStamp);
-          if (curHeartBeatTimeStamp - preHeartBeatTimeStamp >=  kHeartBeatPackSendTimeInterval)
-          {
-            if (linker->isUartPlugged()) {
-              DJI::OSDK::Vehicle::sendHeartbeatToFCFunc(linker);
-            }
-              preHeartBeatTimeStamp = curHeartBeatTimeStamp;
+          heartBeatTimer.wait();
+          if (linker->isUartPlugged()) {
+            DJI::OSDK::Vehicle::sendHeartbeatToFCFunc(linker);
           }
-
-          /*! TODO: with out sleep 100ms, the time will get the same as last time. */
-          OsdkOsal_TaskSleepMs(100);
       }
     } else {
       DERROR("Osdk send heart beat to fc task run failed because of the invalid linker "
@@ -33,6 +33,7 @@
 #include "memory.h"
 #include "dji_internal_command.hpp"
 #include <math.h>
+#include <algorithm>
 using namespace DJI;
 using namespace DJI::OSDK;
 
@@ -75,18 +76,17 @@ void elementDecode(Type &data, uint8_t *&tempPtr) {
   tempPtr += sizeof(Type);
 }
 
-bool missionEncode(const std::vector<WaypointV2Internal> &mission, uint8_t *pushPtr,
-                   uint16_t &len) {
+bool missionEncode(const std::vector<WaypointV2Internal> &mission,
+                   uint16_t startIndex, uint8_t *pushPtr, uint16_t &len,
+                   uint16_t &endIndex) {
   if (mission.empty()) {
-    pushPtr = nullptr;
     len = 0;
+    endIndex = 0;
     return true;
   }
 
   bool finished = false;
   uint16_t tempTotalLen = 0;
-  static uint16_t startIndex = 0;
-  uint16_t endIndex = 0;
   uint8_t *tempPtr = pushPtr;
 
   /*! {{startIndex, endIndex, waypoint1, waypoint2,...},{startIndex, endIndex,
@@ -130,12 +130,10 @@ bool missionEncode(const std::vector<WaypointV2Internal> &mission, uint8_t *push
   }
   len = tempTotalLen;
   endIndex = i - 1;
-  startIndex = endIndex + 1;
   memcpy(tempTempPtr, &endIndex, sizeof(endIndex));
-  DSTATUS("mis_upload_start_index:%d, mis_upload_end_index:%d, upload_len:%d",*pushPtr, *(pushPtr + 2), len);
+  DSTATUS("mis_upload_start_index:%d, mis_upload_end_index:%d, upload_len:%d",
+          startIndex, endIndex, len);
   if (endIndex >= mission.size() - 1) {
-    startIndex = 0;
-    endIndex = 0;
     finished = true;
   }
   return finished;
@@ -350,14 +348,14 @@ void triggerEncode(const DJIWaypointV2Trigger &trigger, uint16_t &tempTotalLen,
   }
 }
 
-bool ActionsEncode(std::vector<DJIWaypointV2Action> &actions,
-                   uint8_t *pushPtr, uint16_t &len) {
+bool ActionsEncode(const std::vector<DJIWaypointV2Action> &actions,
+                   uint16_t startIndex, uint8_t *pushPtr, uint16_t &len,
+                   uint16_t &endIndex) {
   uint16_t i;
   bool finished = false;
   uint16_t tempTotalLen = 0;
   uint8_t *tempPtr = pushPtr;
 
-  static uint16_t startIndex = 0;
   for (i = startIndex; (i < actions.size()) && (tempTotalLen < 100); ++i) {
     DJIWaypointV2Action action = actions[i];
 
@@ -374,14 +372,110 @@ bool ActionsEncode(std::vector<DJIWaypointV2Action> &actions,
     DSTATUS("upload_action_ID:%d",action.actionId);
   }
   DSTATUS("total_len:%d",len);
-  startIndex = i;
-  if (startIndex > actions.size() - 1) {
+  endIndex = i - 1;
+  if (i > actions.size() - 1) {
     finished = true;
-    startIndex = 0;
   }
   return finished;
 }
 
+bool missionChunkEncode(const void *items, uint16_t startIndex,
+                        uint8_t *pushPtr, uint16_t &len, uint16_t &endIndex) {
+  return missionEncode(*(const std::vector<WaypointV2Internal> *)items,
+                       startIndex, pushPtr, len, endIndex);
+}
+
+bool actionsChunkEncode(const void *items, uint16_t startIndex,
+                        uint8_t *pushPtr, uint16_t &len, uint16_t &endIndex) {
+  return ActionsEncode(*(const std::vector<DJIWaypointV2Action> *)items,
+                       startIndex, pushPtr, len, endIndex);
+}
+
+/*! Book keeping of a pipelined upload. It is shared between the uploading
+ *  thread and the linker ACK callbacks, and freed by whoever drops the last
+ *  reference, so an upload that gives up early never leaves a callback
+ *  pointing at freed memory.
+ */
+struct UploadSession;
+
+typedef enum UploadChunkState {
+  UPLOAD_CHUNK_IN_FLIGHT,
+  UPLOAD_CHUNK_ACKED,
+  UPLOAD_CHUNK_FAILED,
+  UPLOAD_CHUNK_RETRY,
+  UPLOAD_CHUNK_DONE,
+} UploadChunkState;
+
+typedef struct UploadChunk {
+  UploadSession *session;
+  uint16_t startIndex;
+  uint16_t endIndex;
+  uint8_t state;
+  uint8_t retries;
+  uint32_t result;
+  E_OsdkStat linkStat;
+} UploadChunk;
+
+struct UploadSession {
+  T_OsdkMutexHandle mutex;
+  T_OsdkSemHandle sem;
+  int refs;
+  bool isMission;
+  /*! Reserved up front to the item count so chunk addresses stay valid */
+  std::vector<UploadChunk> chunks;
+};
+
+const uint8_t UPLOAD_CHUNK_MAX_RETRY = 2;
+
+void releaseUploadSession(UploadSession *session) {
+  OsdkOsal_MutexLock(session->mutex);
+  bool last = (--session->refs == 0);
+  OsdkOsal_MutexUnlock(session->mutex);
+  if (last) {
+    OsdkOsal_SemaphoreDestroy(session->sem);
+    OsdkOsal_MutexDestroy(session->mutex);
+    delete session;
+  }
+}
+
+void uploadAckCB(const T_CmdInfo *cmdInfo, const uint8_t *cmdData,
+                 void *userData, E_OsdkStat cb_type) {
+  auto *chunk = (UploadChunk *)userData;
+  UploadSession *session = chunk->session;
+
+  OsdkOsal_MutexLock(session->mutex);
+  chunk->linkStat = cb_type;
+  chunk->state = UPLOAD_CHUNK_FAILED;
+  if (cb_type == OSDK_STAT_OK && cmdInfo && cmdData &&
+      cmdInfo->dataLen >= sizeof(RetCodeType)) {
+    /*! A short ACK only carries the return code */
+    if (cmdInfo->dataLen >= sizeof(chunk->result)) {
+      memcpy(&chunk->result, cmdData, sizeof(chunk->result));
+    } else {
+      RetCodeType retCode;
+      memcpy(&retCode, cmdData, sizeof(retCode));
+      chunk->result = retCode;
+    }
+    chunk->state = UPLOAD_CHUNK_ACKED;
+    if (chunk->result == 0 && session->isMission &&
+        cmdInfo->dataLen >= sizeof(UploadMissionRawAck)) {
+      UploadMissionRawAck ack;
+      memcpy(&ack, cmdData, sizeof(ack));
+      if (ack.startIndex != chunk->startIndex ||
+          ack.endIndex != chunk->endIndex) {
+        DERROR("Upload ACK for [%d, %d] while waiting for [%d, %d]",
+               ack.startIndex, ack.endIndex, chunk->startIndex,
+               chunk->endIndex);
+        chunk->state = UPLOAD_CHUNK_FAILED;
+      }
+    }
+  }
+  OsdkOsal_SemaphorePost(session->sem);
+  OsdkOsal_MutexUnlock(session->mutex);
+
+  releaseUploadSession(session);
+}
+
 T_CmdInfo setCmdInfoDefault(Vehicle *vehicle, const uint8_t cmd[],
                             uint16_t len) {
   T_CmdInfo cmdInfo = {0};
@@ -474,6 +568,9 @@ void WaypointV2MissionOperator::RegisterOSDInfoCallback(Vehicle *vehiclePtr) {
 
 WaypointV2MissionOperator::WaypointV2MissionOperator(Vehicle *vehiclePtr) {
   this->vehiclePtr = vehiclePtr;
+  uploadWindow = DEFAULT_UPLOAD_WINDOW;
+  uploadProgressCb = NULL;
+  uploadProgressUserData = NULL;
   takeoffAltitude = INVALID_TAKOFF_ALTITUDE;
   currentState = DJIWaypointV2MissionStateUnWaypointActionActuatorknown;
   prevState = DJIWaypointV2MissionStateUnWaypointActionActuatorknown;
@@ -564,44 +661,149 @@ ErrorCode::ErrorCodeType WaypointV2MissionOperator::downloadInitSetting(WayPoint
   }
 }
 
-ErrorCode::ErrorCodeType WaypointV2MissionOperator::uploadMission(
-  int timeout) {
-  std::vector<WaypointV2Internal> mission = transformMission2MisssionInternal(this->missionV2);
+void WaypointV2MissionOperator::setUploadWindowSize(uint8_t windowSize) {
+  if (windowSize == 0) windowSize = 1;
+  if (windowSize > MAX_UPLOAD_WINDOW) windowSize = MAX_UPLOAD_WINDOW;
+  uploadWindow = windowSize;
+}
 
-  uint16_t dataLengthSinglePush = 0;
-  bool finished = false;
-  while (!finished) {
-    void *waypointPushPtr = malloc(400);
-    finished = missionEncode(mission, (uint8_t *) waypointPushPtr,
-                             dataLengthSinglePush);
-    T_CmdInfo ackInfo = {0};
-    RetCodeType ackData[1024] = {0};
+void WaypointV2MissionOperator::setUploadProgressCallback(
+    UploadProgressCallback cb, void *userData) {
+  uploadProgressCb = cb;
+  uploadProgressUserData = userData;
+}
 
-    T_CmdInfo cmdInfo =
-      setCmdInfoDefault(vehiclePtr, V1ProtocolCMD::waypointV2::waypointUploadV2,
-                        dataLengthSinglePush);
+/*! Keeps up to uploadWindow pushes in flight. Each push is encoded into
+ *  uploadPushBuf right before it is sent, the linker keeps its own copy for
+ *  retries. Pushes that time out or come back with a mismatched range are
+ *  re-encoded and re-sent on their own, a non-zero result from the flight
+ *  controller aborts the upload as before.
+ */
+ErrorCode::ErrorCodeType WaypointV2MissionOperator::pipelinedUpload(
+    const uint8_t cmd[], ChunkEncoder encoder, const void *items,
+    uint16_t itemCount, bool isMission, uint32_t timeoutMs) {
+  auto *session = new UploadSession();
+  if (OsdkOsal_MutexCreate(&session->mutex) != OSDK_STAT_OK) {
+    delete session;
+    return ErrorCode::SysCommonErr::AllocMemoryFailed;
+  }
+  if (OsdkOsal_SemaphoreCreate(&session->sem, 0) != OSDK_STAT_OK) {
+    OsdkOsal_MutexDestroy(session->mutex);
+    delete session;
+    return ErrorCode::SysCommonErr::AllocMemoryFailed;
+  }
+  session->refs = 1;
+  session->isMission = isMission;
+  session->chunks.reserve(itemCount);
+
+  ErrorCode::ErrorCodeType ret = ErrorCode::SysCommonErr::Success;
+  uint16_t nextStart = 0;
+  bool encodedAll = false;
+  size_t firstOpen = 0;
+  uint8_t inFlight = 0;
+  uint16_t done = 0;
+  /*! Covers the linker's own 4 tries on the slowest push in the window */
+  uint32_t waitMs = timeoutMs * 5;
+
+  while (ret == ErrorCode::SysCommonErr::Success) {
+    /*! Collect what the ACK callbacks reported */
+    bool progressed = false;
+    OsdkOsal_MutexLock(session->mutex);
+    for (size_t i = firstOpen; i < session->chunks.size(); ++i) {
+      UploadChunk &chunk = session->chunks[i];
+      if (chunk.state == UPLOAD_CHUNK_ACKED) {
+        inFlight--;
+        if (chunk.result != 0) {
+          ret = ErrorCode::getErrorCode(ErrorCode::MissionV2Module,
+                                        ErrorCode::MissionV2Common,
+                                        chunk.result);
+        }
+        chunk.state = UPLOAD_CHUNK_DONE;
+        /*! An empty list still goes out as one push covering [0, 0] */
+        done = std::min<uint32_t>(done + chunk.endIndex - chunk.startIndex + 1,
+                                  itemCount);
+        progressed = true;
+      } else if (chunk.state == UPLOAD_CHUNK_FAILED) {
+        inFlight--;
+        if (chunk.retries++ < UPLOAD_CHUNK_MAX_RETRY) {
+          DSTATUS("Retransmit upload push [%d, %d]", chunk.startIndex,
+                  chunk.endIndex);
+          chunk.state = UPLOAD_CHUNK_RETRY;
+        } else if (chunk.linkStat != OSDK_STAT_OK) {
+          ret = getWP2LinkerErrorCode(chunk.linkStat);
+        } else {
+          ret = ErrorCode::SysCommonErr::UnpackDataMismatch;
+        }
+      }
+    }
+    while (firstOpen < session->chunks.size() &&
+           session->chunks[firstOpen].state == UPLOAD_CHUNK_DONE) {
+      firstOpen++;
+    }
+    OsdkOsal_MutexUnlock(session->mutex);
+
+    if (ret != ErrorCode::SysCommonErr::Success) break;
+    if (progressed && uploadProgressCb)
+      uploadProgressCb(done, itemCount, uploadProgressUserData);
+    if (encodedAll && firstOpen == session->chunks.size()) break;
+
+    /*! Refill the window, failed ranges first */
+    size_t retryIdx = firstOpen;
+    while (inFlight < uploadWindow) {
+      UploadChunk *chunk = NULL;
+      for (; retryIdx < session->chunks.size(); ++retryIdx) {
+        if (session->chunks[retryIdx].state == UPLOAD_CHUNK_RETRY) {
+          chunk = &session->chunks[retryIdx++];
+          break;
+        }
+      }
 
-    E_OsdkStat linkAck =
-      vehiclePtr->linker->sendSync(&cmdInfo, (uint8_t *)waypointPushPtr, &ackInfo,
-                                   ackData, timeout * 1000, 4);
-    ErrorCode::ErrorCodeType ret = getWP2LinkerErrorCode(linkAck);
-    free(waypointPushPtr);
+      uint16_t len = 0;
+      if (chunk) {
+        uint16_t endIndex = 0;
+        encoder(items, chunk->startIndex, uploadPushBuf, len, endIndex);
+      } else if (!encodedAll) {
+        UploadChunk newChunk = {};
+        newChunk.session = session;
+        newChunk.startIndex = nextStart;
+        encodedAll = encoder(items, nextStart, uploadPushBuf, len,
+                             newChunk.endIndex);
+        nextStart = newChunk.endIndex + 1;
+        OsdkOsal_MutexLock(session->mutex);
+        session->chunks.push_back(newChunk);
+        chunk = &session->chunks.back();
+        OsdkOsal_MutexUnlock(session->mutex);
+      } else {
+        break;
+      }
 
-    if (ret != ErrorCode::SysCommonErr::Success) {
-      return ret;
+      OsdkOsal_MutexLock(session->mutex);
+      chunk->state = UPLOAD_CHUNK_IN_FLIGHT;
+      session->refs++;
+      OsdkOsal_MutexUnlock(session->mutex);
+      inFlight++;
+
+      T_CmdInfo cmdInfo = setCmdInfoDefault(vehiclePtr, cmd, len);
+      vehiclePtr->linker->sendAsync(&cmdInfo, uploadPushBuf, uploadAckCB,
+                                    chunk, timeoutMs, 4);
     }
-    if (ackInfo.dataLen >= sizeof(RetCodeType)) {
-      auto *ackCode = (UploadMissionRawAck *)ackData;
-      // DSTATUS("mis_upload_result:%d,mis_ack_start_index:%d, mis_ack_end_index:%d",ackCode->result,ackCode->startIndex,ackCode->endIndex);
-      if (ackCode->result != 0)
-        return ErrorCode::getErrorCode(ErrorCode::MissionV2Module,
-                                       ErrorCode::MissionV2Common,
-                                       ackCode->result);
-    } else {
-      return ErrorCode::SysCommonErr::UnpackDataMismatch;
+
+    if (OsdkOsal_SemaphoreTimedWait(session->sem, waitMs) != OSDK_STAT_OK) {
+      ret = ErrorCode::SysCommonErr::ReqTimeout;
     }
   }
-  return ErrorCode::SysCommonErr::Success;
+
+  releaseUploadSession(session);
+  return ret;
+}
+
+ErrorCode::ErrorCodeType WaypointV2MissionOperator::uploadMission(
+  int timeout) {
+  std::vector<WaypointV2Internal> mission = transformMission2MisssionInternal(this->missionV2);
+
+  return pipelinedUpload(V1ProtocolCMD::waypointV2::waypointUploadV2,
+                         missionChunkEncode, &mission, mission.size(), true,
+                         timeout * 1000);
 }
 
 ErrorCode::ErrorCodeType WaypointV2MissionOperator::downloadMission(
@@ -687,39 +889,11 @@ ErrorCode::ErrorCodeType WaypointV2MissionOperator::uploadAction(
   std::vector<DJIWaypointV2Action> &actions, int timeout) {
   if (actions.size() == 0) {
     DERROR("Action number is zero, please reset actions vector");
-  } else {
-    bool finished = false;
-    E_OsdkStat linkAck;
-    while (!finished) {
-      uint16_t dataLen = 0;
-      void *actionsPushPtr = malloc(400);
-      T_CmdInfo ackInfo = {0};
-      RetCodeType ackData[1024];
-
-      finished = ActionsEncode(actions, (uint8_t *) actionsPushPtr, dataLen);
-      T_CmdInfo cmdInfo = setCmdInfoDefault(
-          vehiclePtr, V1ProtocolCMD::waypointV2::waypointUploadActionV2, dataLen);
-
-      linkAck = vehiclePtr->linker->sendSync(&cmdInfo, (uint8_t *)actionsPushPtr, &ackInfo,
-                                 ackData, timeout * 1000 / 4, 4);
-      free(actionsPushPtr);
-      ErrorCode::ErrorCodeType ret = getWP2LinkerErrorCode(linkAck);
-
-      if (ret != ErrorCode::SysCommonErr::Success) {
-        return ret;
-      }
-      if (ackInfo.dataLen >= sizeof(RetCodeType)) {
-        auto *ackCode = (UploadActionsRawAck *)ackData;
-        if (ackCode->result != 0)
-          return ErrorCode::getErrorCode(ErrorCode::MissionV2Module,
-                                         ErrorCode::MissionV2Common,
-                                         ackCode->result);
-      } else {
-        return ErrorCode::SysCommonErr::UnpackDataMismatch;
-      }
-    }
+    return ErrorCode::SysCommonErr::Success;
   }
-  return ErrorCode::SysCommonErr::Success;
+  return pipelinedUpload(V1ProtocolCMD::waypointV2::waypointUploadActionV2,
+                         actionsChunkEncode, &actions, actions.size(), false,
+                         timeout * 1000 / 4);
 }
 
 ErrorCode::ErrorCodeType WaypointV2MissionOperator::getActionRemainMemory(
@@ -48,6 +48,16 @@
     .title((_title_), #_title_)                            \
     .print
 
+/*! @brief Channels above this level are compiled out, their arguments are
+ *  still type checked. 0: none, 1: error, 2: + status, 3: + debug
+ */
+#ifndef DJI_LOG_LEVEL
+#define DJI_LOG_LEVEL 3
+#endif
+
+#define DLOG_ELIDED(_title_) while (0) DLOG(_title_)
+#define DLOG_PRIVATE_ELIDED(_title_) while (0) DLOG_PRIVATE(_title_)
+
 #define STATUS DJI::OSDK::Log::instance().getStatusLogState()
 #define ERRORLOG DJI::OSDK::Log::instance().getErrorLogState()
 #define DEBUG DJI::OSDK::Log::instance().getDebugLogState()
@@ -56,22 +66,37 @@
  *  @details Users can use methods in the DJI::OSDK::Log class to
  *  enable/disable this logging channel
  */
+#if DJI_LOG_LEVEL >= 2
 #define DSTATUS DLOG(STATUS)
 #define DSTATUS_PRIVATE DLOG_PRIVATE(STATUS)
+#else
+#define DSTATUS DLOG_ELIDED(STATUS)
+#define DSTATUS_PRIVATE DLOG_PRIVATE_ELIDED(STATUS)
+#endif
 
 /*! @brief Global Logging macro for error messages
  *  @details Users can use methods in the DJI::OSDK::Log class to
  *  enable/disable this logging channel
  */
+#if DJI_LOG_LEVEL >= 1
 #define DERROR DLOG(ERRORLOG)
 #define DERROR_PRIVATE DLOG_PRIVATE(ERRORLOG)
+#else
+#define DERROR DLOG_ELIDED(ERRORLOG)
+#define DERROR_PRIVATE DLOG_PRIVATE_ELIDED(ERRORLOG)
+#endif
 
 /*! @brief Global Logging macro for debug messages
  *  @details Users can use methods in the DJI::OSDK::Log class to
  *  enable/disable this logging channel
  */
+#if DJI_LOG_LEVEL >= 3
 #define DDEBUG DLOG(DEBUG)
 #define DDEBUG_PRIVATE DLOG_PRIVATE(DEBUG)
+#else
+#define DDEBUG DLOG_ELIDED(DEBUG)
+#define DDEBUG_PRIVATE DLOG_PRIVATE_ELIDED(DEBUG)
+#endif
 
 namespace DJI
 {
@@ -138,6 +163,35 @@ public:
    */
   void disableErrorLogging();
 
+  /*!
+   * @brief Hand console/file output to a background thread
+   * @details Each logging thread then only copies its lines into its own
+   * lock-free ring. Lines are dropped and counted when a ring is full.
+   * Only available on Linux.
+   * @return false if the background thread could not be started
+   */
+  bool enableAsyncLogging();
+
+  /*!
+   * @brief Write out all queued lines and go back to synchronous output
+   */
+  void disableAsyncLogging();
+
+  /*!
+   * @brief Log to a file instead of the console. Only available on Linux.
+   * @param path file to append to
+   * @param maxFileSize rotate when the file grows beyond this many bytes,
+   * 0 for no rotation
+   * @param maxFileNum number of rotated files kept as path.1 ... path.N
+   */
+  bool setLogFile(const char* path, uint32_t maxFileSize = 0,
+                  uint32_t maxFileNum = 0);
+
+  /*!
+   * @brief Number of lines dropped because a logging thread's ring was full
+   */
+  uint64_t getDroppedLogCount();
+
   // Retrieve logging switches - used for global macros
   bool getStatusLogState();
   bool getDebugLogState();
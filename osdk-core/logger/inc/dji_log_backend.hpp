@@ -0,0 +1,161 @@
+/** @file dji_log_backend.hpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Asynchronous output backend of DJI::OSDK::Log, lines are queued in
+ *  per-thread lock-free rings and written by a background thread.
+ *
+ *  @Copyright (c) 2016-2017 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef DJI_LOG_BACKEND_H
+#define DJI_LOG_BACKEND_H
+
+#ifdef __linux__
+
+#include <atomic>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+
+namespace DJI
+{
+namespace OSDK
+{
+
+/*! @brief Background writer for log lines
+ *
+ * @details Every producing thread owns a single-producer/single-consumer
+ * byte ring, so pushing a line never takes a lock or touches the terminal.
+ * A drainer thread collects the rings in batches and writes them to stdout
+ * or to a size-rotated file. When a ring is full the line is dropped and
+ * counted, the drainer then reports how many lines were lost.
+ *
+ * Every line is stamped from one global counter and the drainer merges the
+ * rings by it, so a line printed after another one was queued, in any
+ * thread, comes out after it. Lines queued by several threads at the same
+ * time may come out in either order.
+ */
+class LogBackend
+{
+public:
+  static LogBackend& instance();
+
+  /*! Start the drainer thread, lines are queued from now on */
+  bool start();
+
+  /*! Stop the drainer thread, waiting for the pushes in progress, and
+   *  drain everything queued */
+  void stop();
+
+  bool isRunning() const
+  {
+    return running.load(std::memory_order_acquire);
+  }
+
+  /*! @brief Write to path instead of stdout
+   *  @param maxFileSize rotate when the file grows beyond this many bytes,
+   *  0 for no rotation
+   *  @param maxFileNum keep path.1 ... path.maxFileNum as old files
+   */
+  bool setFileSink(const char* path, uint32_t maxFileSize, uint32_t maxFileNum);
+  void setConsoleSink();
+
+  /*! Synchronous write to the current sink, used while not running */
+  void writeDirect(const char* line, uint32_t len);
+
+  /*! @brief Queue one formatted line from the calling thread
+   *  @return false if the backend is not running, the caller then writes the
+   *  line with writeDirect(). A line dropped because its ring is full only
+   *  counts in getDroppedCount().
+   */
+  bool push(const char* line, uint32_t len);
+
+  uint64_t getDroppedCount() const
+  {
+    return droppedCount.load(std::memory_order_relaxed);
+  }
+
+  //! bytes of each per-thread ring, must be a power of 2
+  static const uint32_t RING_SIZE = 16384;
+
+private:
+  typedef struct Ring
+  {
+    char                  buf[RING_SIZE];
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> tail;
+    std::atomic<bool>     orphaned;
+    Ring*                 next;
+    //! drainer only, the head of the batch and the tail reached in it
+    uint32_t batchHead;
+    uint32_t batchTail;
+  } Ring;
+
+  /*! Marks the owning thread's ring orphaned when the thread exits */
+  typedef struct RingOwner
+  {
+    Ring* ring;
+    ~RingOwner();
+  } RingOwner;
+
+  LogBackend();
+
+  Ring* threadRing();
+  bool  drainOnce();
+  bool  peekRecord(Ring* ring, uint64_t limit, uint64_t& seq);
+  void  queueLine(Ring* ring, const char* line, uint32_t len);
+  void  reapOrphans();
+  void  write(const char* data, uint32_t len);
+  void  rotateFile();
+  static void* drainTask(void* arg);
+
+  static thread_local RingOwner ringOwner;
+
+  std::atomic<Ring*>    rings;
+  std::atomic<bool>     running;
+  std::atomic<uint32_t> pushing; //!< push() calls in progress
+  std::atomic<uint64_t> nextSeq;
+  std::atomic<uint64_t> droppedCount;
+  uint64_t              reportedDropped;
+
+  /*! Sink state, only touched by the drainer or under sinkMutex */
+  pthread_mutex_t sinkMutex;
+  FILE*           file;
+  char            filePath[256];
+  uint32_t        fileSize;
+  uint32_t        maxFileSize;
+  uint32_t        maxFileNum;
+
+  /*! Only used to sleep and wake up the drainer */
+  pthread_t       drainThread;
+  pthread_mutex_t waitMutex;
+  pthread_cond_t  waitCond;
+};
+
+} // namespace OSDK
+} // namespace DJI
+
+#endif // __linux__
+
+#endif // DJI_LOG_BACKEND_H
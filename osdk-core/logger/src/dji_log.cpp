@@ -28,6 +28,7 @@
  */
 
 #include "dji_log.hpp"
+#include "dji_log_backend.hpp"
 
 #include <stdarg.h>
 #include <stdio.h>
@@ -35,6 +36,55 @@
 
 using namespace DJI::OSDK;
 
+#ifdef __linux__
+/*! A line is built per thread from title() and print() and written out in
+ *  one piece, so lines of different threads no longer interleave.
+ */
+typedef struct LogLine
+{
+  char     buf[512];
+  uint32_t len;
+  bool     valid;
+} LogLine;
+
+static thread_local LogLine logLine = {{0}, 0, false};
+
+static void
+setLogLineTitle(int level, int len)
+{
+  logLine.valid = (level != 0);
+  if (len < 0)
+  {
+    len = 0;
+  }
+  logLine.len = ((uint32_t)len < sizeof(logLine.buf)) ? (uint32_t)len
+                                                      : sizeof(logLine.buf) - 1;
+}
+
+static void
+writeLogLine(const char* fmt, va_list args)
+{
+  uint32_t room = sizeof(logLine.buf) - logLine.len - 1;
+  int      len  = vsnprintf(logLine.buf + logLine.len, room + 1, fmt, args);
+  if (len > 0)
+  {
+    logLine.len += ((uint32_t)len < room) ? (uint32_t)len : room;
+  }
+  if (logLine.len == 0 || logLine.buf[logLine.len - 1] != '\n')
+  {
+    logLine.buf[logLine.len++] = '\n';
+  }
+
+  LogBackend& backend = LogBackend::instance();
+  if (!backend.push(logLine.buf, logLine.len))
+  {
+    backend.writeDirect(logLine.buf, logLine.len);
+  }
+  /* further print() calls of this title go out without the header */
+  logLine.len = 0;
+}
+#endif
+
 Log::Log(Mutex* m)
 {
   if (m)
@@ -62,6 +112,17 @@ Log::title(int level, const char* prefix, const char* func, int line)
     initFlag = true;
   }
 
+#ifdef __linux__
+  int len = 0;
+  if (level)
+  {
+    uint32_t timeMs = 0;
+    OsdkOsal_GetTimeMs(&timeMs);
+    len = snprintf(logLine.buf, sizeof(logLine.buf), "[%d.%03d]%s/%d @ %s, L%d: ",
+                   timeMs / 1000, timeMs % 1000, prefix, level, func, line);
+  }
+  setLogLineTitle(level, len);
+#else
   if (level)
   {
     vaild = true;
@@ -75,6 +136,7 @@ Log::title(int level, const char* prefix, const char* func, int line)
   {
     vaild = false;
   }
+#endif
   return *this;
 }
 
@@ -88,6 +150,14 @@ Log::title(int level, const char* prefix)
     initFlag = true;
   }
 
+#ifdef __linux__
+  int len = 0;
+  if (level)
+  {
+    len = snprintf(logLine.buf, sizeof(logLine.buf), "%s/%d", prefix, level);
+  }
+  setLogLineTitle(level, len);
+#else
   if (level)
   {
     vaild = true;
@@ -99,6 +169,7 @@ Log::title(int level, const char* prefix)
   {
     vaild = false;
   }
+#endif
   return *this;
 }
 
@@ -111,6 +182,16 @@ Log::print()
 Log&
 Log::print(const char* fmt, ...)
 {
+#ifdef __linux__
+  if ((!release) && logLine.valid)
+  {
+    va_list args;
+    va_start(args, fmt);
+    writeLogLine(fmt, args);
+    va_end(args);
+  }
+  return *this;
+#else
   char log[300] = {0};
 
   if(!initFlag)
@@ -131,11 +212,9 @@ Log::print(const char* fmt, ...)
       printf("%s", log);
     };
     mutex->unlock();
-#if defined(__linux__)
-    fflush(stdout);
-#endif
   }
   return *this;
+#endif
 }
 
 Log&
@@ -279,6 +358,46 @@ Log::operator<<(uint8_t c)
   return *this;
 }
 
+// Asynchronous output
+
+bool
+Log::enableAsyncLogging()
+{
+#ifdef __linux__
+  return LogBackend::instance().start();
+#else
+  return false;
+#endif
+}
+
+void
+Log::disableAsyncLogging()
+{
+#ifdef __linux__
+  LogBackend::instance().stop();
+#endif
+}
+
+bool
+Log::setLogFile(const char* path, uint32_t maxFileSize, uint32_t maxFileNum)
+{
+#ifdef __linux__
+  return LogBackend::instance().setFileSink(path, maxFileSize, maxFileNum);
+#else
+  return false;
+#endif
+}
+
+uint64_t
+Log::getDroppedLogCount()
+{
+#ifdef __linux__
+  return LogBackend::instance().getDroppedCount();
+#else
+  return 0;
+#endif
+}
+
 // Various Toggles
 
 void
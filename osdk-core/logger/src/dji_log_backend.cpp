@@ -0,0 +1,469 @@
+/** @file dji_log_backend.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Asynchronous output backend of DJI::OSDK::Log, lines are queued in
+ *  per-thread lock-free rings and written by a background thread.
+ *
+ *  @Copyright (c) 2016-2017 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "dji_log_backend.hpp"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <new>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+using namespace DJI::OSDK;
+
+//! record length which tells the drainer to wrap to the ring start
+#define LOG_RING_PAD_MARK 0xFFFFFFFFu
+#define LOG_RING_ALIGN(len) (((len) + 3u) & ~3u)
+//! a record is its length, its stamp and the line
+#define LOG_RECORD_HEADER (sizeof(uint32_t) + sizeof(uint64_t))
+#define LOG_DRAIN_IDLE_MS 10
+
+thread_local LogBackend::RingOwner LogBackend::ringOwner = {NULL};
+
+LogBackend::RingOwner::~RingOwner()
+{
+  if (ring)
+  {
+    ring->orphaned.store(true, std::memory_order_release);
+    ring = NULL;
+  }
+}
+
+static void
+stopAtExit()
+{
+  LogBackend::instance().stop();
+}
+
+LogBackend&
+LogBackend::instance()
+{
+  static LogBackend backend;
+  return backend;
+}
+
+LogBackend::LogBackend()
+  : rings(NULL)
+  , running(false)
+  , pushing(0)
+  , nextSeq(0)
+  , droppedCount(0)
+  , reportedDropped(0)
+  , file(NULL)
+  , fileSize(0)
+  , maxFileSize(0)
+  , maxFileNum(0)
+{
+  filePath[0] = '\0';
+  pthread_mutex_init(&sinkMutex, NULL);
+  pthread_mutex_init(&waitMutex, NULL);
+  pthread_cond_init(&waitCond, NULL);
+}
+
+bool
+LogBackend::start()
+{
+  static bool atExitRegistered = false;
+
+  if (running.exchange(true))
+  {
+    return true;
+  }
+  if (pthread_create(&drainThread, NULL, drainTask, this) != 0)
+  {
+    running.store(false);
+    return false;
+  }
+  if (!atExitRegistered)
+  {
+    atExitRegistered = (atexit(stopAtExit) == 0);
+  }
+  return true;
+}
+
+void
+LogBackend::stop()
+{
+  if (!running.exchange(false))
+  {
+    return;
+  }
+  pthread_mutex_lock(&waitMutex);
+  pthread_cond_signal(&waitCond);
+  pthread_mutex_unlock(&waitMutex);
+  pthread_join(drainThread, NULL);
+
+  /* a push which saw the backend running may still be queueing its line,
+   * drain once more after it, which also frees the rings of exited threads */
+  while (pushing.load(std::memory_order_acquire))
+  {
+    sched_yield();
+  }
+  drainOnce();
+}
+
+bool
+LogBackend::setFileSink(const char* path, uint32_t maxFileSize,
+                        uint32_t maxFileNum)
+{
+  if (!path || strlen(path) >= sizeof(filePath))
+  {
+    return false;
+  }
+  FILE* newFile = fopen(path, "a");
+  if (!newFile)
+  {
+    return false;
+  }
+
+  pthread_mutex_lock(&sinkMutex);
+  if (file)
+  {
+    fclose(file);
+  }
+  file = newFile;
+  strcpy(filePath, path);
+  fseek(file, 0, SEEK_END);
+  long size         = ftell(file);
+  fileSize          = (size > 0) ? (uint32_t)size : 0;
+  this->maxFileSize = maxFileSize;
+  this->maxFileNum  = maxFileNum;
+  pthread_mutex_unlock(&sinkMutex);
+  return true;
+}
+
+void
+LogBackend::setConsoleSink()
+{
+  pthread_mutex_lock(&sinkMutex);
+  if (file)
+  {
+    fclose(file);
+    file = NULL;
+  }
+  pthread_mutex_unlock(&sinkMutex);
+}
+
+void
+LogBackend::writeDirect(const char* line, uint32_t len)
+{
+  pthread_mutex_lock(&sinkMutex);
+  write(line, len);
+  fflush(file ? file : stdout);
+  pthread_mutex_unlock(&sinkMutex);
+}
+
+LogBackend::Ring*
+LogBackend::threadRing()
+{
+  if (!ringOwner.ring)
+  {
+    Ring* ring = new (std::nothrow) Ring;
+    if (!ring)
+    {
+      return NULL;
+    }
+    ring->head.store(0, std::memory_order_relaxed);
+    ring->tail.store(0, std::memory_order_relaxed);
+    ring->orphaned.store(false, std::memory_order_relaxed);
+    ring->next = rings.load(std::memory_order_relaxed);
+    while (!rings.compare_exchange_weak(ring->next, ring,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed))
+    {
+    }
+    ringOwner.ring = ring;
+  }
+  return ringOwner.ring;
+}
+
+bool
+LogBackend::push(const char* line, uint32_t len)
+{
+  /* stop() clears running and then waits for pushing to drop to 0, so
+   * either it waits for this push or this push sees it stopped */
+  pushing.fetch_add(1, std::memory_order_seq_cst);
+  if (!running.load(std::memory_order_seq_cst))
+  {
+    pushing.fetch_sub(1, std::memory_order_release);
+    return false;
+  }
+
+  Ring* ring = threadRing();
+  if (ring)
+  {
+    queueLine(ring, line, len);
+  }
+  else
+  {
+    droppedCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  pushing.fetch_sub(1, std::memory_order_release);
+  return true;
+}
+
+void
+LogBackend::queueLine(Ring* ring, const char* line, uint32_t len)
+{
+  if (len > RING_SIZE / 4)
+  {
+    len = RING_SIZE / 4;
+  }
+
+  uint32_t need   = LOG_RING_ALIGN(LOG_RECORD_HEADER + len);
+  uint32_t h      = ring->head.load(std::memory_order_relaxed);
+  uint32_t t      = ring->tail.load(std::memory_order_acquire);
+  uint32_t offset = h & (RING_SIZE - 1);
+  /* records never wrap, the tail of the ring is skipped instead */
+  uint32_t pad    = (RING_SIZE - offset < need) ? RING_SIZE - offset : 0;
+
+  if (pad + need > RING_SIZE - (h - t))
+  {
+    droppedCount.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  if (pad)
+  {
+    uint32_t mark = LOG_RING_PAD_MARK;
+    memcpy(ring->buf + offset, &mark, sizeof(mark));
+    h += pad;
+    offset = 0;
+  }
+  /* acq_rel so that a drainer which sees this stamp taken also sees every
+   * line queued before it */
+  uint64_t seq = nextSeq.fetch_add(1, std::memory_order_acq_rel);
+  memcpy(ring->buf + offset, &len, sizeof(len));
+  memcpy(ring->buf + offset + sizeof(len), &seq, sizeof(seq));
+  memcpy(ring->buf + offset + LOG_RECORD_HEADER, line, len);
+  ring->head.store(h + need, std::memory_order_release);
+}
+
+bool
+LogBackend::peekRecord(Ring* ring, uint64_t limit, uint64_t& seq)
+{
+  while (ring->batchTail != ring->batchHead)
+  {
+    uint32_t offset = ring->batchTail & (RING_SIZE - 1);
+    uint32_t len;
+    memcpy(&len, ring->buf + offset, sizeof(len));
+    if (len == LOG_RING_PAD_MARK)
+    {
+      ring->batchTail += RING_SIZE - offset;
+      continue;
+    }
+    memcpy(&seq, ring->buf + offset + sizeof(len), sizeof(seq));
+    return seq < limit;
+  }
+  return false;
+}
+
+bool
+LogBackend::drainOnce()
+{
+  bool     written = false;
+  uint64_t dropped = droppedCount.load(std::memory_order_relaxed);
+  Ring*    ring;
+
+  /* only lines stamped before the limit go in this batch, so a line queued
+   * after one of them can not be written ahead of it in a later batch */
+  uint64_t limit = nextSeq.load(std::memory_order_acquire);
+  Ring*    first = rings.load(std::memory_order_acquire);
+  pthread_mutex_lock(&sinkMutex);
+  for (ring = first; ring; ring = ring->next)
+  {
+    ring->batchTail = ring->tail.load(std::memory_order_relaxed);
+    ring->batchHead = ring->head.load(std::memory_order_acquire);
+  }
+  /* merge the rings by stamp, a few threads log so a scan per line is fine */
+  for (;;)
+  {
+    Ring*    oldest    = NULL;
+    uint64_t oldestSeq = 0;
+    uint64_t seq;
+    for (ring = first; ring; ring = ring->next)
+    {
+      if (peekRecord(ring, limit, seq) && (!oldest || seq < oldestSeq))
+      {
+        oldest    = ring;
+        oldestSeq = seq;
+      }
+    }
+    if (!oldest)
+    {
+      break;
+    }
+    uint32_t offset = oldest->batchTail & (RING_SIZE - 1);
+    uint32_t len;
+    memcpy(&len, oldest->buf + offset, sizeof(len));
+    write(oldest->buf + offset + LOG_RECORD_HEADER, len);
+    oldest->batchTail += LOG_RING_ALIGN(LOG_RECORD_HEADER + len);
+    written = true;
+  }
+  for (ring = first; ring; ring = ring->next)
+  {
+    ring->tail.store(ring->batchTail, std::memory_order_release);
+  }
+
+  if (dropped != reportedDropped)
+  {
+    char msg[64];
+    int  len = snprintf(msg, sizeof(msg), "[log] %llu lines dropped\n",
+                       (unsigned long long)(dropped - reportedDropped));
+    write(msg, (uint32_t)len);
+    reportedDropped = dropped;
+    written         = true;
+  }
+  if (written)
+  {
+    fflush(file ? file : stdout);
+  }
+  pthread_mutex_unlock(&sinkMutex);
+
+  reapOrphans();
+  return written;
+}
+
+void
+LogBackend::reapOrphans()
+{
+  Ring* prev = NULL;
+  Ring* ring = rings.load(std::memory_order_acquire);
+
+  while (ring)
+  {
+    Ring* next = ring->next;
+    if (ring->orphaned.load(std::memory_order_acquire) &&
+        ring->head.load(std::memory_order_acquire) ==
+          ring->tail.load(std::memory_order_relaxed))
+    {
+      /* producers only ever push at the list head, so an inner ring can be
+       * unlinked directly while the head needs a CAS */
+      if (prev)
+      {
+        prev->next = next;
+        delete ring;
+        ring = next;
+        continue;
+      }
+      Ring* expected = ring;
+      if (rings.compare_exchange_strong(expected, next,
+                                        std::memory_order_acq_rel))
+      {
+        delete ring;
+        ring = next;
+        continue;
+      }
+    }
+    prev = ring;
+    ring = next;
+  }
+}
+
+void
+LogBackend::write(const char* data, uint32_t len)
+{
+  if (!file)
+  {
+    fwrite(data, 1, len, stdout);
+    return;
+  }
+
+  fwrite(data, 1, len, file);
+  fileSize += len;
+  if (maxFileSize && fileSize >= maxFileSize)
+  {
+    rotateFile();
+  }
+}
+
+void
+LogBackend::rotateFile()
+{
+  char from[sizeof(filePath) + 12];
+  char to[sizeof(filePath) + 12];
+
+  fclose(file);
+  for (uint32_t i = maxFileNum; i > 1; i--)
+  {
+    snprintf(from, sizeof(from), "%s.%u", filePath, i - 1);
+    snprintf(to, sizeof(to), "%s.%u", filePath, i);
+    rename(from, to);
+  }
+  if (maxFileNum)
+  {
+    snprintf(to, sizeof(to), "%s.1", filePath);
+    rename(filePath, to);
+  }
+
+  file     = fopen(filePath, maxFileNum ? "w" : "a");
+  fileSize = 0;
+  if (!file)
+  {
+    fprintf(stderr, "[log] reopen %s failed, errno %d\n", filePath, errno);
+  }
+}
+
+void*
+LogBackend::drainTask(void* arg)
+{
+  LogBackend* backend = (LogBackend*)arg;
+
+  while (backend->running.load(std::memory_order_acquire))
+  {
+    if (backend->drainOnce())
+    {
+      continue;
+    }
+
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_nsec += LOG_DRAIN_IDLE_MS * 1000000L;
+    if (ts.tv_nsec >= 1000000000L)
+    {
+      ts.tv_sec  += 1;
+      ts.tv_nsec -= 1000000000L;
+    }
+    pthread_mutex_lock(&backend->waitMutex);
+    if (backend->running.load(std::memory_order_acquire))
+    {
+      pthread_cond_timedwait(&backend->waitCond, &backend->waitMutex, &ts);
+    }
+    pthread_mutex_unlock(&backend->waitMutex);
+  }
+
+  backend->drainOnce();
+  return NULL;
+}
+
+#endif // __linux__
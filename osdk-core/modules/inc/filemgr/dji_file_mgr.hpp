@@ -29,6 +29,9 @@
 #ifndef DJI_FILE_MGR_HPP
 #define DJI_FILE_MGR_HPP
 
+#include <map>
+#include <mutex>
+#include <vector>
 #include "dji_error.hpp"
 #include "dji_file_mgr_define.hpp"
 #include "osdk_command.h"
@@ -39,6 +42,7 @@ namespace OSDK {
 // Forward Declaration
 class Linker;
 class FileMgrImpl;
+class FileBatchDownloader;
 
 class FileMgr {
  public:
@@ -52,8 +56,93 @@ class FileMgr {
   ErrorCode::ErrorCodeType startReqFileList(E_OSDKCommandDeiveType type, uint8_t index, FileListReqCBType cb, void* userData);
   ErrorCode::ErrorCodeType startReqFileData(E_OSDKCommandDeiveType type, uint8_t index, int fileIndex, std::string localPath, FileDataReqCBType cb, void* userData);
 
+  /*! @brief Download a file, keeping what a failed download of it left
+   *  @details A download that fails, times out or is stopped keeps the file
+   *  and a "<localPath>.part" file naming the received ranges. This only
+   *  asks for the missing ranges then, or for the whole file if there is
+   *  nothing to resume. The part file is removed once the file is complete.
+   */
+  ErrorCode::ErrorCodeType startResumeFileData(E_OSDKCommandDeiveType type, uint8_t index, int fileIndex, std::string localPath, FileDataReqCBType cb, void* userData);
+
+  /*! Page and filter of a streamed file list, a zeroed filter asks for the
+   *  whole list */
+  typedef struct FileListFilter {
+    uint32_t startIndex;  /*!< first entry of the page, 1 (or 0) is the first
+                               file of the card */
+    uint16_t count;       /*!< entries in the page, 0 or 0xFFFF for all */
+    uint32_t typeMask;    /*!< bit (1 << MediaFileType) set for each type to
+                               keep, 0 keeps all */
+    int minFileIndex;     /*!< fileIndex range to keep, both ends included, */
+    int maxFileIndex;     /*!< a maxFileIndex of 0 leaves it open */
+    DateTime dateFrom;    /*!< creation date range to keep, both ends */
+    DateTime dateTo;      /*!< included, a year of 0 leaves that end open */
+    uint16_t batchSize;   /*!< files per batch callback, 0 for 32 */
+  } FileListFilter;
+
+  /*! Called from the receive thread with the next files of the list that
+   *  pass the filter, as soon as they are decoded. amount is the number of
+   *  entries the camera announced for the page, 0 until known. The last
+   *  call has finished set, with ret_code OSDK_STAT_ERR if the list did not
+   *  complete. */
+  typedef void (*FileListBatchCBType)(E_OsdkStat ret_code, const std::vector<MediaFile> &files, uint32_t amount, bool finished, void* userData);
+
+  /*! @brief Request the file list, handing the files over in batches
+   *  @details Entries are decoded while the packs arrive in order, nothing
+   *  waits for the whole list and no copy of it is kept. The page is
+   *  requested from the camera, the other fields of the filter are applied
+   *  on the decoded entries.
+   */
+  ErrorCode::ErrorCodeType startReqFileListStream(E_OSDKCommandDeiveType type, uint8_t index, const FileListFilter &filter, FileListBatchCBType cb, void* userData);
+
+  /*! One file of a batch download */
+  typedef struct DownloadJob {
+    E_OSDKCommandDeiveType type;
+    uint8_t index;
+    int fileIndex;
+    std::string localPath;
+  } DownloadJob;
+
+  typedef struct BatchProgress {
+    uint32_t filesTotal;
+    uint32_t filesDone;      /*!< finished with success */
+    uint32_t filesFailed;    /*!< failed, timed out or cancelled */
+    uint64_t bytesDone;      /*!< over all files, including the running ones */
+    uint32_t bytesPerSec;    /*!< over the last progress period */
+    uint32_t avgBytesPerSec; /*!< since the batch started */
+    uint32_t elapsedMs;
+  } BatchProgress;
+
+  /*! jobIndex is the position of the file in the jobs given to
+   *  startBatchDownload */
+  typedef void (*BatchFileCBType)(E_OsdkStat ret_code, uint32_t jobIndex, uint64_t fileSize, void* userData);
+  /*! Called about once a second, and a last time with finished set */
+  typedef void (*BatchProgressCBType)(const BatchProgress &progress, bool finished, void* userData);
+
+  /*! @brief Download a batch of files, non-blocking
+   *  @details Jobs of different devices run at the same time, jobs of the
+   *  same device one after the other in the given order, each one starting
+   *  as soon as the previous one is done. Callbacks run on the batch task.
+   *  Files are downloaded with startResumeFileData, so running a failed
+   *  batch again only fetches what is missing.
+   *  startReqFileList/startReqFileData of a device return InvalidState while
+   *  the batch is using it.
+   */
+  ErrorCode::ErrorCodeType startBatchDownload(const std::vector<DownloadJob> &jobs, BatchFileCBType fileCb, BatchProgressCBType progressCb, void* userData);
+
+  /*! @brief Stop the running batch, the running files fail and the queued
+   *  ones are dropped. The last progress callback reports what was done. */
+  void cancelBatchDownload();
+
+  bool isBatchDownloading();
+
+  /*! Instance talking to the given device, created on first use */
+  FileMgrImpl *getImpl(E_OSDKCommandDeiveType type, uint8_t index);
+
  private:
-  FileMgrImpl *impl;
+  Linker *linker;
+  std::map<uint16_t, FileMgrImpl *> impls;
+  std::mutex implsMutex;
+  FileBatchDownloader *batch;
 };
 }
 }
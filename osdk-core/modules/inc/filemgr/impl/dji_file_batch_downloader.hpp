@@ -0,0 +1,99 @@
+/** @file dji_file_batch_downloader.hpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief Scheduler running batch downloads over several devices at once
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef DJI_FILE_BATCH_DOWNLOADER_HPP
+#define DJI_FILE_BATCH_DOWNLOADER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include "dji_file_mgr.hpp"
+
+namespace DJI {
+namespace OSDK {
+
+/*! @brief Runs the jobs of FileMgr::startBatchDownload
+ *  @details Jobs are split into one lane per device. A task polls the lanes
+ *  every 10ms and starts the next job of a lane as soon as its device is
+ *  idle again, so each device always has a file in flight while devices
+ *  download in parallel. File results are handed over from the receive
+ *  thread through the lane, the user callbacks only ever run on the task.
+ */
+class FileBatchDownloader {
+ public:
+  FileBatchDownloader(FileMgr *mgr);
+  ~FileBatchDownloader();
+
+  ErrorCode::ErrorCodeType start(const std::vector<FileMgr::DownloadJob> &jobs,
+                                 FileMgr::BatchFileCBType fileCb,
+                                 FileMgr::BatchProgressCBType progressCb,
+                                 void *userData);
+  void cancel();
+  bool isRunning();
+
+ private:
+  typedef struct Lane {
+    FileMgrImpl *impl;
+    std::deque<uint32_t> pending;
+    int active;                /*!< job index in flight, -1 if none */
+    uint32_t activeStartMs;
+    std::atomic<bool> finished;
+    std::atomic<int> result;   /*!< E_OsdkStat of the finished job */
+    FileBatchDownloader *owner;
+  } Lane;
+
+  static void *batchTask(void *arg);
+  static void fileDataReqCB(E_OsdkStat ret_code, void *userData);
+  void run();
+  bool startNext(Lane *lane);
+  void finishActive(Lane *lane, E_OsdkStat ret);
+  uint64_t getBytesDone();
+
+  FileMgr *mgr;
+  std::vector<FileMgr::DownloadJob> jobs;
+  std::vector<Lane *> lanes;
+  FileMgr::BatchFileCBType fileCb;
+  FileMgr::BatchProgressCBType progressCb;
+  void *userData;
+
+  FileMgr::BatchProgress progress;
+  uint64_t finishedBytes;
+  std::atomic<bool> running;
+  std::atomic<bool> cancelReq;
+  /*! Of the last batch, joined by the next start or the destructor */
+  T_OsdkTaskHandle taskHandle;
+  std::mutex doneMutex;
+  std::condition_variable doneCond;
+};
+
+}
+}
+
+#endif  // DJI_FILE_BATCH_DOWNLOADER_HPP
@@ -36,6 +36,9 @@
 #include <unistd.h>
 #include <memory>
 #include <atomic>
+#include <map>
+#include <mutex>
+#include <vector>
 #include "dji_error.hpp"
 #include "osdk_command.h"
 #include "dji_file_mgr_internal_define.hpp"
@@ -71,9 +74,35 @@ class DownloadListHandler {
   CommonDataRangeHandler *range_handler_;
   DownloadBufferQueue *download_buffer_;
   FileMgr::FileListReqCBType reqCB;
+  /*! Set instead of reqCB by a streamed request */
+  FileMgr::FileListBatchCBType batchCB;
   void* reqCBUserData;
   std::atomic<int> downloadState;
   std::atomic<uint32_t> updateTimeMs;
+
+  /*! Serializes parsing and finishing the request in flight, done by the
+   *  receive thread and, on timeout, by the monitor task */
+  std::mutex listMutex;
+
+  FileMgr::FileListFilter filter;
+  /*! Next seq to hand to the parser, and the seq of the pack flagged last,
+   *  -1 until it arrived */
+  uint32_t parseSeq;
+  int64_t lastPackSeq;
+
+  /*! State of the incremental parser. parsedBytes counts from the start of
+   *  the list, listLen is -1 until the header is decoded. A header or
+   *  descriptor split over two packs is gathered in carry. */
+  int parseState;
+  uint32_t listAmount;
+  int64_t listLen;
+  uint32_t parsedBytes;
+  uint32_t need;
+  uint8_t carry[sizeof(dji_list_info_descriptor)];
+  uint32_t carryLen;
+
+  /*! Files decoded and kept but not handed over yet */
+  FilePackage package;
 };
 
 class DownloadDataHandler {
@@ -89,6 +118,39 @@ class DownloadDataHandler {
   std::string downloadPath;
   std::atomic<int> downloadState;
   std::atomic<int> curTargetFileIndex;
+  /*! Bumped by every request, a monitor task quits once it is outdated */
+  std::atomic<uint32_t> session;
+  uint32_t lastSeq;
+  uint64_t lastPrintFilePos;
+  uint32_t lastPrintMs;
+
+  /*! Guards the mapped file, recvRanges and the state of the request in
+   *  flight, written by the receive thread, read by the monitor task. */
+  std::mutex dataMutex;
+  /*! Byte ranges of the file written so far, start -> end, merged */
+  std::map<uint64_t, uint64_t> recvRanges;
+  /*! File range asked for by the request in flight */
+  uint64_t reqOffset;
+  uint64_t reqSize;
+  /*! File data carried by seq 0, -1 until it arrived */
+  int64_t firstPackLen;
+  /*! File data carried by every later pack but the last, 0 until known */
+  uint32_t packLen;
+  /*! Seq of the pack flagged last, -1 until it arrived */
+  int64_t lastPackSeq;
+  /*! Packs whose offset is not known yet, by seq */
+  std::map<uint32_t, std::vector<uint8_t> > earlyPacks;
+  /*! Bytes written when the request in flight was sent */
+  uint64_t reqStartBytes;
+  uint64_t savedBytes;
+  /*! Set once a request is complete but the file still has holes, the
+   *  monitor task then asks for the next one */
+  std::atomic<bool> nextRangeReq;
+  /*! session_id of the request in flight, new for every range requested so
+   *  the late packs of an aborted request are told apart */
+  std::atomic<uint16_t> reqSessionId;
+  /*! Requests in a row asked for again without bringing any data */
+  uint32_t restartCnt;
 };
 
 class FileMgrImpl {
@@ -98,12 +160,30 @@ class FileMgrImpl {
 
   void setTargetDevice(E_OSDKCommandDeiveType type, uint8_t index);
 
+  /*! Neither a file list nor a file data request is running */
+  bool isIdle();
+
+  /*! Bytes written so far and total size of the file being downloaded, or of
+   *  the last one once it is done. */
+  void getFileDataProgress(uint64_t &recvBytes, uint64_t &fileSize);
+
+  /*! Abort the running file data request, its callback gets OSDK_STAT_ERR */
+  void stopReqFileData();
+
   ErrorCode::ErrorCodeType startReqFileList(FileMgr::FileListReqCBType cb, void* userData);
+  ErrorCode::ErrorCodeType startReqFileListStream(const FileMgr::FileListFilter &filter, FileMgr::FileListBatchCBType cb, void* userData);
   ErrorCode::ErrorCodeType startReqFileData(int fileIndex, std::string localPath, FileMgr::FileDataReqCBType cb, void* userData);
+  /*! Like startReqFileData, but keeps what an earlier failed download of the
+   *  same file left at localPath and only asks for the missing ranges */
+  ErrorCode::ErrorCodeType startResumeFileData(int fileIndex, std::string localPath, FileMgr::FileDataReqCBType cb, void* userData);
 
   void HandlePushPack(dji_general_transfer_msg_ack *rsp);
-  ErrorCode::ErrorCodeType SendReqFileListPack();
-  ErrorCode::ErrorCodeType SendReqFileDataPack(int fileIndex) ;
+
+  /*! Hand a pushed pack to the instance talking to its sender */
+  static void dispatchPushPack(uint8_t sender, dji_general_transfer_msg_ack *rsp);
+  ErrorCode::ErrorCodeType SendReqFileListPack(uint32_t startIndex = 1, uint16_t count = 0xffff);
+  ErrorCode::ErrorCodeType SendReqFileDataPack(int fileIndex, uint16_t sessionId, uint32_t offset = 0, uint32_t size = (uint32_t)(-1));
+  uint16_t getSessionId(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE taskId);
 
  private:
   ErrorCode::ErrorCodeType SendAbortPack(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE taskId);
@@ -130,13 +210,35 @@ class FileMgrImpl {
  private:
   //typedef void (*FileDataReqCBType)(E_OsdkStat ret_code, dji_general_transfer_msg_ack* ackData);
   //static void internalFileDataReqCB(E_OsdkStat ret_code, void *userData);
-  typedef struct ConsumeDataBuffer {
-    uint8_t data[1024];
-    uint16_t index;
-  } ConsumeDataBuffer;
-  ConsumeDataBuffer ConsumeChunk(DataPointer data_pointer, size_t &chunk_index, size_t consumSize);
-  FilePackage parseFileList(std::list<DataPointer> fullDataList);
-  bool parseFileData(dji_general_transfer_msg_ack *rsp);
+  /*! Decode the in-order packs waiting in the queue, true once the pack
+   *  flagged last is decoded */
+  bool parseFileList(DownloadBufferQueue *queue);
+  void parseFileListData(const uint8_t *data, uint32_t len);
+  bool buildMediaFile(const dji_list_info_descriptor *data, MediaFile &file);
+  bool matchFileListFilter(const MediaFile &file);
+  /*! Hand the kept files to the batch callback */
+  void flushFileListBatch(E_OsdkStat ret, bool finished);
+  void finishReqFileList(E_OsdkStat ret);
+
+  typedef enum PackParseResult {
+    PACK_STORED,   /*!< written, or kept until its offset is known */
+    PACK_DROPPED,  /*!< left missing, to be asked for again */
+    PACK_FATAL,    /*!< the download cannot go on */
+    PACK_STALE,    /*!< of an earlier request, ignored */
+    PACK_RESTART,  /*!< the packs do not add up, ask for the range again */
+  } PackParseResult;
+  PackParseResult parseFileData(dji_general_transfer_msg_ack *rsp);
+  PackParseResult storeFilePack(uint32_t seq, const uint8_t *data, uint32_t len);
+  PackParseResult flushEarlyPacks();
+  bool getPackOffset(uint32_t seq, uint64_t &offset);
+  void addRecvRange(uint64_t start, uint64_t len);
+  bool findMissingRange(uint64_t &offset, uint64_t &size);
+
+  /*! The received ranges are kept in "<localPath>.part" while a download
+   *  is incomplete */
+  std::string getPartFilePath();
+  void savePartFile();
+  bool loadPartFile(int fileIndex, uint64_t &fileSize);
 
  private:
   void OnReceiveAbortPack(dji_general_transfer_msg_ack *rsp);
@@ -145,6 +247,11 @@ class FileMgrImpl {
 
   void fileListRawDataCB(dji_general_transfer_msg_ack *rsp);
   void fileDataRawDataCB(dji_general_transfer_msg_ack *rsp);
+  void finishReqFileData(E_OsdkStat ret);
+  void restartRange();
+  ErrorCode::ErrorCodeType startFileList(const FileMgr::FileListFilter &filter, FileMgr::FileListReqCBType cb, FileMgr::FileListBatchCBType batchCb, void* userData);
+  ErrorCode::ErrorCodeType startFileData(int fileIndex, std::string localPath, bool resume, FileMgr::FileDataReqCBType cb, void* userData);
+  ErrorCode::ErrorCodeType requestNextRange();
 
   std::string GetFileName(MediaFile fileInfo);
   std::string GetSuffixByFileType(MediaFileType type);
@@ -158,6 +265,11 @@ class FileMgrImpl {
   static void fileListMonitorTask(void *arg);
   static void fileDataMonitorTask(void *arg);
   void printFileDownloadStatus();
+
+  /*! Every live instance, the push handler is registered once for all of
+   *  them and routes by sender. */
+  static std::vector<FileMgrImpl *> instances;
+  static std::mutex instancesMutex;
   //只是用于测试
  private:
   uint8_t localSenderId;
@@ -10,10 +10,16 @@
 #define downloadbufferqueue_h
 
 #include <stdio.h>
-#include <condition_variable>
-#include <list>
-#include <memory>
-#include <mutex>
+#include <stdint.h>
+#include <atomic>
+
+/*! Largest pack a slot holds, the download ack handler drops V1 frames with
+ *  a bigger payload */
+#define DOWNLOAD_BUFFER_SLOT_SIZE 1024
+/*! Slots of the file list queue. The list is parsed as soon as its packs
+ *  are in order, so the queue only holds the packs that overtook a late
+ *  one, not the whole list: a 5000-file list is about 283 packs. */
+#define DOWNLOAD_LIST_BUFFER_PACKS 64
 
 namespace DJI {
 namespace OSDK {
@@ -22,6 +28,11 @@ typedef struct DJIDataPointer {
     int length;
 } DataPointer;
 
+/*! Ring of preallocated slots reordering the packs of a transfer by seq.
+ *  The pack of seq n goes to slot n % size. Packs are inserted in any order
+ *  by one thread and taken in order by one thread with FrontBuffer and
+ *  PopBuffer, without locks. InitBufferQueue allocates only if the size
+ *  changes, nothing is allocated per pack. */
 class DownloadBufferQueue final {
 public:
   typedef enum InsertRetType {
@@ -34,42 +45,48 @@ public:
   } InsertRetType;
 
     DownloadBufferQueue() = default;
-    virtual ~DownloadBufferQueue() = default;
+    ~DownloadBufferQueue() { Dealloc(); }
 
     DownloadBufferQueue(const DownloadBufferQueue& other) = delete;
     DownloadBufferQueue(DownloadBufferQueue&& other) = delete;
     DownloadBufferQueue& operator=(const DownloadBufferQueue& other) = delete;
     DownloadBufferQueue& operator=(DownloadBufferQueue&& other) = delete;
 
+    /*! Not to be called while a transfer is running */
     bool InitBufferQueue(int size, int start_index);
 
     bool FindBlockByIndex(int index);
+    /*! A resent pack carries the same bytes, a filled slot is kept as is
+     *  whatever flag says. Without flag that is reported as
+     *  INSERT_FAIL_MEMORY_USED. */
     InsertRetType InsertBlock(const uint8_t *data, uint32_t data_length, int index, bool flag);
 
-    DataPointer DequeueBuffer();
-    std::list<DataPointer> DequeueAllBuffer();
+    /*! The pack of the expected seq, or a null data pointer if it has not
+     *  come yet. It stays valid until PopBuffer. */
+    DataPointer FrontBuffer();
+    /*! Hand the slot of FrontBuffer back and expect the next seq */
+    void PopBuffer();
     int GetConfirmSeq();
     int GetBufMaxSeq();
     int GetSize() {
         return m_size;
     };
 
+    /*! Not to be called while a transfer is running */
     void Clear();
     void Dealloc();
 
 private:
-    mutable std::mutex m_mutex;
-    std::condition_variable m_data_condition;
-    DataPointer* m_queue_ptr = nullptr;
+    // 每个slot的数据长度, 0代表空
+    std::atomic<uint32_t>* m_slot_length = nullptr;
+    uint8_t* m_slot_data = nullptr;
 
     // 确认收到并缓存最大index
-    int m_buf_max_index;
+    std::atomic<int> m_buf_max_index{-1};
     // 期待接受的index， 即确认收到连续序列index + 1
-    int m_expect_index;
-    // 期待接受的index对应的Buf数组下标
-    int m_head;
+    std::atomic<int> m_expect_index{0};
     // Buffer 的大小
-    int m_size;
+    int m_size = 0;
 };
 }  // namespace OSDK
 
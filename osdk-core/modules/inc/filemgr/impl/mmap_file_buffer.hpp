@@ -12,9 +12,33 @@
 #include <unistd.h>
 #include <memory>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include "osdk_platform.h"
+
+/*! The file is mapped a window at a time, windows are aligned to their size */
+#define MMAP_FILE_WINDOW_SIZE (16 * 1024 * 1024)
+/*! Windows mapped at once, packs may come out of order or from a resumed
+ *  range elsewhere in the file */
+#define MMAP_FILE_WINDOW_CNT 4
+/*! Written back windows left in the page cache before the oldest one is
+ *  waited for and dropped */
+#define MMAP_FILE_FLUSH_LAG 2
 
 namespace DJI {
 namespace OSDK {
+/*! @brief Writes a file through a few mapped windows
+ *  @details The file is preallocated by init, so a full disk fails there
+ *  and not with a SIGBUS halfway through. A window is unmapped once every
+ *  byte of it is written or it is the least recently used one when another
+ *  is needed, and handed to a flush task. The task starts its write back and
+ *  drops it from the page cache once written, so the page cache never holds
+ *  more than a few windows of dirty data, InsertBlock never waits for the
+ *  disk and deInit does not stall on a multi-GB flush.
+ */
 class MmapFileBuffer {
  public:
   MmapFileBuffer();
@@ -22,16 +46,54 @@ class MmapFileBuffer {
 
   std::string currentLogFilePath;
   int fd;
-  char *fdAddr;
-  uint64_t fdAddrSize;
+  uint64_t fileSize;
   uint64_t curFilePos;
 
   bool init(std::string path, uint64_t fileSize);
 
   bool deInit();
 
+  bool isOpen() const { return fd >= 0; }
+
   bool InsertBlock(const uint8_t *pack, uint32_t data_length, uint64_t index);
 
+ private:
+  typedef struct Window {
+    uint64_t start;
+    uint64_t length;
+    /*! Ranges written, start -> end relative to the window, merged */
+    std::map<uint64_t, uint64_t> covered;
+    uint64_t coveredBytes;
+    char *addr;        /*!< NULL if the slot is free */
+    uint32_t lastUse;
+  } Window;
+
+  typedef struct FlushRange {
+    int fd;            /*!< a dup of fd, closed by the flush task */
+    uint64_t start;
+    uint64_t length;
+  } FlushRange;
+
+  Window *getWindow(uint64_t offset);
+  void releaseWindow(Window *window);
+  /*! Bytes of the window covered once [offset, offset + len) is added */
+  uint64_t addCoverage(Window *window, uint64_t offset, uint64_t len);
+
+  bool startFlushTask();
+  void stopFlushTask();
+  static void *flushTask(void *arg);
+  static void finishFlush(const FlushRange &range);
+
+  Window windows[MMAP_FILE_WINDOW_CNT];
+  uint32_t useCnt;
+
+  std::mutex flushMutex;
+  std::condition_variable flushCond;
+  /*! Released windows the flush task has not taken yet, oldest first */
+  std::deque<FlushRange> flushQueue;
+  bool flushStop;
+  bool flushRunning;
+  T_OsdkTaskHandle flushTaskHandle;
 };
 }
 }
@@ -87,9 +87,6 @@ class FlightActions {
     UserData userData;
   } UCBRetCodeHandler;
 
-  static const int maxSize = 32;
-  UCBRetCodeHandler ucbHandler[maxSize];
-
   UCBRetCodeHandler *allocUCBHandler(void *callback, UserData userData);
 
   static void commonAckDecoder(Vehicle *vehicle, RecvContainer recvFrame,
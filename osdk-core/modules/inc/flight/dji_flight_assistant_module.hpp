@@ -122,9 +122,6 @@ class FlightAssistant {
     UserData userData;
   } UCBRetCodeHandler;
 
-  static const int maxSize = 32;
-  UCBRetCodeHandler ucbHandler[maxSize];
-
   /*! @brief struct of callback deal the param and retCode for user
   　*/
   template <typename T>
@@ -63,9 +63,9 @@ class MopClient : MopPipelineManagerBase {
    * pipeline type. If success, a pipeline object will be created.
    *
    *  @platforms M300
-   *  @note This is a non-blocking api.
-   *  @todo This api is not implemented yet, it will be implemented in the
-   *  future.
+   *  @note This is a non-blocking api. The blocking connect runs as a job of
+   * DJI::OSDK::MopEventLoop and cb is called from its worker, so the client
+   * has to live until then.
    *  @param id The pipeline id which to be connected, ref to
    * DJI::OSDK::MOP::PipelineID
    *  @param type The pipeline type. It can be set to be RELIABLE or UBRELIABLE
@@ -96,9 +96,7 @@ class MopClient : MopPipelineManagerBase {
   /*! @brief Disonnect the target device by a pipelineid.
    * 
    *  @platforms M300
-   *  @note This is a non-blocking api
-   *  @todo This api is not implemented yet, it will be implemented in the
-   *  future.
+   *  @note This is a non-blocking api, run like the non-blocking connect
    *  @param id The pipeline id which to be connected, ref to the enum
    *  @param cb Callback function defined by user
    *  @arg @b errCode is the DJI::OSDK::MOP::MopErrCode error code
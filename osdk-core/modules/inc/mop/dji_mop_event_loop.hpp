@@ -0,0 +1,131 @@
+/** @file dji_mop_event_loop.hpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief Worker pool running the asynchronous mop operations
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef DJI_MOP_EVENT_LOOP_HPP
+#define DJI_MOP_EVENT_LOOP_HPP
+
+#include <stdint.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "dji_mop_pipeline.hpp"
+#include "dji_singleton.hpp"
+#include "osdk_platform.h"
+
+namespace DJI {
+namespace OSDK {
+
+/*! One queued sendDataAsync or recvDataAsync */
+typedef struct MopAsyncRequest {
+  MopPipeline::DataPackType dataPacket;
+  MopPipeline::AsyncCBType cb;
+  void *userData;
+  uint32_t timeoutMs;
+  uint32_t startMs;
+} MopAsyncRequest;
+
+/*! Operations of one direction of a pipeline, run one at a time in order */
+typedef struct MopAsyncQueue {
+  MopPipeline *pipeline;
+  bool send;
+  uint32_t depth;      /*!< queued operations accepted, the running one too */
+  std::deque<MopAsyncRequest> pending;
+  bool scheduled;      /*!< waiting in a run queue of the loop */
+  bool busy;           /*!< a worker runs its front operation */
+  bool idle;           /*!< the last read timed out without data */
+  bool cancelled;
+  std::thread::id owner; /*!< the worker while busy */
+} MopAsyncQueue;
+
+/*! @brief Small pool of workers multiplexing the asynchronous operations of
+ * all pipelines
+ *
+ *  @details The mop library only has blocking calls and no readiness
+ * notification, so a worker makes one read or write call at a time and moves
+ * on. A read that times out marks its pipeline idle and goes to the back of
+ * the idle run queue, so idle pipelines take turns polling on half of the
+ * workers instead of holding one thread each. Those workers are kept for them
+ * while other pipelines move data, and the rest stay free for the latter.
+ * The price is latency: an idle pipeline notices new data after up to
+ * (idle pipelines / polling workers) read timeouts of the mop library, a
+ * pipeline needing better keeps its own thread with the blocking calls.
+ * Workers are started by the first operation.
+ */
+class MopEventLoop : public Singleton<MopEventLoop> {
+ public:
+  typedef void (*JobType)(void *userData);
+
+  MopEventLoop();
+  ~MopEventLoop();
+
+  /*! Workers of the pool, 4 by default. Only takes effect before the first
+   *  operation, returns false afterwards. Accept and connect jobs hold a
+   *  worker until they finish, so count them in. */
+  bool setWorkerCount(uint32_t count);
+  uint32_t getWorkerCount();
+
+  /*! Run a job on a worker */
+  MopErrCode post(JobType job, void *userData);
+
+  /*! Queue an operation, MOP_RESBUSY if depth operations are queued */
+  MopErrCode submit(MopAsyncQueue *queue, const MopAsyncRequest &request);
+
+  /*! Drop the queued operations of the queue, their callbacks run from here
+   *  with MOP_FAILED, and wait for the running one */
+  void cancel(MopAsyncQueue *queue);
+
+ private:
+  typedef struct RunItem {
+    MopAsyncQueue *queue;
+    JobType job;
+    void *userData;
+  } RunItem;
+
+  std::mutex mutex;
+  std::condition_variable workCond;
+  std::condition_variable doneCond;
+  std::deque<RunItem> runQueue;
+  std::deque<MopAsyncQueue *> idleQueue;
+  std::vector<T_OsdkTaskHandle> workers;
+  uint32_t workerCount;
+  uint32_t idleRunning; /*!< workers polling an idle pipeline */
+  bool stopReq;
+
+  bool startWorkers();
+  uint32_t getIdleLimit();
+  bool hasWork();
+  void schedule(MopAsyncQueue *queue);
+  void runOperation(MopAsyncQueue *queue, std::unique_lock<std::mutex> &lock);
+  static void *workerTask(void *arg);
+};
+
+}  // namespace OSDK
+}  // namespace DJI
+
+#endif  // DJI_MOP_EVENT_LOOP_HPP
@@ -0,0 +1,213 @@
+/** @file dji_mop_file_transfer.hpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief File transfer over a mop pipeline
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef DJI_MOP_FILE_TRANSFER_HPP
+#define DJI_MOP_FILE_TRANSFER_HPP
+
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include "dji_mop_pipeline.hpp"
+
+namespace DJI {
+namespace OSDK {
+
+/*! @brief Class moving files over a reliable MOP pipeline with the file
+ * transfer protocol of the MOP samples
+ *
+ *  @details Every transfer runs as a pipeline of stages: a task reading
+ * ahead from disk (and hashing before a file is sent), or writing and hashing
+ * what was received, and the calling thread driving the channel. Up to
+ * window chunks are buffered between the two. Several files are moved at
+ * once with one MopFileTransfer per pipeline, each called from its own
+ * thread.
+ */
+class MopFileTransfer {
+ public:
+  typedef enum CmdType : uint8_t {
+    CMD_REQUEST = 0x50,
+    CMD_ACK = 0x51,
+    CMD_RESULT = 0x52,
+    CMD_FILEINFO = 0x60,
+    CMD_DL_FILENAME = 0x61,
+    CMD_FILEDATA = 0x62,
+    /*! Extension of the sample protocol, sent right after the ack of the
+     *  request to resume from the given offset. A peer without it does not
+     *  answer and the transfer fails with MOP_TIMEOUT. */
+    CMD_FILE_OFFSET = 0x63,
+  } CmdType;
+
+  typedef enum SubCmdType : uint8_t {
+    REQ_UPLOAD = 0x00,
+    REQ_DOWNLOAD = 0x01,
+    ACK_OK = 0x00,
+    ACK_REJECT = 0x01,
+    RET_OK = 0x00,
+    RET_FAIL = 0x01,
+    NORMAL_PACK = 0x00,
+    END_PACK = 0x01,
+    SUBCMD_DEFAULT = 0xFF,
+  } SubCmdType;
+
+#pragma pack(1)
+  /*! Starts every pack, dataLen bytes follow it */
+  typedef struct PackHeader {
+    uint8_t cmd;
+    uint8_t subcmd;
+    uint16_t seq;
+    uint32_t dataLen;
+  } PackHeader;
+
+  typedef struct FileInfo {
+    bool isExist;
+    uint32_t fileLength;
+    char fileName[32];
+    uint8_t md5Buf[16];
+  } FileInfo;
+#pragma pack()
+
+  typedef struct Config {
+    uint32_t chunkSize;    /*!< file bytes per data pack sent */
+    uint32_t recvPackSize; /*!< largest data pack accepted from the peer */
+    uint32_t window;       /*!< chunks buffered between disk and channel */
+    uint32_t timeoutMs;    /*!< wait for each pack of the peer */
+  } Config;
+
+  typedef struct Stats {
+    uint64_t fileSize;
+    uint64_t offset;        /*!< bytes the transfer resumed after */
+    uint64_t bytesDone;     /*!< file bytes moved by the data phase */
+    uint32_t elapsedMs;     /*!< since the transfer started */
+    uint32_t dataMs;        /*!< of the data phase */
+    uint32_t bytesPerSec;   /*!< bytesDone over dataMs */
+    uint32_t packs;         /*!< data packs moved */
+    uint32_t rttCnt;        /*!< control packs answered by the peer */
+    uint32_t rttLastMs;
+    uint32_t rttMinMs;
+    uint32_t rttMaxMs;
+    uint32_t rttAvgMs;
+    uint32_t channelWaitMs; /*!< the channel waited for the disk stage */
+    uint32_t diskWaitMs;    /*!< the disk stage waited for the channel */
+  } Stats;
+
+  /*! Called from the calling thread about once a second during the data
+   *  phase, and a last time when it ends */
+  typedef void (*ProgressCBType)(const Stats &stats, void *userData);
+
+  /*! 100KB packs, a 3MB receive limit and a window of 4 chunks, the sizes
+   *  the MOP samples use */
+  MopFileTransfer(MopPipeline *pipeline);
+  ~MopFileTransfer();
+
+  /*! Not to be called while a transfer is running */
+  void setConfig(const Config &config);
+  Config getConfig();
+  void setProgressCB(ProgressCBType cb, void *userData);
+
+  /*! @brief Send a local file to the peer, blocking
+   *
+   *  @param localPath The file to send
+   *  @param remoteName The name the peer stores it under, up to 31 chars
+   *  @param offset The bytes the peer already has, 0 to send all of it
+   *  @return ref to the enum DJI::OSDK::MOP::MopErrCode
+   */
+  MopErrCode upload(const std::string &localPath, const std::string &remoteName,
+                    uint32_t offset = 0);
+
+  /*! @brief Fetch a file of the peer, blocking
+   *
+   *  @note With an offset, the first offset bytes already in localPath are
+   * kept and hashed again for the MD5 check of the whole file. A failed
+   * download keeps what it wrote, its size is the offset to resume from.
+   *  @param remoteName The name of the file on the peer, up to 31 chars
+   *  @param localPath The path to store the file to
+   *  @param offset The bytes of the file already in localPath
+   *  @return ref to the enum DJI::OSDK::MOP::MopErrCode
+   */
+  MopErrCode download(const std::string &remoteName, const std::string &localPath,
+                      uint32_t offset = 0);
+
+  /*! @brief Answer one upload or download request of the peer, blocking
+   * until it arrives
+   *
+   *  @param localDir The directory files are stored to or read from. Names
+   * with a path in them are rejected.
+   *  @return ref to the enum DJI::OSDK::MOP::MopErrCode
+   */
+  MopErrCode serve(const std::string &localDir);
+
+  /*! Make the running transfer fail with MOP_FAILED, from any thread */
+  void cancel();
+
+  /*! Of the running transfer, or of the last one */
+  Stats getStats();
+
+ private:
+  MopPipeline *pipeline;
+  Config config;
+  ProgressCBType progressCb;
+  void *progressUserData;
+  std::atomic<bool> cancelReq;
+
+  std::mutex statsMutex;
+  Stats stats;
+  uint32_t startMs;
+  uint32_t lastProgressMs;
+  uint64_t rttTotalMs;
+
+  /*! Control packs, the largest one carries a FileInfo */
+  uint8_t ctrlBuf[sizeof(PackHeader) + sizeof(FileInfo)];
+
+  void resetStats(uint64_t fileSize, uint64_t offset);
+  void addRtt(uint32_t rttMs);
+  void addWait(uint32_t channelWaitMs, uint32_t diskWaitMs);
+  void reportProgress(bool finished);
+
+  MopErrCode sendPack(uint8_t cmd, uint8_t subcmd, const void *data,
+                      uint32_t len);
+  /*! Next pack of the peer of at least a header, retried until timeoutMs */
+  MopErrCode recvPack(uint8_t *buf, uint32_t size, uint32_t &len);
+  MopErrCode recvCtrl(uint32_t &len);
+  /*! Send a control pack and wait for the answer of the peer in ctrlBuf */
+  MopErrCode request(uint8_t cmd, uint8_t subcmd, const void *data,
+                     uint32_t len, uint8_t answerCmd, uint32_t &answerLen);
+
+  MopErrCode hashFile(FILE *fp, uint32_t size, uint8_t md5[16]);
+  MopErrCode sendFileData(FILE *fp, uint32_t offset, uint32_t size);
+  MopErrCode recvFileData(FILE *fp, uint32_t offset, uint32_t size,
+                          const uint8_t md5[16]);
+
+  static bool isValidName(const std::string &name);
+  static MopErrCode getFileSize(FILE *fp, uint32_t &size);
+};
+
+}  // namespace OSDK
+}  // namespace DJI
+
+#endif  // DJI_MOP_FILE_TRANSFER_HPP
@@ -30,6 +30,7 @@
 #define DJI_MOP_PIPELINE_HPP
 
 #include <stdint.h>
+#include <atomic>
 #include "dji_mop_define.hpp"
 
 using namespace DJI::OSDK;
@@ -38,6 +39,8 @@ using namespace DJI::OSDK::MOP;
 namespace DJI {
 namespace OSDK {
 
+struct MopAsyncQueue;
+
 /*! @brief Class providing APIs & data structures MOP pipeline operations
  */
 class MopPipeline {
@@ -76,6 +79,120 @@ class MopPipeline {
    */
   MopErrCode recvData(DataPackType dataPacket, uint32_t *len);
 
+  /*! @brief Send one data packet gathered from several buffers
+   *
+   *  @platforms M300
+   *  @note This is a blocking api. The buffers go out as a single packet,
+   * like one sendData call. Buffers following each other in memory are
+   * sent in place. Others, e.g. a protocol header and a file chunk, are
+   * copied once into a buffer of the pipeline kept for the next calls, as
+   * the mop library only writes one contiguous buffer; the caller just
+   * needs no staging buffer of its own.
+   *  @param dataPackets Array of the buffers to send in order, ref to
+   * DJI::OSDK::MopPipeline::DataPackType
+   *  @param count Number of buffers in dataPackets
+   *  @param len The result of sent-byte counts will be returned by this
+   *  parameter
+   *  @return ref to the enum DJI::OSDK::MOP::MopErrCode
+   */
+  MopErrCode sendv(const DataPackType *dataPackets, uint32_t count, uint32_t *len);
+
+  /*! @brief Receive one data packet scattered over several buffers
+   *
+   *  @platforms M300
+   *  @note This is a blocking api. The buffers are filled in order, the
+   * last ones are left untouched if the packet is shorter. Buffers following
+   * each other in memory are read in place, otherwise the packet goes
+   * through the buffer of the pipeline, so this fails with MOP_RESBUSY while
+   * a recvLease is held.
+   *  @param dataPackets Array of the buffers to fill in order, ref to
+   * DJI::OSDK::MopPipeline::DataPackType
+   *  @param count Number of buffers in dataPackets
+   *  @param len The result of reveived-byte counts will be returned by this
+   *  parameter
+   *  @return ref to the enum DJI::OSDK::MOP::MopErrCode
+   */
+  MopErrCode recvv(const DataPackType *dataPackets, uint32_t count, uint32_t *len);
+
+  /*! @brief Receive one data packet into the buffer of the pipeline
+   *
+   *  @platforms M300
+   *  @note This is a blocking api. dataPacket is set to a view of the
+   * packet in the buffer of the pipeline, valid until releaseLease. A single
+   * lease is held at a time, the buffer is allocated by the first call and
+   * only grows afterwards, so a receive loop needs no buffer of its own.
+   *  @param maxLength Largest packet expected
+   *  @param dataPacket The view of the received packet, ref to
+   * DJI::OSDK::MopPipeline::DataPackType
+   *  @return ref to the enum DJI::OSDK::MOP::MopErrCode
+   */
+  MopErrCode recvLease(uint32_t maxLength, DataPackType *dataPacket);
+
+  /*! @brief Hand the packet of the last recvLease back to the pipeline
+   *
+   *  @platforms M300
+   */
+  void releaseLease();
+
+  /*! Completion of an asynchronous operation, len is the count of bytes sent
+   *  or received */
+  typedef void (*AsyncCBType)(MopErrCode errCode, DataPackType dataPacket,
+                              uint32_t len, void *userData);
+
+  /*! @brief Queue a send of the data packet to the pipeline
+   *
+   *  @platforms M300
+   *  @note This is a non-blocking api. The sends of a pipeline run one after
+   * the other in the order they were queued, on the workers of
+   * DJI::OSDK::MopEventLoop shared by all pipelines, and their callbacks run
+   * on a worker in the same order. dataPacket must stay valid until the
+   * callback. Do not mix with sendData/sendv while sends are queued.
+   *  @param dataPacket The data packet to be sent, ref to
+   * DJI::OSDK::MopPipeline::DataPackType
+   *  @param cb Called once the packet is sent or the send failed
+   *  @param userData Passed to cb
+   *  @param timeoutMs Fail with MOP_TIMEOUT after this long, 0 to keep trying
+   *  @return MOP_PASSED once queued, MOP_RESBUSY while getAsyncQueueDepth
+   * sends are queued already, ref to the enum DJI::OSDK::MOP::MopErrCode
+   */
+  MopErrCode sendDataAsync(DataPackType dataPacket, AsyncCBType cb,
+                           void *userData, uint32_t timeoutMs = 0);
+
+  /*! @brief Queue a receive of a data packet from the pipeline
+   *
+   *  @platforms M300
+   *  @note This is a non-blocking api, it works like sendDataAsync. A
+   * receive waiting for data gives the worker to other pipelines each time
+   * the read of the mop library times out. Do not mix with
+   * recvData/recvv/recvLease while receives are queued.
+   *  @param dataPacket The buffer to receive to, ref to
+   * DJI::OSDK::MopPipeline::DataPackType
+   *  @param cb Called once a packet is received or the receive failed
+   *  @param userData Passed to cb
+   *  @param timeoutMs Fail with MOP_TIMEOUT after this long, 0 to wait for
+   * a packet
+   *  @return MOP_PASSED once queued, MOP_RESBUSY while getAsyncQueueDepth
+   * receives are queued already, ref to the enum DJI::OSDK::MOP::MopErrCode
+   */
+  MopErrCode recvDataAsync(DataPackType dataPacket, AsyncCBType cb,
+                           void *userData, uint32_t timeoutMs = 0);
+
+  /*! @brief Set how many operations of each direction may be queued, 8 by
+   * default. To be set while none are queued.
+   *
+   *  @platforms M300
+   */
+  void setAsyncQueueDepth(uint32_t depth);
+  uint32_t getAsyncQueueDepth();
+
+  /*! @brief Drop the queued operations, their callbacks run from here with
+   * MOP_FAILED, and wait for the running ones. Also done when the pipeline is
+   * deleted, which must not happen from one of its callbacks.
+   *
+   *  @platforms M300
+   */
+  void cancelAsync();
+
   void *channelHandle;
 
   /*! @brief Get the pipeline id of the pipeline
@@ -95,6 +212,25 @@ class MopPipeline {
   PipelineID id;
   PipelineType type;
 
+  /*! Buffers owned by the pipeline, one per direction so that a sending
+   *  and a receiving thread do not share one */
+  typedef struct PipelineBuffer {
+    uint8_t *data;
+    uint32_t size;
+  } PipelineBuffer;
+  PipelineBuffer txBuf;
+  PipelineBuffer rxBuf;
+  /*! rxBuf is in use by a lease or a recvv. Claimed atomically, so a second
+   *  receiving thread gets MOP_RESBUSY instead of sharing rxBuf. */
+  std::atomic<bool> leased;
+
+  MopAsyncQueue *txQueue;
+  MopAsyncQueue *rxQueue;
+
+  static bool reserveBuffer(PipelineBuffer &buf, uint32_t size);
+  /*! Start of the buffers if they follow each other in memory, else NULL */
+  static uint8_t *getContiguous(const DataPackType *dataPackets,
+                                uint32_t count, uint64_t &total);
 };
 }  // namespace OSDK
 }  // namespace DJI
@@ -33,6 +33,7 @@
 #include "dji_mop_pipeline.hpp"
 #include "dji_log.hpp"
 #include <map>
+#include <mutex>
 
 using namespace DJI::OSDK;
 using namespace DJI::OSDK::MOP;
@@ -41,6 +42,8 @@ using namespace std;
 
 /*! TODO:ugly code, will be fixed in the future */
 extern map<PipelineID, MopPipeline*> pipelineMap;
+/*! Guards pipelineMap, the non-blocking apis use it from several workers */
+extern std::mutex pipelineMapMutex;
 
 namespace DJI {
 namespace OSDK {
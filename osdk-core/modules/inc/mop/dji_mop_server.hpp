@@ -61,6 +61,30 @@ class MopServer : MopPipelineManagerBase {
    */
   MopErrCode accept(PipelineID id, PipelineType type, MopPipeline *&p);
 
+  /*! @brief Accept the connecting request from target device with properties of
+   * a pipelineid and pipeline type. If success, a pipeline object will be
+   * created.
+   *
+   *  @platforms M300
+   *  @note This is a non-blocking api. The blocking accept runs as a job of
+   * DJI::OSDK::MopEventLoop and cb is called from its worker, so the server
+   * has to live until then.
+   *  @param id The pipeline id which to be connected, ref to
+   * DJI::OSDK::MOP::PipelineID
+   *  @param type The pipeline type. It can be set to be RELIABLE or UBRELIABLE
+   *  ref to the enum DJI::OSDK::MOP::PipelineType
+   *  @param cb Callback function defined by user
+   *  @arg @b errCode is the DJI::OSDK::MOP::MopErrCode error code
+   *  @arg @b p The pointer of pipeline. If success, it will be pointed to be the
+   *  target pipeline object.
+   *  @arg @b userData the interface to pass userData in when the callback is
+   * called
+   *  @param userData when UserCallBack is called, used in UserCallBack
+   */
+  void accept(PipelineID id, PipelineType type,
+              void (*cb)(MopErrCode errCode, MopPipeline *p, void *userData),
+              void *userData);
+
   /*! @brief Close the target pipeline by a pipelineid.
    *
    *  @platforms M300
@@ -70,6 +94,21 @@ class MopServer : MopPipelineManagerBase {
    *  @return ref to the enum DJI::OSDK::MOP::MopErrCode
    */
   MopErrCode close(PipelineID id);
+
+  /*! @brief Close the target pipeline by a pipelineid.
+   *
+   *  @platforms M300
+   *  @note This is a non-blocking api, run like the non-blocking accept
+   *  @param id The pipeline id which to be connected, ref to
+   * DJI::OSDK::MOP::PipelineID
+   *  @param cb Callback function defined by user
+   *  @arg @b errCode is the DJI::OSDK::MOP::MopErrCode error code
+   *  @arg @b userData the interface to pass userData in when the callback is
+   * called
+   *  @param userData when UserCallBack is called, used in UserCallBack
+   */
+  void close(PipelineID id, void (*cb)(MopErrCode errCode, void *userData),
+             void *userData);
  private:
   Vehicle *vehicle;
 };
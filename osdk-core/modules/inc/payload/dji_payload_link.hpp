@@ -49,7 +49,8 @@ class PayloadLink {
    *  @param pdata data buf which should be send
    *  @param len the total bytes length of the pdata
    *  @param callBack callback for this send
-   *  @param userData userData which will called by callBack
+   *  @param userData userData which will called by callBack, it must come
+   *  from AsyncContextPool and is released once the request completes
    */
   void sendAsync(const uint8_t cmd[], void *pdata, size_t len, void *callBack,
                  UserData userData, int timeout = 500, int retry_time = 2);
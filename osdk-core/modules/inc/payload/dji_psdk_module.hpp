@@ -207,7 +207,6 @@ class PSDKModule : public PayloadBase {
   ErrorCode::ErrorCodeType sendDataToPSDK(uint8_t *data, uint16_t len);
 
  private:
-  static const int maxSize = 32;
 #if defined(__linux__)
   MopClient *mopClient;
 #endif
@@ -233,12 +232,8 @@ class PSDKModule : public PayloadBase {
     UserData userData;
   } UCBRetCodeHandler;
 
-  /*! @brief memory space used to temporarily stash the handler in the async
-   * process */
-  UCBRetCodeHandler ucbHandler[maxSize];
-
   /*! @brief alloc space used to temporarily stash the handler in the async
-   * process */
+   * process, from AsyncContextPool */
   UCBRetCodeHandler *allocUCBHandler(void *callback, UserData userData);
 
   static void widgetValueDecoder(Vehicle *vehicle, RecvContainer recvFrame,
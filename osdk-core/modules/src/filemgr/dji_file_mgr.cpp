@@ -28,6 +28,7 @@
 
 #include "dji_file_mgr.hpp"
 #include "dji_file_mgr_impl.hpp"
+#include "dji_file_batch_downloader.hpp"
 #include "dji_linker.hpp"
 #include "dji_linker.hpp"
 #include "osdk_device_id.h"
@@ -39,23 +40,60 @@
 using namespace DJI;
 using namespace DJI::OSDK;
 
-FileMgr::FileMgr(Linker *linker) {
-  impl = new FileMgrImpl(linker);
+FileMgr::FileMgr(Linker *linker) : linker(linker) {
+  batch = new FileBatchDownloader(this);
 }
 
 FileMgr::~FileMgr(){
-  if (impl)delete impl;
+  if (batch) delete batch;
+  for (auto &it : impls) delete it.second;
+}
+
+FileMgrImpl *FileMgr::getImpl(E_OSDKCommandDeiveType type, uint8_t index) {
+  std::lock_guard<std::mutex> lock(implsMutex);
+  uint16_t key = (uint16_t)((type << 8) | index);
+  auto it = impls.find(key);
+  if (it != impls.end()) return it->second;
+
+  FileMgrImpl *impl = new FileMgrImpl(linker);
+  impl->setTargetDevice(type, index);
+  impls[key] = impl;
+  return impl;
 }
 
 ErrorCode::ErrorCodeType FileMgr::startReqFileList(E_OSDKCommandDeiveType type,
                           uint8_t index, FileListReqCBType cb, void* userData) {
-  impl->setTargetDevice(type, index);
-  return impl->startReqFileList(cb, userData);
+  return getImpl(type, index)->startReqFileList(cb, userData);
 }
 
 ErrorCode::ErrorCodeType FileMgr::startReqFileData(E_OSDKCommandDeiveType type,
                           uint8_t index, int fileIndex, std::string localPath,
                           FileDataReqCBType cb, void* userData) {
-  impl->setTargetDevice(type, index);
-  return impl->startReqFileData(fileIndex, localPath, cb, userData);
+  return getImpl(type, index)->startReqFileData(fileIndex, localPath, cb, userData);
+}
+
+ErrorCode::ErrorCodeType FileMgr::startResumeFileData(E_OSDKCommandDeiveType type,
+                          uint8_t index, int fileIndex, std::string localPath,
+                          FileDataReqCBType cb, void* userData) {
+  return getImpl(type, index)->startResumeFileData(fileIndex, localPath, cb, userData);
+}
+
+ErrorCode::ErrorCodeType FileMgr::startReqFileListStream(E_OSDKCommandDeiveType type,
+                          uint8_t index, const FileListFilter &filter,
+                          FileListBatchCBType cb, void* userData) {
+  return getImpl(type, index)->startReqFileListStream(filter, cb, userData);
+}
+
+ErrorCode::ErrorCodeType FileMgr::startBatchDownload(
+    const std::vector<DownloadJob> &jobs, BatchFileCBType fileCb,
+    BatchProgressCBType progressCb, void* userData) {
+  return batch->start(jobs, fileCb, progressCb, userData);
+}
+
+void FileMgr::cancelBatchDownload() {
+  batch->cancel();
+}
+
+bool FileMgr::isBatchDownloading() {
+  return batch->isRunning();
 }
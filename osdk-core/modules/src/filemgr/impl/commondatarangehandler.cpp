@@ -62,7 +62,7 @@ void CommonDataRangeHandler::AddSeqIndex(uint32_t seqNum, uint32_t confirmSeq, u
                         Range rangeLeft = {range->seq_num, seqNum - range->seq_num};
                         Range rangeRight = {seqNum + 1, range->seq_num + range->length - seqNum - 1};
                         *range = rangeLeft;
-                        m_noAckRanges.insert(range, rangeRight);
+                        m_noAckRanges.insert(range + 1, rangeRight);
                         break;
                     } else if (range->seq_num + range->length - 1 == seqNum) {
                         // 等于当前Range最大值
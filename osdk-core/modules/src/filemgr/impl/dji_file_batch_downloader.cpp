@@ -0,0 +1,266 @@
+/** @file dji_file_batch_downloader.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief Scheduler running batch downloads over several devices at once
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "dji_file_batch_downloader.hpp"
+#include "dji_file_mgr_impl.hpp"
+#include "dji_platform.hpp"
+#include "dji_log.hpp"
+
+using namespace DJI;
+using namespace DJI::OSDK;
+
+#define BATCH_PROGRESS_PERIOD_MS 1000
+
+FileBatchDownloader::FileBatchDownloader(FileMgr *mgr)
+    : mgr(mgr), fileCb(NULL), progressCb(NULL), userData(NULL),
+      finishedBytes(0), running(false), cancelReq(false), taskHandle(NULL) {
+  memset(&progress, 0, sizeof(progress));
+}
+
+FileBatchDownloader::~FileBatchDownloader() {
+  cancel();
+  {
+    std::unique_lock<std::mutex> lock(doneMutex);
+    doneCond.wait(lock, [this] { return !running; });
+  }
+  if (taskHandle) OsdkOsal_TaskDestroy(taskHandle);
+}
+
+ErrorCode::ErrorCodeType FileBatchDownloader::start(
+    const std::vector<FileMgr::DownloadJob> &jobs,
+    FileMgr::BatchFileCBType fileCb, FileMgr::BatchProgressCBType progressCb,
+    void *userData) {
+  if (jobs.empty()) return ErrorCode::SysCommonErr::InstInitParamInvalid;
+  bool expected = false;
+  if (!running.compare_exchange_strong(expected, true)) {
+    DERROR("A batch download is running already.");
+    return ErrorCode::CameraCommonErr::InvalidState;
+  }
+
+  /*! The task of the last batch has cleared running and is returning */
+  if (taskHandle) {
+    OsdkOsal_TaskDestroy(taskHandle);
+    taskHandle = NULL;
+  }
+
+  this->jobs = jobs;
+  this->fileCb = fileCb;
+  this->progressCb = progressCb;
+  this->userData = userData;
+  memset(&progress, 0, sizeof(progress));
+  progress.filesTotal = jobs.size();
+  finishedBytes = 0;
+  cancelReq = false;
+
+  /*! One lane per device, the jobs of a lane keep their order */
+  for (uint32_t i = 0; i < jobs.size(); i++) {
+    FileMgrImpl *impl = mgr->getImpl(jobs[i].type, jobs[i].index);
+    Lane *lane = NULL;
+    for (auto l : lanes) {
+      if (l->impl == impl) {
+        lane = l;
+        break;
+      }
+    }
+    if (!lane) {
+      lane = new Lane();
+      lane->impl = impl;
+      lane->active = -1;
+      lane->activeStartMs = 0;
+      lane->finished = false;
+      lane->result = OSDK_STAT_OK;
+      lane->owner = this;
+      lanes.push_back(lane);
+    }
+    lane->pending.push_back(i);
+  }
+  DSTATUS("Batch download of %u files over %u devices", progress.filesTotal,
+          (uint32_t)lanes.size());
+
+  if (OsdkOsal_TaskCreate(&taskHandle, batchTask,
+                          OSDK_TASK_STACK_SIZE_DEFAULT, this) != OSDK_STAT_OK) {
+    DERROR("Create batch download task failed.");
+    for (auto lane : lanes) delete lane;
+    lanes.clear();
+    taskHandle = NULL;
+    std::lock_guard<std::mutex> lock(doneMutex);
+    running = false;
+    doneCond.notify_all();
+    return ErrorCode::SysCommonErr::AllocMemoryFailed;
+  }
+  return ErrorCode::SysCommonErr::Success;
+}
+
+void FileBatchDownloader::cancel() {
+  if (running) cancelReq = true;
+}
+
+bool FileBatchDownloader::isRunning() {
+  return running;
+}
+
+void *FileBatchDownloader::batchTask(void *arg) {
+  if (arg) ((FileBatchDownloader *)arg)->run();
+  return NULL;
+}
+
+void FileBatchDownloader::fileDataReqCB(E_OsdkStat ret_code, void *userData) {
+  Lane *lane = (Lane *)userData;
+  if (!lane) return;
+  lane->result = ret_code;
+  lane->finished = true;
+}
+
+bool FileBatchDownloader::startNext(Lane *lane) {
+  /*! The device may still be busy with a request of the user */
+  if (!lane->impl->isIdle()) return false;
+
+  uint32_t jobIndex = lane->pending.front();
+  lane->pending.pop_front();
+  const FileMgr::DownloadJob &job = jobs[jobIndex];
+
+  lane->active = jobIndex;
+  lane->finished = false;
+  OsdkOsal_GetTimeMs(&lane->activeStartMs);
+  DSTATUS("Batch job %u : file %d of device %d-%d to %s", jobIndex,
+          job.fileIndex, job.type, job.index, job.localPath.c_str());
+
+  ErrorCode::ErrorCodeType ret = lane->impl->startResumeFileData(
+      job.fileIndex, job.localPath, fileDataReqCB, lane);
+  if (ret != ErrorCode::SysCommonErr::Success) {
+    DERROR("Batch job %u failed to start", jobIndex);
+    ErrorCode::printErrorCodeMsg(ret);
+    /*! Ends in fileDataReqCB if the request got as far as being sent */
+    lane->impl->stopReqFileData();
+    if (!lane->finished) finishActive(lane, OSDK_STAT_ERR);
+  }
+  return true;
+}
+
+void FileBatchDownloader::finishActive(Lane *lane, E_OsdkStat ret) {
+  uint64_t recvBytes = 0;
+  uint64_t fileSize = 0;
+  uint32_t jobIndex = lane->active;
+
+  lane->impl->getFileDataProgress(recvBytes, fileSize);
+  finishedBytes += recvBytes;
+  if (ret == OSDK_STAT_OK) {
+    progress.filesDone++;
+  } else {
+    progress.filesFailed++;
+  }
+  lane->active = -1;
+  lane->finished = false;
+
+  uint32_t curMs = 0;
+  OsdkOsal_GetTimeMs(&curMs);
+  DSTATUS("Batch job %u finished (%d), %llu bytes in %ums", jobIndex, ret,
+          (long long unsigned int)recvBytes, curMs - lane->activeStartMs);
+  if (fileCb) fileCb(ret, jobIndex, fileSize, userData);
+}
+
+uint64_t FileBatchDownloader::getBytesDone() {
+  uint64_t bytes = finishedBytes;
+  for (auto lane : lanes) {
+    if (lane->active >= 0) {
+      uint64_t recvBytes = 0;
+      uint64_t fileSize = 0;
+      lane->impl->getFileDataProgress(recvBytes, fileSize);
+      bytes += recvBytes;
+    }
+  }
+  return bytes;
+}
+
+void FileBatchDownloader::run() {
+  uint32_t startMs = 0;
+  uint32_t curMs = 0;
+  uint32_t lastReportMs = 0;
+  uint64_t lastReportBytes = 0;
+  PeriodicTimer pollTimer(10 * 1000);
+
+  OsdkOsal_GetTimeMs(&startMs);
+  lastReportMs = startMs;
+  for (;;) {
+    bool busy = false;
+    bool cancelling = cancelReq;
+
+    for (auto lane : lanes) {
+      if ((lane->active >= 0) && lane->finished) {
+        finishActive(lane, (E_OsdkStat)(int)lane->result);
+      }
+
+      if (cancelling) {
+        progress.filesFailed += lane->pending.size();
+        lane->pending.clear();
+        if (lane->active >= 0) {
+          lane->impl->stopReqFileData();
+          if (!lane->finished && lane->impl->isIdle()) {
+            finishActive(lane, OSDK_STAT_ERR);
+          }
+        }
+      }
+
+      if ((lane->active < 0) && !lane->pending.empty()) startNext(lane);
+      if ((lane->active >= 0) || !lane->pending.empty()) busy = true;
+    }
+
+    OsdkOsal_GetTimeMs(&curMs);
+    if (!busy || (curMs - lastReportMs >= BATCH_PROGRESS_PERIOD_MS)) {
+      uint64_t bytes = getBytesDone();
+      progress.bytesDone = bytes;
+      progress.elapsedMs = curMs - startMs;
+      progress.bytesPerSec =
+          (curMs > lastReportMs)
+              ? (uint32_t)((bytes - lastReportBytes) * 1000 /
+                           (curMs - lastReportMs))
+              : 0;
+      progress.avgBytesPerSec =
+          progress.elapsedMs
+              ? (uint32_t)(bytes * 1000 / progress.elapsedMs)
+              : 0;
+      lastReportMs = curMs;
+      lastReportBytes = bytes;
+
+      DSTATUS("\033[0;32m[Batch download] %u/%u files done, %u failed, "
+              "%u kB/s (avg %u kB/s)\033[0m",
+              progress.filesDone, progress.filesTotal, progress.filesFailed,
+              progress.bytesPerSec / 1000, progress.avgBytesPerSec / 1000);
+      if (progressCb) progressCb(progress, !busy, userData);
+    }
+
+    if (!busy) break;
+    pollTimer.wait();
+  }
+
+  for (auto lane : lanes) delete lane;
+  lanes.clear();
+  std::lock_guard<std::mutex> lock(doneMutex);
+  running = false;
+  doneCond.notify_all();
+}
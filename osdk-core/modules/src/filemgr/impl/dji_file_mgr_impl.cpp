@@ -35,17 +35,47 @@
 #include "osdk_protocol.h"
 #include "dji_internal_command.hpp"
 #include "dji_log.hpp"
+#include <iterator>
 
 using namespace DJI;
 using namespace DJI::OSDK;
 
 #define V1_HEADR_AND_CRC_LEN (11 + 2)
 
+/*! Packs kept while the offset they belong to is not known yet */
+#define FILE_DATA_EARLY_PACKS_MAX 512
+/*! How often the received ranges of a running download are saved */
+#define FILE_DATA_SAVE_INTERVAL_MS 2000
+#define FILE_DATA_PART_SUFFIX ".part"
+#define FILE_DATA_PART_MAGIC "OSDK-PART-1"
+/*! session_id of the file list requests, the file data ones count up from
+ *  the one after it */
+#define FILE_LIST_SESSION_ID 999
+/*! Range requests in a row asked for again without any data coming in */
+#define FILE_DATA_RESTART_MAX 3
+
+/*! Files handed to a FileListBatchCBType at once if the filter leaves it 0 */
+#define FILE_LIST_BATCH_SIZE 32
+/*! amount and len of the list, then each entry without its ext data */
+#define FILE_LIST_HEADER_SIZE \
+  (sizeof(dji_file_list_download_resp) - sizeof(dji_list_info_descriptor))
+#define FILE_LIST_ITEM_SIZE \
+  (sizeof(dji_list_info_descriptor) - sizeof(dji_file_list_ext_info))
+
+typedef enum ParsingStateEnum {
+  PARSING_TOTAL_HEADER,
+  PARSING_DATA_HEADER,
+  PARSING_FILEINFO,
+  PARSING_FILEDATA = PARSING_FILEINFO,
+  PARSING_EXTINFO,
+  PARSE_FINISH,
+} ParsingFileListStateEnum, ParsingFileDataStateEnum;
+
 E_OsdkStat downloadFileAckCB(struct _CommandHandle *cmdHandle,
                                       const T_CmdInfo *cmdInfo,
                                       const uint8_t *cmdData,
-                                      void *userData) {
-  if ((!cmdInfo) || (!userData)){
+                                      void * /*userData*/) {
+  if (!cmdInfo) {
     DERROR("Recv Info is a null value");
     return OSDK_STAT_ERR;
   }
@@ -84,8 +114,8 @@ E_OsdkStat downloadFileAckCB(struct _CommandHandle *cmdHandle,
     /*! 4.Do V1 packet unpacking */
     if (V1_ops.Unpack(NULL, (uint8_t *) (cmdData + usedDataCnt), &V1_info, buffer)
         == OSDK_STAT_OK) {
-      FileMgrImpl *fileMgrImpl = (FileMgrImpl *) userData;
-      fileMgrImpl->HandlePushPack((dji_general_transfer_msg_ack *) buffer);
+      FileMgrImpl::dispatchPushPack(V1_info.sender,
+                                    (dji_general_transfer_msg_ack *) buffer);
       usedDataCnt += (V1_info.dataLen + V1_HEADR_AND_CRC_LEN);
     } else {
       DERROR("V1 unpack failed in downloading.");
@@ -102,10 +132,10 @@ void FileMgrImpl::printFileDownloadStatus() {
   uint32_t lossPackCnt = 0;
   uint32_t recvPackCnt = 0;
 
-  static uint64_t curFilePos = 0;
-  static uint64_t lastFilePos = 0;
-  static uint32_t curPrintMs = 0;
-  static uint32_t lastPrintMs = 0;
+  uint64_t curFilePos = 0;
+  uint64_t &lastFilePos = fileDataHandler->lastPrintFilePos;
+  uint32_t curPrintMs = 0;
+  uint32_t &lastPrintMs = fileDataHandler->lastPrintMs;
   char speedMsg[20] = {0};
 
   curFilePos = fileDataHandler->mmap_file_buffer_->curFilePos;
@@ -125,10 +155,10 @@ void FileMgrImpl::printFileDownloadStatus() {
   }
   recvPackCnt = fileDataHandler->range_handler_->GetLastNotReceiveSeq() - lossPackCnt;
   float finishPercent =
-    fileDataHandler->mmap_file_buffer_->fdAddrSize == 0
+    fileDataHandler->mmap_file_buffer_->fileSize == 0
       ? 0
       : (fileDataHandler->mmap_file_buffer_->curFilePos * 100.0f /
-         fileDataHandler->mmap_file_buffer_->fdAddrSize);
+         fileDataHandler->mmap_file_buffer_->fileSize);
   DSTATUS("\033[0;32m[Complete rate : %0.1f%%] (%s\t recv:\t%d packs\t loss:\t%d packs) \033[0m",
           finishPercent, speedMsg, recvPackCnt, lossPackCnt);
 }
@@ -141,6 +171,7 @@ void FileMgrImpl::fileListMonitorTask(void *arg) {
     uint32_t pollTimeMsInterval = 500;
     uint32_t taskTimeOutMs = 6000;
     FileMgrImpl *impl = (FileMgrImpl *)arg;
+    PeriodicTimer pollTimer(10 * 1000);
     OsdkOsal_GetTimeMs(&curTimeMs);
     impl->fileListHandler->updateTimeMs = curTimeMs;
     for (;;)
@@ -153,22 +184,18 @@ void FileMgrImpl::fileListMonitorTask(void *arg) {
         DSTATUS("curTimeMs:%u refreshTimeMs:%u", curTimeMs, refreshTimeMs);
         DERROR("downloadMonitorTask timeout!! device type : %d index: %d", impl->type, impl->index);
 
+        {
+          std::lock_guard<std::mutex> lock(impl->fileListHandler->listMutex);
           if (impl->fileListHandler->downloadState == RECVING_FILE_LIST) {
-            impl->SendAbortPack(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_LIST);
-            auto cb = impl->fileListHandler->reqCB;
-            void *udata = impl->fileListHandler->reqCBUserData;
-              FilePackage defaultPack;
-              defaultPack.type = FileType::UNKNOWN;
-              defaultPack.media.clear();
-              if(cb) cb(OSDK_STAT_ERR, defaultPack, udata);
+            impl->finishReqFileList(OSDK_STAT_ERR);
             DSTATUS("Finish req filelist task cause of timeout, reset downloadState to be DOWNLOAD_IDLE");
-            impl->fileListHandler->downloadState = DOWNLOAD_IDLE;
           }
+        }
       }
 
       if (impl->fileListHandler->downloadState == DOWNLOAD_IDLE) return;
 
-      OsdkOsal_TaskSleepMs(10);
+      pollTimer.wait();
     }
   } else {
     DERROR("task run failed because of the invalid"
@@ -184,16 +211,40 @@ void FileMgrImpl::fileDataMonitorTask(void *arg) {
     uint32_t preTimeMs = 0;
     uint32_t pollTimeMsInterval = 500;
     uint32_t taskTimeOutMs = 3000;
+    uint32_t saveTimeMs = 0;
     FileMgrImpl *impl = (FileMgrImpl *)arg;
+    uint32_t session = impl->fileDataHandler->session;
+    PeriodicTimer pollTimer(10 * 1000);
     OsdkOsal_GetTimeMs(&curTimeMs);
     OsdkOsal_GetTimeMs(&preTimeMs);
+    saveTimeMs = preTimeMs;
     impl->fileDataHandler->updateTimeMs = curTimeMs;
     for (;;)
     {
-      if (impl->fileDataHandler->downloadState == DOWNLOAD_IDLE) {
+      if ((impl->fileDataHandler->downloadState == DOWNLOAD_IDLE) ||
+          (impl->fileDataHandler->session != session)) {
         impl->printFileDownloadStatus();
+        PeriodicTimer::JitterStats stats = pollTimer.getStats();
+        if (stats.wakeUps) {
+          DDEBUG("filedata monitor %ums loop: %u wake ups, late avg %uus "
+                 "min %uus max %uus, %u periods missed",
+                 pollTimer.getPeriodUs() / 1000, stats.wakeUps,
+                 (uint32_t)(stats.sumLateUs / stats.wakeUps),
+                 stats.minLateUs, stats.maxLateUs, stats.missedPeriods);
+        }
         return;
       }
+      /*! The last request is complete but the file still has holes */
+      if (impl->fileDataHandler->nextRangeReq) {
+        impl->SendAbortPack(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_FILE);
+        ErrorCode::ErrorCodeType ret = impl->requestNextRange();
+        if (ret != ErrorCode::SysCommonErr::Success) {
+          ErrorCode::printErrorCodeMsg(ret);
+          impl->finishReqFileData(OSDK_STAT_ERR);
+        }
+        continue;
+      }
+
       uint32_t refreshTimeMs = impl->fileDataHandler->updateTimeMs;
       OsdkOsal_GetTimeMs(&curTimeMs);
 
@@ -203,12 +254,8 @@ void FileMgrImpl::fileDataMonitorTask(void *arg) {
         DERROR("downloadMonitorTask timeout!! device type : %d index: %d", impl->type, impl->index);
 
         if (impl->fileDataHandler->downloadState == RECVING_FILE_DATA) {
-          impl->SendAbortPack(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_FILE);
-          auto cb = impl->fileDataHandler->reqCB;
-          void *udata = impl->fileDataHandler->reqCBUserData;
-          if (cb) cb(OSDK_STAT_ERR, udata);
           DSTATUS("Finish req filedata task cause of timeout, reset downloadState to be DOWNLOAD_IDLE");
-          impl->fileDataHandler->downloadState = DOWNLOAD_IDLE;
+          impl->finishReqFileData(OSDK_STAT_ERR);
         }
       }
 
@@ -222,8 +269,12 @@ void FileMgrImpl::fileDataMonitorTask(void *arg) {
         preTimeMs = curTimeMs;
       }
 
-      /*! TODO: with out sleep 100ms, the time will get the same as last time. */
-      OsdkOsal_TaskSleepMs(10);
+      if (curTimeMs - saveTimeMs >= FILE_DATA_SAVE_INTERVAL_MS) {
+        impl->savePartFile();
+        saveTimeMs = curTimeMs;
+      }
+
+      pollTimer.wait();
     }
   } else {
     DERROR("task run failed because of the invalid"
@@ -231,6 +282,9 @@ void FileMgrImpl::fileDataMonitorTask(void *arg) {
   }
 }
 
+std::vector<FileMgrImpl *> FileMgrImpl::instances;
+std::mutex FileMgrImpl::instancesMutex;
+
 FileMgrImpl::FileMgrImpl(Linker *linker) : linker(linker) {
   type = OSDK_COMMAND_DEVICE_TYPE_NONE;
   index = 0;
@@ -241,7 +295,7 @@ FileMgrImpl::FileMgrImpl(Linker *linker) : linker(linker) {
   if (!registerCBFlag) {
     registerCBFlag = true;
     static T_RecvCmdItem bulkCmdList[] = {
-        PROT_CMD_ITEM(0, 0, V1ProtocolCMD::Common::downloadFileAck[0], V1ProtocolCMD::Common::downloadFileAck[1], MASK_HOST_DEVICE_SET_ID, this, downloadFileAckCB),
+        PROT_CMD_ITEM(0, 0, V1ProtocolCMD::Common::downloadFileAck[0], V1ProtocolCMD::Common::downloadFileAck[1], MASK_HOST_DEVICE_SET_ID, NULL, downloadFileAckCB),
     };
     T_RecvCmdHandle recvCmdHandle;
     recvCmdHandle.cmdList = bulkCmdList;
@@ -253,9 +307,21 @@ FileMgrImpl::FileMgrImpl(Linker *linker) : linker(linker) {
       DSTATUS("register download file callback handler successfully.");
     }
   }
+
+  std::lock_guard<std::mutex> lock(instancesMutex);
+  instances.push_back(this);
 }
 
 FileMgrImpl::~FileMgrImpl(){
+  {
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    for (auto it = instances.begin(); it != instances.end(); ++it) {
+      if (*it == this) {
+        instances.erase(it);
+        break;
+      }
+    }
+  }
   if (fileListHandler) {
     delete fileListHandler;
   }
@@ -265,7 +331,7 @@ FileMgrImpl::~FileMgrImpl(){
 }
 
 
-ErrorCode::ErrorCodeType FileMgrImpl::SendReqFileListPack() {
+ErrorCode::ErrorCodeType FileMgrImpl::SendReqFileListPack(uint32_t startIndex, uint16_t count) {
   uint8_t reqBuf[1024] = {0};
   dji_general_transfer_msg_req
       *setting = (dji_general_transfer_msg_req *) reqBuf;
@@ -274,13 +340,13 @@ ErrorCode::ErrorCodeType FileMgrImpl::SendReqFileListPack() {
   setting->task_id = DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_LIST;
   setting->func_id = DJI_GENERAL_DOWNLOAD_FILE_FUNC_TYPE_REQ;
   setting->msg_flag = 0;
-  setting->session_id = 999;
+  setting->session_id = FILE_LIST_SESSION_ID;
   setting->seq = 0;
 
   dji_file_list_download_req reqData = {0};
   reqData.index.drive = 0;
-  reqData.index.index = 1;
-  reqData.count = 0xffff;
+  reqData.index.index = startIndex;
+  reqData.count = count;
   reqData.type = DJI_MEDIA;
   uint32_t reqDataLen =
       sizeof(reqData) - sizeof(reqData.filter_enable)
@@ -320,7 +386,10 @@ ErrorCode::ErrorCodeType FileMgrImpl::SendReqFileListPack() {
                                  ErrorCode::CameraCommon, ackData[0]);
 }
 
-ErrorCode::ErrorCodeType FileMgrImpl::SendReqFileDataPack(int fileIndex) {
+ErrorCode::ErrorCodeType FileMgrImpl::SendReqFileDataPack(int fileIndex,
+                                                         uint16_t sessionId,
+                                                         uint32_t offset,
+                                                         uint32_t size) {
   uint8_t reqBuf[1024] = {0};
   dji_general_transfer_msg_req
       *setting = (dji_general_transfer_msg_req *) reqBuf;
@@ -329,7 +398,7 @@ ErrorCode::ErrorCodeType FileMgrImpl::SendReqFileDataPack(int fileIndex) {
   setting->task_id = DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_FILE;
   setting->func_id = DJI_GENERAL_DOWNLOAD_FILE_FUNC_TYPE_REQ;
   setting->msg_flag = 0;
-  setting->session_id = 999;
+  setting->session_id = sessionId;
   setting->seq = 0;
 
   dji_file_download_req reqData = {0};
@@ -338,8 +407,8 @@ ErrorCode::ErrorCodeType FileMgrImpl::SendReqFileDataPack(int fileIndex) {
   reqData.count = 1;
   reqData.type = DJI_MEDIA;
   reqData.sub_index = 0;
-  reqData.offset = 0;
-  reqData.size = (uint32_t) (-1);
+  reqData.offset = offset;
+  reqData.size = size;
   uint32_t reqDataLen = sizeof(reqData) - sizeof(reqData.ext_sub_index)
       - sizeof(reqData.seg_sub_index);
   memcpy(setting->data, &reqData, reqDataLen);
@@ -376,6 +445,43 @@ void FileMgrImpl::setTargetDevice(E_OSDKCommandDeiveType type, uint8_t index) {
   this->index = index;
 }
 
+bool FileMgrImpl::isIdle() {
+  return (fileListHandler->downloadState == DOWNLOAD_IDLE) &&
+         (fileDataHandler->downloadState == DOWNLOAD_IDLE);
+}
+
+void FileMgrImpl::getFileDataProgress(uint64_t &recvBytes, uint64_t &fileSize) {
+  recvBytes = fileDataHandler->mmap_file_buffer_->curFilePos;
+  fileSize = fileDataHandler->mmap_file_buffer_->fileSize;
+}
+
+void FileMgrImpl::stopReqFileData() {
+  if (fileDataHandler->downloadState == RECVING_FILE_DATA) {
+    DSTATUS("Stop req filedata task, reset downloadState to be DOWNLOAD_IDLE");
+    finishReqFileData(OSDK_STAT_ERR);
+  }
+}
+
+void FileMgrImpl::dispatchPushPack(uint8_t sender,
+                                   dji_general_transfer_msg_ack *rsp) {
+  FileMgrImpl *target = NULL;
+
+  /*! Not held while handling the pack, the user callbacks run from there
+   *  and may create new instances. */
+  instancesMutex.lock();
+  for (auto impl : instances) {
+    if (OSDK_COMMAND_DEVICE_ID(impl->type, impl->index) == sender) {
+      target = impl;
+      break;
+    }
+  }
+  instancesMutex.unlock();
+
+  /*! A pack from an id no instance talks to is dropped, with several
+   *  downloads running there is no telling whose file it belongs to. */
+  if (target) target->HandlePushPack(rsp);
+}
+
 FileMgrImpl::FileNameRule FileMgrImpl::getNameRule() {
   uint8_t   temp = 0;
   T_CmdInfo cmdInfo        = { 0 };
@@ -406,27 +512,50 @@ FileMgrImpl::FileNameRule FileMgrImpl::getNameRule() {
 }
 
 ErrorCode::ErrorCodeType FileMgrImpl::startReqFileList(FileMgr::FileListReqCBType cb, void* userData) {
+  FileMgr::FileListFilter filter = {};
+  return startFileList(filter, cb, NULL, userData);
+}
+
+ErrorCode::ErrorCodeType FileMgrImpl::startReqFileListStream(const FileMgr::FileListFilter &filter, FileMgr::FileListBatchCBType cb, void* userData) {
+  return startFileList(filter, NULL, cb, userData);
+}
+
+ErrorCode::ErrorCodeType FileMgrImpl::startFileList(const FileMgr::FileListFilter &filter, FileMgr::FileListReqCBType cb, FileMgr::FileListBatchCBType batchCb, void* userData) {
   if ((fileListHandler->downloadState == DOWNLOAD_IDLE) &&
       (fileDataHandler->downloadState == DOWNLOAD_IDLE)) {
     nameRule = getNameRule();
     fileListHandler->downloadState = RECVING_FILE_LIST;
     if (fileListHandler->download_buffer_) {
       fileListHandler->download_buffer_->Clear();
-      fileListHandler->download_buffer_->InitBufferQueue(5000, 0); //CSDK 5000
+      fileListHandler->download_buffer_->InitBufferQueue(DOWNLOAD_LIST_BUFFER_PACKS, 0);
     } else return ErrorCode::SysCommonErr::AllocMemoryFailed;
 
     if (fileListHandler->range_handler_) fileListHandler->range_handler_->DeInit();
     else return ErrorCode::SysCommonErr::AllocMemoryFailed;
 
+    DownloadListHandler *handler = fileListHandler;
+    handler->filter = filter;
+    handler->parseSeq = 0;
+    handler->lastPackSeq = -1;
+    handler->parseState = PARSING_DATA_HEADER;
+    handler->listAmount = 0;
+    handler->listLen = -1;
+    handler->parsedBytes = 0;
+    handler->need = FILE_LIST_HEADER_SIZE;
+    handler->carryLen = 0;
+    handler->package.type = FileType::UNKNOWN;
+    handler->package.media.clear();
+    handler->reqCB = cb;
+    handler->batchCB = batchCb;
+    handler->reqCBUserData = userData;
+
     /*! Create file list req task*/
     OsdkOsal_TaskCreate(&reqFileListHandle,
                         (void *(*)(void *)) (&fileListMonitorTask),
                         OSDK_TASK_STACK_SIZE_DEFAULT, this);
 
-    fileListHandler->reqCB = cb;
-    fileListHandler->reqCBUserData = userData;
-
-    return SendReqFileListPack();
+    return SendReqFileListPack(filter.startIndex ? filter.startIndex : 1,
+                               filter.count ? filter.count : 0xffff);
   } else {
     DERROR("Current state cannot support to do downloading ...");
     return ErrorCode::CameraCommonErr::InvalidState;
@@ -434,6 +563,14 @@ ErrorCode::ErrorCodeType FileMgrImpl::startReqFileList(FileMgr::FileListReqCBTyp
 }
 
 ErrorCode::ErrorCodeType FileMgrImpl::startReqFileData(int fileIndex, std::string localPath, FileMgr::FileDataReqCBType cb, void* userData) {
+  return startFileData(fileIndex, localPath, false, cb, userData);
+}
+
+ErrorCode::ErrorCodeType FileMgrImpl::startResumeFileData(int fileIndex, std::string localPath, FileMgr::FileDataReqCBType cb, void* userData) {
+  return startFileData(fileIndex, localPath, true, cb, userData);
+}
+
+ErrorCode::ErrorCodeType FileMgrImpl::startFileData(int fileIndex, std::string localPath, bool resume, FileMgr::FileDataReqCBType cb, void* userData) {
   if ((fileListHandler->downloadState == DOWNLOAD_IDLE) &&
     (fileDataHandler->downloadState == DOWNLOAD_IDLE)) {
     fileDataHandler->downloadState = RECVING_FILE_DATA;
@@ -445,23 +582,90 @@ ErrorCode::ErrorCodeType FileMgrImpl::startReqFileData(int fileIndex, std::strin
     fileDataHandler->reqCB = cb;
     fileDataHandler->reqCBUserData = userData;
     fileDataHandler->curTargetFileIndex = fileIndex;
+    fileDataHandler->lastPrintFilePos = 0;
+    fileDataHandler->lastPrintMs = 0;
+    fileDataHandler->nextRangeReq = false;
+    fileDataHandler->restartCnt = 0;
+    fileDataHandler->session++;
 
-    if (fileDataHandler->range_handler_)delete (fileDataHandler->range_handler_);
-    fileDataHandler->range_handler_ = new CommonDataRangeHandler();
-    if (!fileDataHandler->range_handler_) return ErrorCode::SysCommonErr::AllocMemoryFailed;
+    {
+      std::lock_guard<std::mutex> lock(fileDataHandler->dataMutex);
+      MmapFileBuffer *mfile = fileDataHandler->mmap_file_buffer_;
+      uint64_t fileSize = 0;
+      mfile->curFilePos = 0;
+      mfile->fileSize = 0;
+      fileDataHandler->recvRanges.clear();
+      if (resume && loadPartFile(fileIndex, fileSize) &&
+          mfile->init(localPath, fileSize)) {
+        DSTATUS("Resume %s, %llu of %llu bytes got already", localPath.c_str(),
+                (long long unsigned int)mfile->curFilePos,
+                (long long unsigned int)fileSize);
+      } else {
+        if (resume) DSTATUS("Nothing to resume for %s, download the whole file", localPath.c_str());
+        mfile->deInit();
+        mfile->curFilePos = 0;
+        mfile->fileSize = 0;
+        fileDataHandler->recvRanges.clear();
+        remove(getPartFilePath().c_str());
+      }
+      fileDataHandler->savedBytes = mfile->curFilePos;
+    }
 
     /*! Create file data req task */
     OsdkOsal_TaskCreate(&reqFileDataHandle,
                         (void *(*)(void *)) (&fileDataMonitorTask),
                         OSDK_TASK_STACK_SIZE_DEFAULT, this);
 
-    return SendReqFileDataPack(fileIndex);
+    return requestNextRange();
   } else {
     DERROR("Current state cannot support to do downloading ...");
     return ErrorCode::CameraCommonErr::InvalidState;
   }
 }
 
+/*! Ask for the first range the file is missing, the whole file as long as
+ *  its size is unknown. Finishes the download if nothing is missing. */
+ErrorCode::ErrorCodeType FileMgrImpl::requestNextRange() {
+  uint64_t offset = 0;
+  uint64_t size = (uint32_t)(-1);
+  uint16_t sessionId = 0;
+  {
+    std::lock_guard<std::mutex> lock(fileDataHandler->dataMutex);
+    if (fileDataHandler->mmap_file_buffer_->isOpen() &&
+        !findMissingRange(offset, size)) {
+      offset = size = 0;
+    }
+    fileDataHandler->range_handler_->DeInit();
+    fileDataHandler->earlyPacks.clear();
+    fileDataHandler->reqOffset = offset;
+    fileDataHandler->reqSize = size;
+    fileDataHandler->firstPackLen = -1;
+    fileDataHandler->packLen = 0;
+    fileDataHandler->lastPackSeq = -1;
+    fileDataHandler->lastSeq = 0;
+    fileDataHandler->reqStartBytes = fileDataHandler->mmap_file_buffer_->curFilePos;
+    sessionId = fileDataHandler->reqSessionId + 1;
+    if (sessionId <= FILE_LIST_SESSION_ID) sessionId = FILE_LIST_SESSION_ID + 1;
+    fileDataHandler->reqSessionId = sessionId;
+  }
+  if (!size) {
+    DSTATUS("The file is complete already.");
+    finishReqFileData(OSDK_STAT_OK);
+    return ErrorCode::SysCommonErr::Success;
+  }
+
+  uint32_t curMs = 0;
+  OsdkOsal_GetTimeMs(&curMs);
+  fileDataHandler->updateTimeMs = curMs;
+  fileDataHandler->nextRangeReq = false;
+
+  if (offset) DSTATUS("Request the range [%llu, %llu) of the file",
+                      (long long unsigned int)offset,
+                      (long long unsigned int)(offset + size));
+  return SendReqFileDataPack(fileDataHandler->curTargetFileIndex, sessionId,
+                             (uint32_t)offset, (uint32_t)size);
+}
+
 /**
 * 催促包只有3次，代表远程（eg.相机）已经发送完毕
 * 如果共计10个包出现  1 2 3 4 gap 6 7 empty 的情况
@@ -481,27 +685,6 @@ void FileMgrImpl::OnReceiveAbortPack(dji_general_transfer_msg_ack *rsp) {
           (int) rsp->session_id);
 }
 
-typedef enum ParsingStateEnum {
-  PARSING_TOTAL_HEADER,
-  PARSING_DATA_HEADER,
-  PARSING_FILEINFO,
-  PARSING_FILEDATA = PARSING_FILEINFO,
-  PARSE_FINISH,
-} ParsingFileListStateEnum, ParsingFileDataStateEnum;
-
-#include "dji_file_mgr_internal_define.hpp"
-FileMgrImpl::ConsumeDataBuffer FileMgrImpl::ConsumeChunk(DataPointer data_pointer, size_t &chunk_index, size_t consumSize) {
-  ConsumeDataBuffer ret = {{0}, 0};
-  if (consumSize > sizeof(ret.data))
-    consumSize = sizeof(ret.data);
-  if (consumSize > data_pointer.length - chunk_index)
-    consumSize = data_pointer.length - chunk_index;
-  memcpy(ret.data, (uint8_t *)data_pointer.data + chunk_index, consumSize);
-  ret.index = consumSize;
-  chunk_index += consumSize;
-  return ret;
-}
-
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -577,332 +760,555 @@ std::string FileMgrImpl::GetSuffixByFileType(MediaFileType type) {
   return unsupportFileName;
 }
 
-FilePackage FileMgrImpl::parseFileList(std::list<DataPointer> fullDataList) {
-  const uint32_t maxDataFrameLen = 1024; //link data frame max size
-  size_t chunk_index = 0;
-  FilePackage pack;
-  pack.type = FileType::UNKNOWN;
-  //pack.common.clear();
-  pack.media.clear();
-  if (fullDataList.size() == 0) return pack;
-  auto dataFront = fullDataList.front();
-  if (dataFront.length < (sizeof(dji_general_transfer_msg_ack) - 1
-      + sizeof(dji_file_list_download_resp) - sizeof(dji_list_info_descriptor)))
-    return pack;
-
-  /*! Parse file list total info */
-  auto listdata = (dji_file_list_download_resp *)((uint8_t *)dataFront.data + sizeof(dji_general_transfer_msg_ack) - 1);
-  DSTATUS("###data->amount = %d, data->len = %d", listdata->amount, listdata->len);
-//   if (listdata->len > fullDataList.size() * maxDataFrameLen) {
-//     DERROR("File list total data len error !");
-//     return pack;
-//   }
-
-  /*! Make the total data buffer */
-  DataPointer dataPtr = {malloc(listdata->len), 0};
-  if (!dataPtr.data) {
-    DERROR("Malloc error !");
-    return pack;
-  }
-  while (fullDataList.size() != 0) {
-    auto f = fullDataList.front();
+bool FileMgrImpl::parseFileList(DownloadBufferQueue *queue) {
+  DownloadListHandler *handler = fileListHandler;
+  /*! Packs are decoded straight out of the slots of the queue */
+  for (DataPointer f; (f = queue->FrontBuffer()).data;) {
     auto pack = (dji_general_transfer_msg_ack *)(f.data);
-    int cpSize = pack->msg_length - sizeof(dji_general_transfer_msg_ack) + 1;
-
-    memcpy((uint8_t *) dataPtr.data + dataPtr.length, pack->data, cpSize);
-    dataPtr.length += cpSize;
-    fullDataList.pop_front();
+    int len = (int)pack->msg_length - (int)sizeof(dji_general_transfer_msg_ack) + 1;
+    if (len > f.length - (int)sizeof(dji_general_transfer_msg_ack) + 1)
+      len = f.length - (int)sizeof(dji_general_transfer_msg_ack) + 1;
+    if (len > 0) parseFileListData(pack->data, len);
+    queue->PopBuffer();
+    if ((int64_t)(handler->parseSeq++) == handler->lastPackSeq) return true;
   }
+  return false;
+}
 
-  /*! Parsing dataPtr */
-  ParsingFileListStateEnum parsingState = PARSING_TOTAL_HEADER;
-    while (parsingState != PARSE_FINISH) {
-      switch (parsingState) {
-        case PARSING_TOTAL_HEADER: {
-          /*! dataPtr skip it */
-          parsingState = PARSING_DATA_HEADER;
-          break;
-        }
-        case PARSING_DATA_HEADER: {
-          uint32_t consumeBytes = sizeof(dji_file_list_download_resp)
-              - sizeof(dji_list_info_descriptor);
-          auto buffer = ConsumeChunk(dataPtr, chunk_index, consumeBytes);
-          if (buffer.index == consumeBytes) {
-            parsingState = PARSING_FILEINFO;
-          } else {
-            parsingState = PARSE_FINISH;
-          }
-          break;
+void FileMgrImpl::parseFileListData(const uint8_t *data, uint32_t len) {
+  DownloadListHandler *handler = fileListHandler;
+  while (len && (handler->parseState != PARSE_FINISH)) {
+    /*! Bytes past the length given by the header are padding */
+    uint32_t take = handler->need - handler->carryLen;
+    if (handler->listLen >= 0) {
+      if (handler->parsedBytes >= handler->listLen) {
+        handler->parseState = PARSE_FINISH;
+        break;
+      }
+      if (take > handler->listLen - handler->parsedBytes)
+        take = handler->listLen - handler->parsedBytes;
+    }
+    if (take > len) take = len;
+
+    const uint8_t *item = NULL;
+    if (handler->parseState == PARSING_EXTINFO) {
+      /*! Not decoded for now, only counted */
+      handler->carryLen += take;
+    } else if (!handler->carryLen && (take == handler->need)) {
+      item = data;
+    } else {
+      memcpy(handler->carry + handler->carryLen, data, take);
+      handler->carryLen += take;
+    }
+    data += take;
+    len -= take;
+    handler->parsedBytes += take;
+
+    if (!item) {
+      if (handler->carryLen < handler->need) continue;
+      item = handler->carry;
+    }
+    handler->carryLen = 0;
+
+    switch (handler->parseState) {
+      case PARSING_DATA_HEADER: {
+        auto listdata = (const dji_file_list_download_resp *)item;
+        DSTATUS("###data->amount = %d, data->len = %d", listdata->amount, listdata->len);
+        handler->listAmount = listdata->amount;
+        handler->listLen = listdata->len;
+        handler->parseState = PARSING_FILEINFO;
+        handler->need = FILE_LIST_ITEM_SIZE;
+        break;
+      }
+      case PARSING_FILEINFO: {
+        auto desc = (const dji_list_info_descriptor *)item;
+        FilePackage &pack = handler->package;
+        if (pack.type == FileType::UNKNOWN) pack.type = FileType::MEDIA;
+        MediaFile file;
+        if (buildMediaFile(desc, file) && matchFileListFilter(file)) {
+          pack.media.push_back(file);
+          uint16_t batchSize = handler->filter.batchSize
+                               ? handler->filter.batchSize
+                               : FILE_LIST_BATCH_SIZE;
+          if (handler->batchCB && (pack.media.size() >= batchSize))
+            flushFileListBatch(OSDK_STAT_OK, false);
         }
-        case PARSING_FILEINFO: {
-          uint32_t consumeBytes =
-              sizeof(dji_list_info_descriptor) - sizeof(dji_file_list_ext_info);
-          auto buffer = ConsumeChunk(dataPtr, chunk_index, consumeBytes);
-          if (buffer.index == consumeBytes) {
-            if (pack.type == FileType::UNKNOWN)pack.type = FileType::MEDIA;
-            auto data = (dji_list_info_descriptor *) (buffer.data);
-            //DSTATUS("data->index = %d, data->size = %d", data->index, data->size);
-            /*! 构建file信息,装入容器 */
-            MediaFile file = {0};
-            file.valid = true;
-            file.date.year = data->create_time.year + 1980;
-            file.date.month = data->create_time.month;
-            file.date.day = data->create_time.day;
-            file.date.hour = data->create_time.hour;
-            file.date.minute = data->create_time.minute;
-            file.date.second = data->create_time.second * 2;
-            file.fileIndex = data->index;
-            file.fileSize = data->size;
-            file.fileType = (MediaFileType) data->type;
-            if ((data->type == (uint8_t) MediaFileType::MOV)
-                || (data->type == (uint8_t) MediaFileType::MP4)) {
-              file.duration =
-                  data->attribute.video_attribute.attribute_video_duration;
-              file.orientation =
-                  (CameraOrientation) data->attribute.video_attribute.attribute_video_rotation;
-              file.resolution =
-                  (VideoResolution) data->attribute.video_attribute.attribute_video_resolution;
-              file.frameRate =
-                  (VideoFrameRate) data->attribute.video_attribute.attribute_video_framerate;
-            } else if ((data->type == (uint8_t) MediaFileType::JPEG)
-                || (data->type == (uint8_t) MediaFileType::DNG)
-                || (data->type == (uint8_t) MediaFileType::TIFF)) {
-              file.orientation =
-                  (CameraOrientation) data->attribute.photo_attribute.attribute_photo_rotation;
-              file.photoRatio =
-                  (PhotoRatio) data->attribute.photo_attribute.attribute_photo_ratio;
-            }
-            file.fileName = GetFileName(file);
-
-            bool validFlagBasic = true;
-            bool validFlagNew = true;
-            if (nameRule == H20_RULE) {
-              if ((GetSuffixByFileType(file.fileType) != unsupportFileName) &&
-                  (GetFileCameraType(file.fileIndex)
-                      != unsupportFileCameraType))
-                validFlagNew = true;
-              else
-                validFlagNew = false;
-            }
-
-            if ((file.valid)
-                && (file.fileSize > 0))// && (file.date.year != 1980))
-              validFlagBasic = true;
-            else
-              validFlagBasic = false;
-
-            if (validFlagNew && validFlagBasic)
-              pack.media.push_back(file);
-
-            /*! 这部分消耗了就算了,目前不解析 */
-            if (data->ext_size) {
-              auto extBuffer =
-                  ConsumeChunk(dataPtr, chunk_index, data->ext_size);
-              //auto extData = (dji_ext_info_descriptor *) (extBuffer.data);
-              //DSTATUS("extData->id = %d, %s", extData->id, extData->data);
-            }
-            parsingState = PARSING_FILEINFO;
-          } else {
-            //DSTATUS("---chunk_index = %d", chunk_index);
-            parsingState = PARSE_FINISH;
-          }
-          break;
+        /*! 这部分消耗了就算了,目前不解析 */
+        if (desc->ext_size) {
+          handler->parseState = PARSING_EXTINFO;
+          handler->need = desc->ext_size;
         }
-        case PARSE_FINISH:
-          break;
-        default:break;
+        break;
       }
+      case PARSING_EXTINFO:
+        handler->parseState = PARSING_FILEINFO;
+        handler->need = FILE_LIST_ITEM_SIZE;
+        break;
+      default:
+        break;
     }
-  free(dataPtr.data);
-  return pack;
+  }
 }
 
-#define SIZE_LIMIT 0
-bool FileMgrImpl::parseFileData(dji_general_transfer_msg_ack *rsp) {
-  MmapFileBuffer *mfile = fileDataHandler->mmap_file_buffer_;
+bool FileMgrImpl::buildMediaFile(const dji_list_info_descriptor *data, MediaFile &file) {
+  //DSTATUS("data->index = %d, data->size = %d", data->index, data->size);
+  /*! 构建file信息 */
+  file = {0};
+  file.valid = true;
+  file.date.year = data->create_time.year + 1980;
+  file.date.month = data->create_time.month;
+  file.date.day = data->create_time.day;
+  file.date.hour = data->create_time.hour;
+  file.date.minute = data->create_time.minute;
+  file.date.second = data->create_time.second * 2;
+  file.fileIndex = data->index;
+  file.fileSize = data->size;
+  file.fileType = (MediaFileType) data->type;
+  if ((data->type == (uint8_t) MediaFileType::MOV)
+      || (data->type == (uint8_t) MediaFileType::MP4)) {
+    file.duration =
+        data->attribute.video_attribute.attribute_video_duration;
+    file.orientation =
+        (CameraOrientation) data->attribute.video_attribute.attribute_video_rotation;
+    file.resolution =
+        (VideoResolution) data->attribute.video_attribute.attribute_video_resolution;
+    file.frameRate =
+        (VideoFrameRate) data->attribute.video_attribute.attribute_video_framerate;
+  } else if ((data->type == (uint8_t) MediaFileType::JPEG)
+      || (data->type == (uint8_t) MediaFileType::DNG)
+      || (data->type == (uint8_t) MediaFileType::TIFF)) {
+    file.orientation =
+        (CameraOrientation) data->attribute.photo_attribute.attribute_photo_rotation;
+    file.photoRatio =
+        (PhotoRatio) data->attribute.photo_attribute.attribute_photo_ratio;
+  }
+  file.fileName = GetFileName(file);
+
+  bool validFlagBasic = true;
+  bool validFlagNew = true;
+  if (nameRule == H20_RULE) {
+    if ((GetSuffixByFileType(file.fileType) != unsupportFileName) &&
+        (GetFileCameraType(file.fileIndex)
+            != unsupportFileCameraType))
+      validFlagNew = true;
+    else
+      validFlagNew = false;
+  }
+
+  if ((file.valid)
+      && (file.fileSize > 0))// && (file.date.year != 1980))
+    validFlagBasic = true;
+  else
+    validFlagBasic = false;
+
+  return validFlagNew && validFlagBasic;
+}
+
+/*! Orders dates the way they read, seconds resolution */
+static int64_t dateToSeconds(const DateTime &date) {
+  return (((((int64_t)date.year * 12 + date.month) * 31 + date.day) * 24
+           + date.hour) * 60 + date.minute) * 60 + date.second;
+}
+
+bool FileMgrImpl::matchFileListFilter(const MediaFile &file) {
+  const FileMgr::FileListFilter &filter = fileListHandler->filter;
+  if (filter.typeMask) {
+    int type = (int)file.fileType;
+    if ((type < 0) || (type >= 32) || !(filter.typeMask & (1u << type)))
+      return false;
+  }
+  if (file.fileIndex < filter.minFileIndex) return false;
+  if (filter.maxFileIndex && (file.fileIndex > filter.maxFileIndex))
+    return false;
+  if (filter.dateFrom.year
+      && (dateToSeconds(file.date) < dateToSeconds(filter.dateFrom)))
+    return false;
+  if (filter.dateTo.year
+      && (dateToSeconds(file.date) > dateToSeconds(filter.dateTo)))
+    return false;
+  return true;
+}
+
+void FileMgrImpl::flushFileListBatch(E_OsdkStat ret, bool finished) {
+  DownloadListHandler *handler = fileListHandler;
+  if (handler->batchCB)
+    handler->batchCB(ret, handler->package.media, handler->listAmount,
+                     finished, handler->reqCBUserData);
+  handler->package.media.clear();
+}
+
+void FileMgrImpl::finishReqFileList(E_OsdkStat ret) {
+  DownloadListHandler *handler = fileListHandler;
+  SendAbortPack(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_LIST);
+  if (handler->batchCB) {
+    flushFileListBatch(ret, true);
+    handler->batchCB = NULL;
+  } else if (handler->reqCB) {
+    if (ret != OSDK_STAT_OK) {
+      handler->package.type = FileType::UNKNOWN;
+      handler->package.media.clear();
+    }
+    handler->reqCB(ret, handler->package, handler->reqCBUserData);
+    handler->reqCB = NULL;
+  }
+  handler->package.media.clear();
+  handler->package.media.shrink_to_fit();
+  handler->downloadState = DOWNLOAD_IDLE;
+}
+
+/*! Each pack is written at the offset its seq stands for, so packs may come
+ *  in any order and resent ones land where they belong. A request of the
+ *  range [reqOffset, reqOffset + reqSize) is answered with seq 0 carrying
+ *  the file info and the first data, then packs of packLen bytes each but
+ *  the last. Packs coming before the ones telling these sizes are kept in
+ *  earlyPacks for the time being. */
+FileMgrImpl::PackParseResult FileMgrImpl::parseFileData(dji_general_transfer_msg_ack *rsp) {
+  DownloadDataHandler *handler = fileDataHandler;
+  MmapFileBuffer *mfile = handler->mmap_file_buffer_;
+  PackParseResult ret = PACK_STORED;
+  bool lastPack = rsp->msg_flag & 0x01;
+  /*! 本包数据总大小计算 */
+  uint32_t data_size = rsp->msg_length;
+  data_size -= sizeof(dji_general_transfer_msg_ack) - sizeof(uint8_t);
+
+  std::lock_guard<std::mutex> lock(handler->dataMutex);
+  if (handler->downloadState != RECVING_FILE_DATA) return PACK_DROPPED;
+  /*! Late packs of a request aborted for the next range would be written at
+   *  the offsets of the new one */
+  if (rsp->session_id != handler->reqSessionId) return PACK_STALE;
+
   if (rsp->seq == 0) {
     /*! 1. 是第一包,parse文件大小 */
+    if (handler->firstPackLen >= 0) return PACK_STORED; // first pack sent again
     auto resp = (dji_file_data_download_resp *) (rsp->data);
+    uint32_t header_size = sizeof(dji_file_data_download_resp) - sizeof(uint8_t);
+    if (data_size < header_size) return PACK_DROPPED;
+    data_size -= header_size;
     /*! 2. 文件总大小计算 */
-    uint32_t file_size = resp->size - (sizeof(dji_file_data_download_resp) - sizeof(uint8_t));
-    mfile->init(fileDataHandler->downloadPath, file_size);
-    /*! 3. 本包数据总大小计算 */
-    uint32_t data_size = rsp->msg_length;
-    data_size -= sizeof(dji_general_transfer_msg_ack) - sizeof(uint8_t);
-    data_size -= sizeof(dji_file_data_download_resp) - sizeof(uint8_t);
-    if (mfile->InsertBlock(resp->file_data, data_size, mfile->curFilePos))
-      mfile->curFilePos += data_size;
+    uint32_t file_size = resp->size - header_size;
+    if (!mfile->isOpen()) {
+      if (!mfile->init(handler->downloadPath, file_size)) {
+        DERROR("Failed to map %s", handler->downloadPath.c_str());
+        return PACK_FATAL;
+      }
+    } else if (handler->reqOffset && (file_size == mfile->fileSize) &&
+               (handler->reqSize != file_size)) {
+      DSTATUS("The range request is answered with the whole file.");
+      handler->reqOffset = 0;
+    }
+    handler->firstPackLen = data_size;
+    ret = storeFilePack(0, resp->file_data, data_size);
+    if (ret == PACK_STORED) ret = flushEarlyPacks();
+  } else {
+    if (!lastPack && (data_size != handler->packLen)) {
+      if (handler->packLen) {
+        DERROR("Pack %u carries %u bytes instead of %u, request the range "
+               "again", rsp->seq, data_size, handler->packLen);
+        return PACK_RESTART;
+      }
+      handler->packLen = data_size;
+      ret = flushEarlyPacks();
+    }
+    if (ret == PACK_STORED) ret = storeFilePack(rsp->seq, rsp->data, data_size);
   }
-  else
-  {
-    /*! 1. 本包数据总大小计算 */
-    uint32_t data_size = rsp->msg_length;
-    data_size -= sizeof(dji_general_transfer_msg_ack) - sizeof(uint8_t);
-    if (mfile->InsertBlock(rsp->data, data_size, mfile->curFilePos))
-      mfile->curFilePos += data_size;
+
+  if ((ret == PACK_STORED) && lastPack) handler->lastPackSeq = rsp->seq;
+  return ret;
+}
+
+bool FileMgrImpl::getPackOffset(uint32_t seq, uint64_t &offset) {
+  DownloadDataHandler *handler = fileDataHandler;
+  if (handler->firstPackLen < 0) return false;
+  if (seq == 0) {
+    offset = handler->reqOffset;
+  } else if (seq == 1) {
+    offset = handler->reqOffset + handler->firstPackLen;
+  } else if (handler->packLen) {
+    offset = handler->reqOffset + handler->firstPackLen +
+             (uint64_t)(seq - 1) * handler->packLen;
+  } else {
+    return false;
   }
+  return true;
+}
 
-#if 0
-    size_t chunk_index = 0;
-  ParsingFileListStateEnum parsingState = PARSING_TOTAL_HEADER;
-  DataPointer dataPtr = {
-      .data = rsp,
-      .length = rsp->msg_length
-  };
-
-  while (chunk_index < dataPtr.length) {
-    switch (parsingState) {
-      case PARSING_TOTAL_HEADER: {
-        chunk_index = 0;
-        uint32_t consumeBytes = sizeof(dji_general_transfer_msg_ack) - sizeof(uint8_t);
-        auto buffer = ConsumeChunk(dataPtr, chunk_index, consumeBytes);
-        if (buffer.index == consumeBytes) {
-          auto data = (dji_general_transfer_msg_ack *) (buffer.data);
-          parsingState = (data->seq == 0) ? PARSING_DATA_HEADER : PARSING_FILEDATA;
-        } else {
-          parsingState = PARSE_FINISH;
-        }
-        break;
-      }
-      case PARSING_DATA_HEADER: {
-        uint32_t consumeBytes = sizeof(dji_file_data_download_resp) - sizeof(uint8_t);
-        auto buffer = ConsumeChunk(dataPtr, chunk_index, consumeBytes);
-        if (buffer.index == consumeBytes) {
-          auto data = (dji_file_data_download_resp *) (buffer.data);
-          uint32_t file_size = data->size - (sizeof(dji_file_data_download_resp) - sizeof(uint8_t));
-          this->mmap_file_buffer_->init(this->currentLogFilePath, file_size);
-#if SIZE_LIMIT
-          uint32_t targetFileSize = *(uint32_t *)(buffer.data + 4);
-          uint32_t targetFileIndex = *(uint32_t *)(buffer.data + 8);
-          DSTATUS("### The size of the current target file (index:%d) : %d", targetFileIndex, targetFileSize);
-          if (targetFileSize > 2*1024*1024) {
-            DERROR("### The size of the current target file (index:%d) : %d", targetFileIndex, targetFileSize);
-            DERROR("### Current download function support only single file which is smaller than"
-                   "2MB. It will be optimized in the future.");
-            DERROR("### So sorry that this download request will go falied");
-            this->closeFile();
-            this->downloadState = DOWNLOAD_IDLE;
-            return false;
-          }
-#endif
-          parsingState = PARSING_FILEDATA;
-        } else {
-          parsingState = PARSE_FINISH;
-        }
-        break;
-      }
-      case PARSING_FILEDATA: {
-        uint32_t consumeBytes = dataPtr.length - chunk_index; // 消耗完
-        if (consumeBytes == 0) {
-          //DSTATUS("##Parse 完了");
-          parsingState = PARSE_FINISH;
-          break;
-        }
-        auto buffer = ConsumeChunk(dataPtr, chunk_index, consumeBytes);
-        if (buffer.index == consumeBytes) {
-          //DSTATUS("##記錄文件數據, %dBytes", buffer.index);
-          if (rsp->seq * 800 + buffer.index <= mmap_file_buffer_->fdAddrSize)
-            mmap_file_buffer_->InsertBlock(buffer.data, buffer.index, rsp->seq);
-          parsingState = PARSING_FILEDATA;
-        } else {
-          //DSTATUS("##Parse 完了");
-          parsingState = PARSE_FINISH;
-        }
-        break;
-      }
-      case PARSE_FINISH:
-        parsingState = PARSING_TOTAL_HEADER;
-        return true;
-        break;
-      default:break;
+FileMgrImpl::PackParseResult FileMgrImpl::storeFilePack(uint32_t seq, const uint8_t *data, uint32_t len) {
+  DownloadDataHandler *handler = fileDataHandler;
+  uint64_t offset = 0;
+  if (!getPackOffset(seq, offset)) {
+    if (handler->earlyPacks.size() >= FILE_DATA_EARLY_PACKS_MAX)
+      return PACK_DROPPED;
+    handler->earlyPacks[seq].assign(data, data + len);
+    return PACK_STORED;
+  }
+
+  if (!len) return PACK_STORED;
+  if (!handler->mmap_file_buffer_->InsertBlock(data, len, offset)) {
+    DERROR("Pack %u of %u bytes at %llu is out of the file", seq, len,
+           (long long unsigned int)offset);
+    return PACK_FATAL;
+  }
+  addRecvRange(offset, len);
+  return PACK_STORED;
+}
+
+FileMgrImpl::PackParseResult FileMgrImpl::flushEarlyPacks() {
+  auto &packs = fileDataHandler->earlyPacks;
+  for (auto it = packs.begin(); it != packs.end();) {
+    uint64_t offset = 0;
+    if (!getPackOffset(it->first, offset)) {
+      ++it;
+      continue;
     }
+    PackParseResult ret =
+        storeFilePack(it->first, it->second.data(), it->second.size());
+    if (ret != PACK_STORED) return ret;
+    it = packs.erase(it);
   }
-#endif
+  return PACK_STORED;
+}
 
-  return false;
+/*! Merge [start, start + len) into recvRanges, curFilePos counts the bytes
+ *  covered by them */
+void FileMgrImpl::addRecvRange(uint64_t start, uint64_t len) {
+  auto &ranges = fileDataHandler->recvRanges;
+  uint64_t end = start + len;
+  uint64_t covered = 0;
+
+  auto it = ranges.upper_bound(start);
+  if ((it != ranges.begin()) && (std::prev(it)->second >= start)) --it;
+  while ((it != ranges.end()) && (it->first <= end)) {
+    if (it->first < start) start = it->first;
+    if (it->second > end) end = it->second;
+    covered += it->second - it->first;
+    it = ranges.erase(it);
+  }
+  ranges[start] = end;
+  fileDataHandler->mmap_file_buffer_->curFilePos += (end - start) - covered;
+}
+
+/*! First hole of the mapped file */
+bool FileMgrImpl::findMissingRange(uint64_t &offset, uint64_t &size) {
+  auto &ranges = fileDataHandler->recvRanges;
+  uint64_t fileSize = fileDataHandler->mmap_file_buffer_->fileSize;
+  uint64_t start = 0;
+  auto it = ranges.begin();
+  if ((it != ranges.end()) && (it->first == 0)) {
+    start = it->second;
+    ++it;
+  }
+  if (start >= fileSize) return false;
+  offset = start;
+  size = ((it != ranges.end()) ? it->first : fileSize) - start;
+  return true;
+}
+
+std::string FileMgrImpl::getPartFilePath() {
+  return fileDataHandler->downloadPath + FILE_DATA_PART_SUFFIX;
+}
+
+/*! Written to a temporary file first, so a crash never leaves a torn one.
+ *  The ranges only name data the mapping holds, which the kernel writes
+ *  back even if the process dies. */
+void FileMgrImpl::savePartFile() {
+  std::lock_guard<std::mutex> lock(fileDataHandler->dataMutex);
+  MmapFileBuffer *mfile = fileDataHandler->mmap_file_buffer_;
+  if (!mfile->isOpen() || (mfile->curFilePos == fileDataHandler->savedBytes))
+    return;
+
+  std::string path = getPartFilePath();
+  std::string tmpPath = path + ".tmp";
+  FILE *fp = fopen(tmpPath.c_str(), "w");
+  if (!fp) {
+    DERROR("Failed to open %s", tmpPath.c_str());
+    return;
+  }
+  fprintf(fp, "%s %d %llu\n", FILE_DATA_PART_MAGIC,
+          (int)fileDataHandler->curTargetFileIndex,
+          (long long unsigned int)mfile->fileSize);
+  for (auto &range : fileDataHandler->recvRanges) {
+    fprintf(fp, "%llu %llu\n", (long long unsigned int)range.first,
+            (long long unsigned int)range.second);
+  }
+  if ((fclose(fp) != 0) || (rename(tmpPath.c_str(), path.c_str()) != 0)) {
+    DERROR("Failed to save %s", path.c_str());
+    remove(tmpPath.c_str());
+    return;
+  }
+  fileDataHandler->savedBytes = mfile->curFilePos;
+}
+
+/*! Fills recvRanges from the part file, if it belongs to the file index and
+ *  the file next to it still has the size it names */
+bool FileMgrImpl::loadPartFile(int fileIndex, uint64_t &fileSize) {
+  std::string path = getPartFilePath();
+  FILE *fp = fopen(path.c_str(), "r");
+  if (!fp) return false;
+
+  char magic[32] = {0};
+  int partFileIndex = 0;
+  long long unsigned int size = 0;
+  long long unsigned int start = 0;
+  long long unsigned int end = 0;
+  struct stat fileStat;
+  bool valid = (fscanf(fp, "%31s %d %llu", magic, &partFileIndex, &size) == 3) &&
+               (strcmp(magic, FILE_DATA_PART_MAGIC) == 0) &&
+               (partFileIndex == fileIndex) &&
+               (stat(fileDataHandler->downloadPath.c_str(), &fileStat) == 0) &&
+               ((uint64_t)fileStat.st_size == size);
+  if (valid) {
+    fileDataHandler->mmap_file_buffer_->fileSize = size;
+    while (fscanf(fp, "%llu %llu", &start, &end) == 2) {
+      if ((start < end) && (end <= size)) addRecvRange(start, end - start);
+    }
+    fileSize = size;
+  } else {
+    DERROR("%s does not match the file, ignore it", path.c_str());
+  }
+  fclose(fp);
+  return valid;
 }
 
 void FileMgrImpl::fileListRawDataCB(dji_general_transfer_msg_ack *rsp) {
   int temp = fileListHandler->downloadState;
   if (fileListHandler->downloadState == DOWNLOAD_IDLE) return;
-    auto download_buffer_ = fileListHandler->download_buffer_;
-    auto range_handler_ = fileListHandler->range_handler_;
-    if (download_buffer_ && range_handler_) {
-      download_buffer_->InsertBlock((const uint8_t *) rsp, rsp->msg_length, rsp->seq, true);
-      range_handler_->AddSeqIndex(rsp->seq, download_buffer_->GetConfirmSeq(), download_buffer_->GetSize());
-    }
+  /*! The monitor task may have finished the request meanwhile */
+  std::lock_guard<std::mutex> lock(fileListHandler->listMutex);
+  if (fileListHandler->downloadState == DOWNLOAD_IDLE) return;
+  auto download_buffer_ = fileListHandler->download_buffer_;
+  auto range_handler_ = fileListHandler->range_handler_;
+  if (download_buffer_ && range_handler_) {
+    if ((download_buffer_->InsertBlock((const uint8_t *) rsp, rsp->msg_length, rsp->seq, true) ==
+         DownloadBufferQueue::INSERT_FAIL_OUT_OF_RANGE) &&
+        ((int)rsp->seq > download_buffer_->GetConfirmSeq()))
+      DERROR("File list pack %d is too far ahead of pack %d, dropped",
+             rsp->seq, download_buffer_->GetConfirmSeq() + 1);
+    range_handler_->AddSeqIndex(rsp->seq, download_buffer_->GetConfirmSeq(), download_buffer_->GetSize());
+  }
 
-    /*! refresh the time stamp */
-    uint32_t curMs = 0;
-    OsdkOsal_GetTimeMs(&curMs);
-    fileListHandler->updateTimeMs = curMs;
-
-    /*! 看看是否拿到了最后一个包 */
-    /*! 收完了再解包*/
-    if ((rsp->msg_flag & 0x01)
-    && (range_handler_->GetLastNotReceiveSeq() == rsp->seq + 1)
-    && (range_handler_->GetNoAckRanges().size() == 0)) {
-      std::list<DataPointer> dataList = download_buffer_->DequeueAllBuffer();
-      FilePackage file_package = parseFileList(dataList);
-
-      SendAbortPack(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_LIST);
-      if (fileListHandler->reqCB) {
-        fileListHandler->reqCB(OSDK_STAT_OK, file_package, fileListHandler->reqCBUserData);
-        fileListHandler->reqCB = NULL;
-      }
+  /*! refresh the time stamp */
+  uint32_t curMs = 0;
+  OsdkOsal_GetTimeMs(&curMs);
+  fileListHandler->updateTimeMs = curMs;
 
-      DSTATUS("Finish req filelist task, reset downloadState to be DOWNLOAD_IDLE");
-      fileListHandler->downloadState = DOWNLOAD_IDLE;
-    }
+  /*! 看看是否拿到了最后一个包 */
+  if (rsp->msg_flag & 0x01) fileListHandler->lastPackSeq = rsp->seq;
+
+  /*! Decode what is in order by now, the list is complete once the pack
+   *  flagged last is decoded */
+  if (download_buffer_ && parseFileList(download_buffer_)) {
+    finishReqFileList(OSDK_STAT_OK);
+    DSTATUS("Finish req filelist task, reset downloadState to be DOWNLOAD_IDLE");
+  }
 }
 
 void FileMgrImpl::fileDataRawDataCB(dji_general_transfer_msg_ack *rsp) {
-  if (fileDataHandler->downloadState == DOWNLOAD_IDLE) return;
+  if ((fileDataHandler->downloadState == DOWNLOAD_IDLE) ||
+      fileDataHandler->nextRangeReq) return;
   auto range_handler_ = fileDataHandler->range_handler_;
-  auto mmap_file_buffer_ = fileDataHandler->mmap_file_buffer_;
-  if (range_handler_) {
-    range_handler_->AddSeqIndex(rsp->seq, 0, (uint32_t)(-1));
-  }
+
+  /*! do data parsing, 边收边解包 */
+  PackParseResult result = parseFileData(rsp);
+  if (result == PACK_STALE) return;
 
   /*! refresh the time stamp */
   uint32_t curMs = 0;
   OsdkOsal_GetTimeMs(&curMs);
   fileDataHandler->updateTimeMs = curMs;
 
-  /*! do data parsing, 边收边解包 */
-  parseFileData(rsp);
-
-  /*! 看看是否拿到了最后一个包 或者丢包了 */
-  bool packFinishFlag = false;
-  bool packLossFlag = false;
-  if ((rsp->msg_flag & 0x01) &&
-      (range_handler_->GetLastNotReceiveSeq() == rsp->seq + 1)) {
-    DSTATUS("Got the last one pack .");
-    packFinishFlag = true;
+  if (result == PACK_FATAL) {
+    finishReqFileData(OSDK_STAT_SYS_ERR);
+    return;
   }
-  if (range_handler_->GetNoAckRanges().size() != 0) {
-    DERROR("pack loss !!!");
-    packLossFlag = true;
+  if (result == PACK_RESTART) {
+    restartRange();
+    return;
   }
+  /*! A dropped pack stays missing and is asked for again with the others */
+  if (result == PACK_STORED) range_handler_->AddSeqIndex(rsp->seq, 0, (uint32_t)(-1));
 
-  if (packLossFlag || packFinishFlag) {
-    E_OsdkStat ret =
-      (packFinishFlag && !packLossFlag) ? OSDK_STAT_OK : OSDK_STAT_SYS_ERR;
-    SendAbortPack(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_FILE);
-    if (fileDataHandler->reqCB) {
-      fileDataHandler->reqCB(ret, fileDataHandler->reqCBUserData);
-      fileDataHandler->reqCB = NULL;
-    }
+  /*! 看看是否拿到了最后一个包, 丢的包由监控任务催要重传 */
+  if ((fileDataHandler->lastPackSeq < 0) ||
+      (range_handler_->GetLastNotReceiveSeq() != fileDataHandler->lastPackSeq + 1) ||
+      (range_handler_->GetNoAckRanges().size() != 0))
+    return;
+  DSTATUS("Got all the packs of the request.");
+
+  uint64_t offset = 0;
+  uint64_t size = 0;
+  bool missing = false;
+  bool progressed = false;
+  {
+    std::lock_guard<std::mutex> lock(fileDataHandler->dataMutex);
+    missing = findMissingRange(offset, size);
+    progressed = fileDataHandler->mmap_file_buffer_->curFilePos !=
+                 fileDataHandler->reqStartBytes;
+  }
+  if (!missing) {
     DSTATUS("Finish req filedata task, reset downloadState to be DOWNLOAD_IDLE");
-    fileDataHandler->downloadState = DOWNLOAD_IDLE;
+    finishReqFileData(OSDK_STAT_OK);
+  } else if (!progressed) {
+    DERROR("The request brought no data, [%llu, %llu) is still missing",
+           (long long unsigned int)offset, (long long unsigned int)(offset + size));
+    finishReqFileData(OSDK_STAT_SYS_ERR);
+  } else {
+    fileDataHandler->restartCnt = 0;
+    fileDataHandler->nextRangeReq = true;
+  }
+}
+
+/*! Drop the request in flight and let the monitor task ask for the first
+ *  missing range again. What was written so far is kept, it is only given
+ *  up if several requests in a row bring nothing. */
+void FileMgrImpl::restartRange() {
+  bool progressed = false;
+  {
+    std::lock_guard<std::mutex> lock(fileDataHandler->dataMutex);
+    progressed = fileDataHandler->mmap_file_buffer_->curFilePos !=
+                 fileDataHandler->reqStartBytes;
   }
+  if (progressed) {
+    fileDataHandler->restartCnt = 0;
+  } else if (++fileDataHandler->restartCnt >= FILE_DATA_RESTART_MAX) {
+    DERROR("%u requests in a row brought no data", fileDataHandler->restartCnt);
+    finishReqFileData(OSDK_STAT_SYS_ERR);
+    return;
+  }
+  fileDataHandler->nextRangeReq = true;
+}
+
+/*! The state goes back to idle before the callback runs, so the callback
+ *  can start the next request right away. A failed download keeps the file
+ *  and its part file for startResumeFileData. */
+void FileMgrImpl::finishReqFileData(E_OsdkStat ret) {
+  int expected = RECVING_FILE_DATA;
+  if (!fileDataHandler->downloadState.compare_exchange_strong(expected,
+                                                              DOWNLOAD_IDLE))
+    return;
+
+  SendAbortPack(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_FILE);
+  if (ret == OSDK_STAT_OK) {
+    std::lock_guard<std::mutex> lock(fileDataHandler->dataMutex);
+    remove(getPartFilePath().c_str());
+    fileDataHandler->mmap_file_buffer_->deInit();
+  } else {
+    fileDataHandler->savedBytes = (uint64_t)(-1);
+    savePartFile();
+    std::lock_guard<std::mutex> lock(fileDataHandler->dataMutex);
+    fileDataHandler->mmap_file_buffer_->deInit();
+  }
+  fileDataHandler->nextRangeReq = false;
+  auto cb = fileDataHandler->reqCB;
+  void *udata = fileDataHandler->reqCBUserData;
+  fileDataHandler->reqCB = NULL;
+  if (cb) cb(ret, udata);
 }
 
 #define LOG_EVERY_PACK 0
 void FileMgrImpl::OnReceiveDataPack(dji_general_transfer_msg_ack *rsp) {
   if (rsp->func_id != DJI_GENERAL_DOWNLOAD_FILE_FUNC_TYPE_DATA) return;
 
-  static uint32_t lastSeq = 0;
+  uint32_t &lastSeq = fileDataHandler->lastSeq;
   //DSTATUS("\033[1;32;40m##[seq] = %d; [len] = %d; [flag] = %d;\033[0m", rsp->seq, rsp->msg_length, rsp->msg_flag);
   if (rsp->seq == 0) DSTATUS("[First pack] get the first pack");
   else if (rsp->seq != lastSeq + 1) DSTATUS("[Skip packs]------------------->skip seq : lastSeq = %d, rsp->seq = %d", lastSeq, rsp->seq);
@@ -952,6 +1358,12 @@ void FileMgrImpl::HandlePushPack(dji_general_transfer_msg_ack *rsp) {
   }
 }
 
+uint16_t FileMgrImpl::getSessionId(DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE taskId) {
+  return (taskId == DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE_FILE)
+             ? (uint16_t)fileDataHandler->reqSessionId
+             : (uint16_t)FILE_LIST_SESSION_ID;
+}
+
 ErrorCode::ErrorCodeType FileMgrImpl::SendAbortPack(
     DJI_GENERAL_DOWNLOAD_FILE_TASK_TYPE taskId) {
   DSTATUS("SendAbortPack");
@@ -963,7 +1375,7 @@ ErrorCode::ErrorCodeType FileMgrImpl::SendAbortPack(
   setting->task_id = taskId;
   setting->func_id = DJI_GENERAL_DOWNLOAD_FILE_FUNC_TYPE_ABORT;
   setting->msg_flag = 1;
-  setting->session_id = 999;
+  setting->session_id = getSessionId(taskId);
   setting->seq = 0;
 /*
   uint32_t abortReason = TransAbortReasonForce;
@@ -1004,7 +1416,7 @@ ErrorCode::ErrorCodeType FileMgrImpl::SendACKPack(DJI_GENERAL_DOWNLOAD_FILE_TASK
   setting->task_id = taskId;
   setting->func_id = DJI_GENERAL_DOWNLOAD_FILE_FUNC_TYPE_ACK;
   setting->msg_flag = 0;
-  setting->session_id = 999;
+  setting->session_id = getSessionId(taskId);
   setting->seq = 0;
 
   uint32_t reqDataLen = sizeof(dji_download_ack) - sizeof(dji_loss_desc) + ack->loss_nr * sizeof(dji_loss_desc);
@@ -1074,7 +1486,10 @@ ErrorCode::ErrorCodeType FileMgrImpl::SendMissedAckPack(DJI_GENERAL_DOWNLOAD_FIL
   return SendACKPack(taskId, ack);
 }
 
-DownloadListHandler::DownloadListHandler() : reqCB(nullptr), reqCBUserData(nullptr) {
+DownloadListHandler::DownloadListHandler()
+    : reqCB(nullptr), batchCB(nullptr), reqCBUserData(nullptr), filter(),
+      parseSeq(0), lastPackSeq(-1), parseState(0), listAmount(0),
+      listLen(-1), parsedBytes(0), need(0), carryLen(0) {
   range_handler_ = new CommonDataRangeHandler();
   download_buffer_ = new DownloadBufferQueue();
   downloadState = DOWNLOAD_IDLE;
@@ -1085,7 +1500,12 @@ DownloadListHandler::~DownloadListHandler() {
   if (download_buffer_) delete download_buffer_;
 }
 
-DownloadDataHandler::DownloadDataHandler() : reqCB(nullptr), reqCBUserData(nullptr) {
+DownloadDataHandler::DownloadDataHandler()
+    : reqCB(nullptr), reqCBUserData(nullptr), session(0), lastSeq(0),
+      lastPrintFilePos(0), lastPrintMs(0), reqOffset(0), reqSize(0),
+      firstPackLen(-1), packLen(0), lastPackSeq(-1), reqStartBytes(0),
+      savedBytes(0), nextRangeReq(false), reqSessionId(FILE_LIST_SESSION_ID),
+      restartCnt(0) {
   range_handler_ = new CommonDataRangeHandler();
   mmap_file_buffer_ = new MmapFileBuffer();
   downloadState = DOWNLOAD_IDLE;
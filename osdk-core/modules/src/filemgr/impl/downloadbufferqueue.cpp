@@ -10,6 +10,7 @@
 #include <assert.h>
 #include <stdio.h>
 #include <chrono>
+#include <cstdlib>
 #include <cstring>
 
 #ifdef ANDROID
@@ -21,139 +22,114 @@ using namespace std::chrono;
 namespace DJI {
 namespace OSDK {
 bool DownloadBufferQueue::InitBufferQueue(int size, int start_index) {
-    if (m_queue_ptr != nullptr) {
-        free(m_queue_ptr);
-        m_queue_ptr = nullptr;
+    if (size <= 0 || start_index < 0) {
+        return false;
     }
-    m_queue_ptr = (DataPointer *)malloc(sizeof(DataPointer) * size);
 
-    memset(m_queue_ptr, 0x00, sizeof(DataPointer) * size);
+    if (size != m_size) {
+        Dealloc();
+        m_slot_length = new std::atomic<uint32_t>[size];
+        m_slot_data = (uint8_t *)malloc((size_t)size * DOWNLOAD_BUFFER_SLOT_SIZE);
+        if (!m_slot_data) {
+            Dealloc();
+            return false;
+        }
+        m_size = size;
+    }
+    Clear();
 
-    m_size = size;
-    m_expect_index = start_index;
-    m_head = m_expect_index % m_size;
-    m_buf_max_index = m_expect_index - 1;
+    m_expect_index.store(start_index, std::memory_order_relaxed);
+    m_buf_max_index.store(start_index - 1, std::memory_order_release);
 
     return true;
 }
 
 // flag 代表是否覆盖已有队列缓存
 DownloadBufferQueue::InsertRetType DownloadBufferQueue::InsertBlock(const uint8_t *pack, uint32_t data_length, int index, bool flag) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  InsertRetType ret = INSERT_FAIL_UNKOWN;
-
-  if (data_length <= 0) {
+  if (data_length <= 0 || data_length > DOWNLOAD_BUFFER_SLOT_SIZE || !m_size) {
     return INSERT_FAIL_INVALID_PARAM;
   }
 
-  if (m_expect_index + m_size > index && m_expect_index <= index) {
-    int insert_index = m_head + (index - m_expect_index);
-    insert_index = insert_index % m_size;
-    DataPointer data_ptr = m_queue_ptr[insert_index];
-
-    if (data_ptr.data) {
-      if (false == flag) {
-        return INSERT_FAIL_MEMORY_USED;
-      }
-
-      free(data_ptr.data);
-    }
-
-    data_ptr.data = (uint8_t *) malloc(data_length);
-    data_ptr.length = data_length;
-    memcpy(data_ptr.data, pack, data_length);
+  /*! The consumer clears a slot before moving past it */
+  int expect_index = m_expect_index.load(std::memory_order_acquire);
+  if (index < expect_index || index >= expect_index + m_size) {
+    return INSERT_FAIL_OUT_OF_RANGE;
+  }
 
-    m_queue_ptr[insert_index] = data_ptr;
+  int slot = index % m_size;
+  if (m_slot_length[slot].load(std::memory_order_relaxed)) {
+    return flag ? INSERT_SUCCESS : INSERT_FAIL_MEMORY_USED;
+  }
 
-    if (index > m_buf_max_index) {
-      m_buf_max_index = index;
-    }
+  memcpy(m_slot_data + (size_t)slot * DOWNLOAD_BUFFER_SLOT_SIZE, pack, data_length);
+  m_slot_length[slot].store(data_length, std::memory_order_release);
 
-    ret = INSERT_SUCCESS;
-   // printf("log .................................index = %d; m_expect_index + m_size = %d\n", index, m_expect_index + m_size);
-    if (index == (m_expect_index + m_size - 1)) {
-     // printf("满了 .................................index = %d; m_expect_index + m_size = %d\n", index, m_expect_index + m_size);
-      return INSERT_SUCCESS_FULL;
-    }
-  } else {
-    ret = INSERT_FAIL_OUT_OF_RANGE;
+  if (index > m_buf_max_index.load(std::memory_order_relaxed)) {
+    m_buf_max_index.store(index, std::memory_order_relaxed);
   }
 
-  return ret;
+  if (index == (expect_index + m_size - 1)) {
+    return INSERT_SUCCESS_FULL;
+  }
+  return INSERT_SUCCESS;
 }
 
 bool DownloadBufferQueue::FindBlockByIndex(int index) {
-    bool ret = false;
-
-    if (m_expect_index + m_size > index && index >= m_expect_index) {
-        int queue_index = index - m_expect_index + m_head;
-        queue_index = queue_index % m_size;
-        DataPointer data_ptr = m_queue_ptr[queue_index];
-
-        if (data_ptr.data) {
-            ret = true;
-        }
+    int expect_index = m_expect_index.load(std::memory_order_acquire);
+    if (!m_size || index < expect_index || index >= expect_index + m_size) {
+        return false;
     }
-
-    return ret;
+    return m_slot_length[index % m_size].load(std::memory_order_acquire) != 0;
 }
 
 int DownloadBufferQueue::GetConfirmSeq() {
-    return m_expect_index - 1;
+    return m_expect_index.load(std::memory_order_acquire) - 1;
 }
 
 int DownloadBufferQueue::GetBufMaxSeq() {
-    return m_buf_max_index;
+    return m_buf_max_index.load(std::memory_order_relaxed);
 }
 
-DataPointer DownloadBufferQueue::DequeueBuffer() {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    DataPointer data_ptr = m_queue_ptr[m_head % m_size];
-
-    if (!data_ptr.data || data_ptr.length == 0) {
-        DataPointer nil_ptr = {nullptr};
-        return nil_ptr;
+DataPointer DownloadBufferQueue::FrontBuffer() {
+    DataPointer data_ptr = {nullptr, 0};
+    if (!m_size) {
+        return data_ptr;
     }
 
-    m_queue_ptr[m_head % m_size].data = nullptr;
-    m_queue_ptr[m_head % m_size].length = 0;
-
-    m_expect_index++;
-    m_head++;
-    m_head = m_head % m_size;
-
+    int slot = m_expect_index.load(std::memory_order_relaxed) % m_size;
+    uint32_t length = m_slot_length[slot].load(std::memory_order_acquire);
+    if (length) {
+        data_ptr.data = m_slot_data + (size_t)slot * DOWNLOAD_BUFFER_SLOT_SIZE;
+        data_ptr.length = length;
+    }
     return data_ptr;
 }
 
-std::list<DataPointer> DownloadBufferQueue::DequeueAllBuffer() {
-    DataPointer data_pointer = {nullptr};
-    std::list<DataPointer> data_pointer_list;
-    data_pointer_list.clear();
+void DownloadBufferQueue::PopBuffer() {
+    if (!m_size) {
+        return;
+    }
 
-    while ((data_pointer = DequeueBuffer()).data != nullptr) {
-        data_pointer_list.push_back(data_pointer);
+    int expect_index = m_expect_index.load(std::memory_order_relaxed);
+    std::atomic<uint32_t> &length = m_slot_length[expect_index % m_size];
+    if (!length.load(std::memory_order_relaxed)) {
+        return;
     }
-    return data_pointer_list;
+    length.store(0, std::memory_order_relaxed);
+    m_expect_index.store(expect_index + 1, std::memory_order_release);
 }
 
 void DownloadBufferQueue::Clear() {
     for (int i = 0; i < m_size; i++) {
-        if (m_queue_ptr[i].data) {
-            free(m_queue_ptr[i].data);
-            m_queue_ptr[i].data = nullptr;
-            m_queue_ptr[i].length = 0;
-        }
+        m_slot_length[i].store(0, std::memory_order_relaxed);
     }
 }
 
 void DownloadBufferQueue::Dealloc() {
-    Clear();
-
-    if (m_queue_ptr) {
-        free(m_queue_ptr);
-        m_queue_ptr = nullptr;
-    }
-
+    delete[] m_slot_length;
+    m_slot_length = nullptr;
+    free(m_slot_data);
+    m_slot_data = nullptr;
     m_size = 0;
 }
 }  // namespace OSDK
@@ -3,59 +3,245 @@
 //
 #include "mmap_file_buffer.hpp"
 #include "dji_log.hpp"
+#include "osdk_osal.h"
+#include <errno.h>
+#include <stdio.h>
 #include <string.h>
 
 namespace DJI {
 namespace OSDK {
 
-MmapFileBuffer::MmapFileBuffer() : fdAddr(NULL), curFilePos(0) {}
+MmapFileBuffer::MmapFileBuffer()
+    : fd(-1), fileSize(0), curFilePos(0), useCnt(0), flushStop(false),
+      flushRunning(false), flushTaskHandle(NULL) {
+  for (int i = 0; i < MMAP_FILE_WINDOW_CNT; i++) {
+    windows[i].start = 0;
+    windows[i].length = 0;
+    windows[i].coveredBytes = 0;
+    windows[i].addr = NULL;
+    windows[i].lastUse = 0;
+  }
+}
 
-MmapFileBuffer::~MmapFileBuffer() {}
+MmapFileBuffer::~MmapFileBuffer() {
+  deInit();
+  stopFlushTask();
+}
+
+bool MmapFileBuffer::startFlushTask() {
+  std::lock_guard<std::mutex> lock(flushMutex);
+  if (flushRunning) return true;
+  if (flushTaskHandle) {
+    OsdkOsal_TaskDestroy(flushTaskHandle);
+    flushTaskHandle = NULL;
+  }
+  flushStop = false;
+  flushRunning = true;
+  if (OsdkOsal_TaskCreate(&flushTaskHandle, flushTask,
+                          OSDK_TASK_STACK_SIZE_DEFAULT, this) != OSDK_STAT_OK) {
+    DERROR("Create mmap flush task failed, windows are written back inline");
+    flushTaskHandle = NULL;
+    flushRunning = false;
+    return false;
+  }
+  return true;
+}
+
+/*! Waits until everything handed over is written back */
+void MmapFileBuffer::stopFlushTask() {
+  {
+    std::unique_lock<std::mutex> lock(flushMutex);
+    flushStop = true;
+    flushCond.notify_all();
+    flushCond.wait(lock, [this] { return !flushRunning; });
+  }
+  if (flushTaskHandle) {
+    OsdkOsal_TaskDestroy(flushTaskHandle);
+    flushTaskHandle = NULL;
+  }
+}
 
 bool MmapFileBuffer::init(std::string path, uint64_t fileSize) {
+  deInit();
   currentLogFilePath = path;
-  fdAddrSize = fileSize;
-  curFilePos = 0;
+  this->fileSize = fileSize;
   printf("Preparing File : %s\n", this->currentLogFilePath.c_str());
   fd = open(this->currentLogFilePath.c_str(), O_RDWR | O_CREAT, 0644);
   DSTATUS("fd = %d", fd);
   if (fd < 0) return false;
+  startFlushTask();
 
-  ftruncate(fd, fdAddrSize);
-  fdAddr = (char *) mmap(NULL, fdAddrSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-
-  if (fdAddr)
-    return true;
-  else
+  /*! Blocks already there, as when resuming, keep their data */
+  if ((ftruncate(fd, fileSize) != 0) ||
+      (fileSize && (fallocate(fd, 0, 0, fileSize) != 0) &&
+       (errno != EOPNOTSUPP) && (errno != ENOSYS))) {
+    DERROR("Failed to allocate %llu bytes for %s : %s",
+           (long long unsigned int)fileSize, currentLogFilePath.c_str(),
+           strerror(errno));
+    close(fd);
+    fd = -1;
     return false;
+  }
+  return true;
 }
 
 bool MmapFileBuffer::deInit() {
+  if (fd < 0) return true;
   DSTATUS("Deinit");
-  if (fd >= 0) close(fd);
+  /*! Not waited for, the flush task writes back on its own dups of fd */
+  for (int i = 0; i < MMAP_FILE_WINDOW_CNT; i++) {
+    if (windows[i].addr) releaseWindow(&windows[i]);
+  }
+  close(fd);
   fd = -1;
-  if (fdAddr) munmap(fdAddr, fdAddrSize);
-  fdAddr = NULL;
   return true;
 }
 
+MmapFileBuffer::Window *MmapFileBuffer::getWindow(uint64_t offset) {
+  uint64_t start = offset - offset % MMAP_FILE_WINDOW_SIZE;
+  Window *window = NULL;
+
+  for (int i = 0; i < MMAP_FILE_WINDOW_CNT; i++) {
+    if (windows[i].addr && (windows[i].start == start)) {
+      windows[i].lastUse = ++useCnt;
+      return &windows[i];
+    }
+    if (!window || (window->addr && (!windows[i].addr ||
+                    (windows[i].lastUse < window->lastUse))))
+      window = &windows[i];
+  }
+
+  if (window->addr) releaseWindow(window);
+  window->start = start;
+  window->length = fileSize - start;
+  if (window->length > MMAP_FILE_WINDOW_SIZE)
+    window->length = MMAP_FILE_WINDOW_SIZE;
+  window->covered.clear();
+  window->coveredBytes = 0;
+  void *addr = mmap(NULL, window->length, PROT_READ | PROT_WRITE, MAP_SHARED,
+                    fd, start);
+  if (addr == MAP_FAILED) {
+    DERROR("Failed to map %llu bytes at %llu : %s",
+           (long long unsigned int)window->length,
+           (long long unsigned int)start, strerror(errno));
+    return NULL;
+  }
+  madvise(addr, window->length, MADV_SEQUENTIAL);
+  window->addr = (char *) addr;
+  window->lastUse = ++useCnt;
+  return window;
+}
+
+void MmapFileBuffer::releaseWindow(Window *window) {
+  munmap(window->addr, window->length);
+  window->addr = NULL;
+
+  FlushRange range = {dup(fd), window->start, window->length};
+  std::lock_guard<std::mutex> lock(flushMutex);
+  if (flushRunning && (range.fd >= 0)) {
+    flushQueue.push_back(range);
+    flushCond.notify_one();
+  } else {
+    sync_file_range(fd, range.start, range.length, SYNC_FILE_RANGE_WRITE);
+    if (range.fd >= 0) close(range.fd);
+  }
+}
+
+uint64_t MmapFileBuffer::addCoverage(Window *window, uint64_t offset,
+                                     uint64_t len) {
+  auto &ranges = window->covered;
+  uint64_t start = offset;
+  uint64_t end = offset + len;
+
+  auto it = ranges.upper_bound(start);
+  if (it != ranges.begin()) {
+    auto prev = std::prev(it);
+    if (prev->second >= start) it = prev;
+  }
+  while ((it != ranges.end()) && (it->first <= end)) {
+    if (it->first < start) start = it->first;
+    if (it->second > end) end = it->second;
+    window->coveredBytes -= it->second - it->first;
+    it = ranges.erase(it);
+  }
+  ranges[start] = end;
+  window->coveredBytes += end - start;
+  return window->coveredBytes;
+}
+
+/*! Wait for the write back of the range and drop it from the page cache */
+void MmapFileBuffer::finishFlush(const FlushRange &range) {
+  sync_file_range(range.fd, range.start, range.length,
+                  SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+                  SYNC_FILE_RANGE_WAIT_AFTER);
+  posix_fadvise(range.fd, range.start, range.length, POSIX_FADV_DONTNEED);
+  close(range.fd);
+}
+
+/*! Starts the write back of every window handed over right away and waits
+ *  for the oldest one once more than MMAP_FILE_FLUSH_LAG are in flight, or
+ *  as soon as nothing new comes in. */
+void *MmapFileBuffer::flushTask(void *arg) {
+  MmapFileBuffer *buffer = (MmapFileBuffer *)arg;
+  std::deque<FlushRange> started;
+  std::unique_lock<std::mutex> lock(buffer->flushMutex);
+  for (;;) {
+    buffer->flushCond.wait(lock, [&] {
+      return buffer->flushStop || !buffer->flushQueue.empty() ||
+             !started.empty();
+    });
+    if (!buffer->flushQueue.empty()) {
+      FlushRange range = buffer->flushQueue.front();
+      buffer->flushQueue.pop_front();
+      lock.unlock();
+      sync_file_range(range.fd, range.start, range.length,
+                      SYNC_FILE_RANGE_WRITE);
+      started.push_back(range);
+      if (started.size() > MMAP_FILE_FLUSH_LAG) {
+        finishFlush(started.front());
+        started.pop_front();
+      }
+      lock.lock();
+    } else if (!started.empty()) {
+      lock.unlock();
+      finishFlush(started.front());
+      started.pop_front();
+      lock.lock();
+    } else {
+      break;
+    }
+  }
+  buffer->flushRunning = false;
+  buffer->flushCond.notify_all();
+  return NULL;
+}
+
 
 // flag 代表是否覆盖已有队列缓存
 bool MmapFileBuffer::InsertBlock(const uint8_t *pack, uint32_t data_length, uint64_t index) {
-#if 0
-  static uint32_t tempAdaptingBufferCnt = 0;
-  if (index == 1) tempAdaptingBufferCnt = data_length;
-#endif
-  if ((data_length <= 0) || !fdAddr) {
+  if ((data_length <= 0) || (fd < 0) || (index + data_length > fileSize)) {
     return false;
   }
-#if 0
-  index = index * tempAdaptingBufferCnt;
-#endif
 
-  memcpy(fdAddr + index, pack, data_length);
+  /*! A block may straddle two windows */
+  while (data_length) {
+    Window *window = getWindow(index);
+    if (!window) return false;
+    uint64_t offset = index - window->start;
+    uint32_t len = data_length;
+    if (offset + len > window->length) len = window->length - offset;
+
+    memcpy(window->addr + offset, pack, len);
+    /*! Resent packs write the same bytes again, only coverage counts */
+    if (addCoverage(window, offset, len) >= window->length)
+      releaseWindow(window);
+
+    pack += len;
+    index += len;
+    data_length -= len;
+  }
 
   return true;
 }
 }
-}
\ No newline at end of file
+}
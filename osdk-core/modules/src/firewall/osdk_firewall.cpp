@@ -112,6 +112,7 @@ void *Firewall::firewallTask(void *arg) {
   DSTATUS("firewall task created ...");
   if(arg) {
     Firewall *fw = (Firewall *) arg;
+    PeriodicTimer checkTimer(500 * 1000);
     for (;;) {
       if (fw->linker->isUSBPlugged()) {
         auto ret = fw->checkFireWallConnection();
@@ -123,7 +124,7 @@ void *Firewall::firewallTask(void *arg) {
           OsdkOsal_TaskSleepMs(1000);
         }
       }
-      OsdkOsal_TaskSleepMs(500);
+      checkTimer.wait();
     }
   } else {
     DERROR("OSDK firewall task create failed caused by invalid param.");
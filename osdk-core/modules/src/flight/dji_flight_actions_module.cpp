@@ -31,6 +31,7 @@
 #include "dji_flight_link.hpp"
 #include "osdk_device_id.h"
 #include "dji_linker.hpp"
+#include "dji_async_context_pool.hpp"
 
 using namespace DJI;
 using namespace DJI::OSDK;
@@ -43,15 +44,14 @@ FlightActions::~FlightActions() { delete this->flightLink; }
 
 FlightActions::UCBRetCodeHandler* FlightActions::allocUCBHandler(
     void* callback, UserData userData) {
-  static int ucbHandlerIndex = 0;
-  ucbHandlerIndex++;
-  if (ucbHandlerIndex >= maxSize) {
-    ucbHandlerIndex = 0;
+  UCBRetCodeHandler* ucb =
+      AsyncContextPool::instance().alloc<UCBRetCodeHandler>();
+  if (ucb) {
+    ucb->UserCallBack =
+        (void (*)(ErrorCode::ErrorCodeType errCode, UserData userData))callback;
+    ucb->userData = userData;
   }
-  ucbHandler[ucbHandlerIndex].UserCallBack =
-      (void (*)(ErrorCode::ErrorCodeType errCode, UserData userData))callback;
-  ucbHandler[ucbHandlerIndex].userData = userData;
-  return &(ucbHandler[ucbHandlerIndex]);
+  return ucb;
 }
 
 void FlightActions::commonAckDecoder(Vehicle* vehicle, RecvContainer recvFrame,
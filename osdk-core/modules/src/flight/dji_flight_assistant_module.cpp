@@ -29,6 +29,7 @@
 #include "dji_flight_assistant_module.hpp"
 #include <dji_vehicle.hpp>
 #include "dji_flight_link.hpp"
+#include "dji_async_context_pool.hpp"
 
 using namespace DJI;
 using namespace DJI::OSDK;
@@ -128,15 +129,14 @@ void FlightAssistant::readParameterByHashAsync(
 
 FlightAssistant::UCBRetCodeHandler* FlightAssistant::allocUCBHandler(
     void* callback, UserData userData) {
-  static int ucbHandlerIndex = 0;
-  ucbHandlerIndex++;
-  if (ucbHandlerIndex >= maxSize) {
-    ucbHandlerIndex = 0;
+  UCBRetCodeHandler* ucb =
+      AsyncContextPool::instance().alloc<UCBRetCodeHandler>();
+  if (ucb) {
+    ucb->UserCallBack =
+        (void (*)(ErrorCode::ErrorCodeType errCode, UserData userData))callback;
+    ucb->userData = userData;
   }
-  ucbHandler[ucbHandlerIndex].UserCallBack =
-      (void (*)(ErrorCode::ErrorCodeType errCode, UserData userData))callback;
-  ucbHandler[ucbHandlerIndex].userData = userData;
-  return &(ucbHandler[ucbHandlerIndex]);
+  return ucb;
 }
 
 template <typename AckT>
@@ -29,6 +29,7 @@
 #include "dji_flight_link.hpp"
 #include <dji_vehicle.hpp>
 #include "dji_linker.hpp"
+#include "dji_async_context_pool.hpp"
 
 using namespace DJI;
 using namespace DJI::OSDK;
@@ -42,7 +43,7 @@ void FlightLink::sendAsync(const uint8_t cmd[], void *pdata, size_t len,
                             int retryTime) {
   vehicle->legacyLinker->sendAsync(cmd, (uint8_t *) pdata, len, timeout,
                                    retryTime, (VehicleCallBack) callBack,
-                                   userData);
+                                   userData, true);
 }
 
 void *FlightLink::sendSync(const uint8_t cmd[], void *pdata, size_t len,
@@ -67,7 +68,7 @@ void FlightLink::linkSendFCAsync(const uint8_t cmd[], const uint8_t *cmdData, si
    cmdInfo.receiver   = OSDK_COMMAND_FC_2_DEVICE_ID;
    cmdInfo.addr       = GEN_ADDR(0, ADDR_SDK_COMMAND_INDEX);
 
-   callbackWarpperHandler *handler = (callbackWarpperHandler *)OsdkOsal_Malloc(sizeof(callbackWarpperHandler));
+   callbackWarpperHandler *handler = AsyncContextPool::instance().alloc<callbackWarpperHandler>();
    handler->cb    = UserCallBack;
    handler->udata = userData;
 
@@ -27,10 +27,37 @@
  */
 
 #include "dji_mop_client.hpp"
+#include "dji_mop_event_loop.hpp"
 #include "mop.h"
 
 using namespace std;
 
+/*! Arguments of a non-blocking connect or disconnect */
+typedef struct MopClientJob {
+  MopClient *client;
+  PipelineID id;
+  PipelineType type;
+  void (*connectCb)(MopErrCode errCode, MopPipeline *p, void *userData);
+  void (*disconnectCb)(MopErrCode errCode, void *userData);
+  void *userData;
+} MopClientJob;
+
+static void connectJob(void *arg) {
+  MopClientJob *job = (MopClientJob *)arg;
+  MopPipeline *p = NULL;
+  MopErrCode ret = job->client->connect(job->id, job->type, p);
+  if (job->connectCb)
+    job->connectCb(ret, (ret == MOP_PASSED) ? p : NULL, job->userData);
+  delete job;
+}
+
+static void disconnectJob(void *arg) {
+  MopClientJob *job = (MopClientJob *)arg;
+  MopErrCode ret = job->client->disconnect(job->id);
+  if (job->disconnectCb) job->disconnectCb(ret, job->userData);
+  delete job;
+}
+
 MopClient::MopClient(SlotType slot) : MopPipelineManagerBase() {
   this->slot = slot;
 }
@@ -44,16 +71,20 @@ MopErrCode MopClient::connect(PipelineID id, PipelineType type,
   /*! 0.Check the entry env */
   checkEntry();
   /*! 1.Find whether the pipeline object created or not */
-  if (pipelineMap.find(id) == pipelineMap.end()) {
+  bool found = false;
+  {
+    std::lock_guard<std::mutex> lock(pipelineMapMutex);
+    if (pipelineMap.find(id) != pipelineMap.end()) {
+      p = pipelineMap[id];
+      found = true;
+    }
+  }
+  if (!found) {
     MopErrCode createRet;
     if ((createRet = create(id, p)) != MOP_PASSED) {
       DERROR("MOP Pipeline create failed");
       return createRet;
-    } else {
-      pipelineMap[id] = p;
     }
-  } else {
-    p = pipelineMap[id];
   }
 
   /*! 2.Do creating */
@@ -90,17 +121,29 @@ void MopClient::connect(PipelineID id, PipelineType type,
                         void (*cb)(MopErrCode errCode, MopPipeline *p,
                                    void *userData),
                         void *userData) {
-  if (cb) cb(MOP_NOTIMPLEMENT, NULL, NULL);
+  MopClientJob *job = new MopClientJob{this, id, type, cb, NULL, userData};
+  MopErrCode ret = MopEventLoop::instance().post(connectJob, job);
+  if (ret != MOP_PASSED) {
+    delete job;
+    if (cb) cb(ret, NULL, userData);
+  }
 }
 
 MopErrCode MopClient::disconnect(PipelineID id) {
   /*! Check the entry env */
   checkEntry();
   int32_t ret;
-  if (pipelineMap.find(id) == pipelineMap.end()) {
-    return MOP_PARM;
+  MopPipeline *pipeline;
+  {
+    std::lock_guard<std::mutex> lock(pipelineMapMutex);
+    if (pipelineMap.find(id) == pipelineMap.end()) {
+      return MOP_PARM;
+    }
+    pipeline = pipelineMap[id];
   }
-  mop_channel_handle_t handler = pipelineMap[id]->channelHandle;
+  /*! No worker may be in a read or write of the channel once it is closed */
+  pipeline->cancelAsync();
+  mop_channel_handle_t handler = pipeline->channelHandle;
 
   DSTATUS("Trying to disconnect pipeline slot : %d, channel_id : %d", slot, id);
   ret = mop_close_channel(handler);
@@ -112,5 +155,10 @@ MopErrCode MopClient::disconnect(PipelineID id) {
 void MopClient::disconnect(PipelineID id,
                            void (*cb)(MopErrCode errCode, void *userData),
                            void *userData) {
-  if (cb) cb(MOP_NOTIMPLEMENT, NULL);
+  MopClientJob *job = new MopClientJob{this, id, RELIABLE, NULL, cb, userData};
+  MopErrCode ret = MopEventLoop::instance().post(disconnectJob, job);
+  if (ret != MOP_PASSED) {
+    delete job;
+    if (cb) cb(ret, userData);
+  }
 }
@@ -0,0 +1,223 @@
+/** @file dji_mop_event_loop.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief Worker pool running the asynchronous mop operations
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "dji_mop_event_loop.hpp"
+#include "osdk_osal.h"
+#include "dji_log.hpp"
+
+using namespace DJI;
+using namespace DJI::OSDK;
+
+#define MOP_EVENT_LOOP_WORKERS 4
+
+MopEventLoop::MopEventLoop()
+    : workerCount(MOP_EVENT_LOOP_WORKERS), idleRunning(0), stopReq(false) {
+}
+
+MopEventLoop::~MopEventLoop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopReq = true;
+    workCond.notify_all();
+  }
+  for (auto &handle : workers) OsdkOsal_TaskDestroy(handle);
+}
+
+bool MopEventLoop::setWorkerCount(uint32_t count) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!workers.empty() || !count) return false;
+  workerCount = count;
+  return true;
+}
+
+uint32_t MopEventLoop::getWorkerCount() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return workerCount;
+}
+
+bool MopEventLoop::startWorkers() {
+  std::lock_guard<std::mutex> lock(mutex);
+  while (workers.size() < workerCount) {
+    T_OsdkTaskHandle handle;
+    if (OsdkOsal_TaskCreate(&handle, workerTask, OSDK_TASK_STACK_SIZE_DEFAULT,
+                            this) != OSDK_STAT_OK) {
+      DERROR("Create mop worker %d failed", (int)workers.size());
+      break;
+    }
+    workers.push_back(handle);
+  }
+  return !workers.empty();
+}
+
+MopErrCode MopEventLoop::post(JobType job, void *userData) {
+  if (!job) return MOP_PARM;
+  if (!startWorkers()) return MOP_NOMEM;
+  std::lock_guard<std::mutex> lock(mutex);
+  RunItem item = {NULL, job, userData};
+  runQueue.push_back(item);
+  workCond.notify_one();
+  return MOP_PASSED;
+}
+
+MopErrCode MopEventLoop::submit(MopAsyncQueue *queue,
+                                const MopAsyncRequest &request) {
+  if (!queue || !request.dataPacket.data) return MOP_PARM;
+  if (!startWorkers()) return MOP_NOMEM;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (queue->cancelled) return MOP_FAILED;
+  if (queue->pending.size() >= queue->depth) return MOP_RESBUSY;
+  queue->pending.push_back(request);
+  OsdkOsal_GetTimeMs(&queue->pending.back().startMs);
+  if (!queue->scheduled && !queue->busy) schedule(queue);
+  return MOP_PASSED;
+}
+
+uint32_t MopEventLoop::getIdleLimit() {
+  return (workers.size() > 1) ? workers.size() / 2 : 1;
+}
+
+bool MopEventLoop::hasWork() {
+  return !runQueue.empty() ||
+         (!idleQueue.empty() && (idleRunning < getIdleLimit()));
+}
+
+void MopEventLoop::schedule(MopAsyncQueue *queue) {
+  queue->scheduled = true;
+  if (queue->idle) {
+    idleQueue.push_back(queue);
+  } else {
+    RunItem item = {queue, NULL, NULL};
+    runQueue.push_back(item);
+  }
+  workCond.notify_one();
+}
+
+void MopEventLoop::cancel(MopAsyncQueue *queue) {
+  std::deque<MopAsyncRequest> dropped;
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    queue->cancelled = true;
+    if (queue->scheduled) {
+      for (auto it = runQueue.begin(); it != runQueue.end(); ++it) {
+        if (it->queue == queue) {
+          runQueue.erase(it);
+          break;
+        }
+      }
+      for (auto it = idleQueue.begin(); it != idleQueue.end(); ++it) {
+        if (*it == queue) {
+          idleQueue.erase(it);
+          break;
+        }
+      }
+      queue->scheduled = false;
+    }
+    /*! From a callback of the queue itself the running operation is ours */
+    if (!queue->busy || (queue->owner != std::this_thread::get_id()))
+      doneCond.wait(lock, [queue] { return !queue->busy; });
+    dropped.swap(queue->pending);
+    queue->cancelled = false;
+  }
+  for (auto &request : dropped) {
+    if (request.cb)
+      request.cb(MOP_FAILED, request.dataPacket, 0, request.userData);
+  }
+}
+
+void MopEventLoop::runOperation(MopAsyncQueue *queue,
+                                std::unique_lock<std::mutex> &lock) {
+  queue->scheduled = false;
+  queue->busy = true;
+  queue->owner = std::this_thread::get_id();
+  MopAsyncRequest request = queue->pending.front();
+  lock.unlock();
+
+  uint32_t len = 0;
+  MopErrCode ret = queue->send
+                       ? queue->pipeline->sendData(request.dataPacket, &len)
+                       : queue->pipeline->recvData(request.dataPacket, &len);
+  bool retry = false;
+  if (ret == MOP_TIMEOUT) {
+    uint32_t curMs = 0;
+    OsdkOsal_GetTimeMs(&curMs);
+    retry = !request.timeoutMs || (curMs - request.startMs < request.timeoutMs);
+  }
+
+  lock.lock();
+  queue->idle = !queue->send && (ret == MOP_TIMEOUT);
+  if (retry && !queue->cancelled) {
+    /*! Give the other pipelines a turn before trying again */
+    queue->busy = false;
+    schedule(queue);
+    return;
+  }
+  if (retry) ret = MOP_FAILED;
+  queue->pending.pop_front();
+  lock.unlock();
+
+  /*! The queue stays busy during the callback, so callbacks of a direction
+   *  run in order and one at a time */
+  if (request.cb) request.cb(ret, request.dataPacket, len, request.userData);
+
+  lock.lock();
+  queue->busy = false;
+  if (!queue->pending.empty() && !queue->cancelled) schedule(queue);
+  doneCond.notify_all();
+}
+
+void *MopEventLoop::workerTask(void *arg) {
+  MopEventLoop *loop = (MopEventLoop *)arg;
+  std::unique_lock<std::mutex> lock(loop->mutex);
+  for (;;) {
+    loop->workCond.wait(lock,
+                        [loop] { return loop->stopReq || loop->hasWork(); });
+    if (loop->stopReq) break;
+    /*! Up to the idle limit of the workers poll idle pipelines, even while
+     *  others move data, so idle ones still notice data and time out */
+    if (!loop->idleQueue.empty() &&
+        (loop->idleRunning < loop->getIdleLimit())) {
+      MopAsyncQueue *queue = loop->idleQueue.front();
+      loop->idleQueue.pop_front();
+      loop->idleRunning++;
+      loop->runOperation(queue, lock);
+      loop->idleRunning--;
+      loop->workCond.notify_one();
+      continue;
+    }
+    RunItem item = loop->runQueue.front();
+    loop->runQueue.pop_front();
+    if (item.queue) {
+      loop->runOperation(item.queue, lock);
+    } else {
+      lock.unlock();
+      item.job(item.userData);
+      lock.lock();
+    }
+  }
+  return NULL;
+}
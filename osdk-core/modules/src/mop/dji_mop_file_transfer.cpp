@@ -0,0 +1,811 @@
+/** @file dji_mop_file_transfer.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief File transfer over a mop pipeline
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "dji_mop_file_transfer.hpp"
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <condition_variable>
+#include "osdk_osal.h"
+#include "osdk_md5.h"
+
+using namespace DJI;
+using namespace DJI::OSDK;
+using namespace DJI::OSDK::MOP;
+
+#define MOP_FILE_CHUNK_SIZE (100 * 1024 - sizeof(MopFileTransfer::PackHeader))
+#define MOP_FILE_RECV_PACK_SIZE (3 * 1024 * 1024)
+#define MOP_FILE_WINDOW 4
+#define MOP_FILE_TIMEOUT_MS 5000
+#define MOP_FILE_PROGRESS_PERIOD_MS 1000
+/*! Bytes hashed at once when a download resumes */
+#define MOP_FILE_PREFIX_BLOCK (1024 * 1024)
+
+namespace {
+
+/*! Ring of window slots passing chunks from one stage to the next, one
+ *  producer and one consumer. Data starts after room for a PackHeader so a
+ *  chunk is sent or received in place. */
+class ChunkRing {
+ public:
+  ChunkRing(uint32_t count, uint32_t slotSize)
+      : count(count), slotSize(slotSize), head(0), tail(0), aborted(false),
+        stageEnded(false) {
+    buf = (uint8_t *)OsdkOsal_Malloc(count * slotSize);
+    lens = new uint32_t[count];
+    lasts = new bool[count];
+  }
+
+  ~ChunkRing() {
+    if (buf) OsdkOsal_Free(buf);
+    delete[] lens;
+    delete[] lasts;
+  }
+
+  bool valid() { return buf != NULL; }
+  uint32_t getSlotSize() { return slotSize; }
+
+  /*! Next free slot for the producer, NULL once aborted */
+  uint8_t *acquire(uint32_t &waitMs) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if ((head - tail == count) && !aborted) {
+      uint32_t t0 = 0, t1 = 0;
+      OsdkOsal_GetTimeMs(&t0);
+      cond.wait(lock, [this] { return (head - tail < count) || aborted; });
+      OsdkOsal_GetTimeMs(&t1);
+      waitMs += t1 - t0;
+    }
+    if (aborted) return NULL;
+    return buf + (head % count) * slotSize;
+  }
+
+  void commit(uint32_t len, bool last) {
+    std::lock_guard<std::mutex> lock(mutex);
+    lens[head % count] = len;
+    lasts[head % count] = last;
+    head++;
+    cond.notify_all();
+  }
+
+  /*! Oldest filled slot for the consumer, NULL once aborted */
+  uint8_t *front(uint32_t &len, bool &last, uint32_t &waitMs) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if ((head == tail) && !aborted) {
+      uint32_t t0 = 0, t1 = 0;
+      OsdkOsal_GetTimeMs(&t0);
+      cond.wait(lock, [this] { return (head != tail) || aborted; });
+      OsdkOsal_GetTimeMs(&t1);
+      waitMs += t1 - t0;
+    }
+    if (aborted) return NULL;
+    len = lens[tail % count];
+    last = lasts[tail % count];
+    return buf + (tail % count) * slotSize;
+  }
+
+  void release() {
+    std::lock_guard<std::mutex> lock(mutex);
+    tail++;
+    cond.notify_all();
+  }
+
+  void abort() {
+    std::lock_guard<std::mutex> lock(mutex);
+    aborted = true;
+    cond.notify_all();
+  }
+
+  /*! Called by the disk stage as its last access to the ring */
+  void endStage() {
+    std::lock_guard<std::mutex> lock(mutex);
+    stageEnded = true;
+    cond.notify_all();
+  }
+
+  void waitStageEnd() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cond.wait(lock, [this] { return stageEnded; });
+  }
+
+ private:
+  uint8_t *buf;
+  uint32_t *lens;
+  bool *lasts;
+  uint32_t count;
+  uint32_t slotSize;
+  uint32_t head;
+  uint32_t tail;
+  bool aborted;
+  bool stageEnded;
+  std::mutex mutex;
+  std::condition_variable cond;
+};
+
+/*! State shared by the calling thread and the disk stage task */
+typedef struct DiskStage {
+  ChunkRing *ring;
+  int fd;
+  uint32_t from;        /*!< file range read or written by the stage */
+  uint32_t to;
+  uint32_t chunkSize;
+  MD5_CTX md5Ctx;       /*!< only the write stage hashes */
+  uint32_t waitMs;
+  std::atomic<bool> failed;
+} DiskStage;
+
+const uint32_t packHeaderLen = sizeof(MopFileTransfer::PackHeader);
+
+/*! Read [from, to) ahead into the ring, one chunk per slot. An empty range
+ *  still hands over one empty last chunk. */
+void *readStageTask(void *arg) {
+  DiskStage *stage = (DiskStage *)arg;
+  uint32_t pos = stage->from;
+  bool last = false;
+  while (!last) {
+    uint8_t *slot = stage->ring->acquire(stage->waitMs);
+    if (!slot) break;
+    uint32_t len = stage->to - pos;
+    if (len > stage->chunkSize) len = stage->chunkSize;
+    uint32_t done = 0;
+    while (done < len) {
+      ssize_t ret = pread(stage->fd, slot + packHeaderLen + done, len - done,
+                          (off_t)pos + done);
+      if (ret <= 0) break;
+      done += ret;
+    }
+    if (done < len) {
+      DERROR("Read file failed at %u", pos + done);
+      stage->failed = true;
+      stage->ring->abort();
+      break;
+    }
+    pos += len;
+    last = (pos >= stage->to);
+    stage->ring->commit(len, last);
+  }
+  stage->ring->endStage();
+  return NULL;
+}
+
+/*! Hash what the file already holds before a resumed download, then write
+ *  and hash the received chunks in order */
+void *writeStageTask(void *arg) {
+  DiskStage *stage = (DiskStage *)arg;
+  uint8_t *block = NULL;
+  if (stage->from) block = (uint8_t *)OsdkOsal_Malloc(MOP_FILE_PREFIX_BLOCK);
+  for (uint32_t pos = 0; pos < stage->from;) {
+    uint32_t len = stage->from - pos;
+    if (len > MOP_FILE_PREFIX_BLOCK) len = MOP_FILE_PREFIX_BLOCK;
+    ssize_t ret = block ? pread(stage->fd, block, len, pos) : -1;
+    if (ret <= 0) {
+      DERROR("Read the kept part of the file failed at %u", pos);
+      stage->failed = true;
+      stage->ring->abort();
+      break;
+    }
+    OsdkMd5_Update(&stage->md5Ctx, block, ret);
+    pos += ret;
+  }
+  if (block) OsdkOsal_Free(block);
+
+  uint32_t pos = stage->from;
+  bool last = stage->failed;
+  while (!last) {
+    uint32_t len = 0;
+    uint8_t *slot = stage->ring->front(len, last, stage->waitMs);
+    if (!slot) break;
+    uint32_t done = 0;
+    while (done < len) {
+      ssize_t ret = pwrite(stage->fd, slot + packHeaderLen + done, len - done,
+                           (off_t)pos + done);
+      if (ret <= 0) break;
+      done += ret;
+    }
+    if (done < len) {
+      DERROR("Write file failed at %u", pos + done);
+      stage->failed = true;
+      stage->ring->abort();
+      break;
+    }
+    OsdkMd5_Update(&stage->md5Ctx, slot + packHeaderLen, len);
+    pos += len;
+    stage->ring->release();
+  }
+  stage->ring->endStage();
+  return NULL;
+}
+
+/*! Start a stage task, true once it is running */
+bool startStage(T_OsdkTaskHandle &handle, void *(*task)(void *),
+                DiskStage &stage) {
+  stage.waitMs = 0;
+  stage.failed = false;
+  if (OsdkOsal_TaskCreate(&handle, task, OSDK_TASK_STACK_SIZE_DEFAULT,
+                          &stage) != OSDK_STAT_OK) {
+    DERROR("Create file transfer disk task failed.");
+    return false;
+  }
+  return true;
+}
+
+/*! Wake the task up if needed and wait for it to end, it is only joined
+ *  once done as OsdkOsal_TaskDestroy cancels it */
+void stopStage(T_OsdkTaskHandle handle, DiskStage &stage, bool abort) {
+  if (abort) stage.ring->abort();
+  stage.ring->waitStageEnd();
+  OsdkOsal_TaskDestroy(handle);
+}
+
+}  // namespace
+
+MopFileTransfer::MopFileTransfer(MopPipeline *pipeline)
+    : pipeline(pipeline), progressCb(NULL), progressUserData(NULL),
+      cancelReq(false), startMs(0), lastProgressMs(0), rttTotalMs(0) {
+  config.chunkSize = MOP_FILE_CHUNK_SIZE;
+  config.recvPackSize = MOP_FILE_RECV_PACK_SIZE;
+  config.window = MOP_FILE_WINDOW;
+  config.timeoutMs = MOP_FILE_TIMEOUT_MS;
+  memset(&stats, 0, sizeof(stats));
+}
+
+MopFileTransfer::~MopFileTransfer() {
+}
+
+void MopFileTransfer::setConfig(const Config &config) {
+  this->config = config;
+  if (!this->config.chunkSize) this->config.chunkSize = MOP_FILE_CHUNK_SIZE;
+  if (this->config.recvPackSize <= packHeaderLen)
+    this->config.recvPackSize = MOP_FILE_RECV_PACK_SIZE;
+  if (!this->config.window) this->config.window = MOP_FILE_WINDOW;
+  if (!this->config.timeoutMs) this->config.timeoutMs = MOP_FILE_TIMEOUT_MS;
+}
+
+MopFileTransfer::Config MopFileTransfer::getConfig() {
+  return config;
+}
+
+void MopFileTransfer::setProgressCB(ProgressCBType cb, void *userData) {
+  progressCb = cb;
+  progressUserData = userData;
+}
+
+void MopFileTransfer::cancel() {
+  cancelReq = true;
+}
+
+MopFileTransfer::Stats MopFileTransfer::getStats() {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  return stats;
+}
+
+void MopFileTransfer::resetStats(uint64_t fileSize, uint64_t offset) {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  memset(&stats, 0, sizeof(stats));
+  stats.fileSize = fileSize;
+  stats.offset = offset;
+  rttTotalMs = 0;
+  OsdkOsal_GetTimeMs(&startMs);
+  lastProgressMs = startMs;
+}
+
+void MopFileTransfer::addRtt(uint32_t rttMs) {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  if (!stats.rttCnt || (rttMs < stats.rttMinMs)) stats.rttMinMs = rttMs;
+  if (rttMs > stats.rttMaxMs) stats.rttMaxMs = rttMs;
+  stats.rttLastMs = rttMs;
+  stats.rttCnt++;
+  rttTotalMs += rttMs;
+  stats.rttAvgMs = (uint32_t)(rttTotalMs / stats.rttCnt);
+}
+
+void MopFileTransfer::addWait(uint32_t channelWaitMs, uint32_t diskWaitMs) {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  stats.channelWaitMs += channelWaitMs;
+  stats.diskWaitMs += diskWaitMs;
+}
+
+void MopFileTransfer::reportProgress(bool finished) {
+  uint32_t curMs = 0;
+  OsdkOsal_GetTimeMs(&curMs);
+  if (!finished && (curMs - lastProgressMs < MOP_FILE_PROGRESS_PERIOD_MS))
+    return;
+  lastProgressMs = curMs;
+
+  Stats cur;
+  {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    stats.elapsedMs = curMs - startMs;
+    cur = stats;
+  }
+  if (progressCb) progressCb(cur, progressUserData);
+}
+
+MopErrCode MopFileTransfer::sendPack(uint8_t cmd, uint8_t subcmd,
+                                     const void *data, uint32_t len) {
+  PackHeader header = {cmd, subcmd, 0, len};
+  MopPipeline::DataPackType packs[2] = {{(uint8_t *)&header, packHeaderLen},
+                                        {(uint8_t *)data, len}};
+  uint32_t sentLen = 0;
+  MopErrCode ret = pipeline->sendv(packs, len ? 2 : 1, &sentLen);
+  if ((ret == MOP_PASSED) && (sentLen != packHeaderLen + len)) return MOP_SEND;
+  return ret;
+}
+
+MopErrCode MopFileTransfer::recvPack(uint8_t *buf, uint32_t size,
+                                     uint32_t &len) {
+  uint32_t t0 = 0;
+  uint32_t curMs = 0;
+  OsdkOsal_GetTimeMs(&t0);
+  for (;;) {
+    if (cancelReq) return MOP_FAILED;
+    MopPipeline::DataPackType pack = {buf, size};
+    len = 0;
+    MopErrCode ret = pipeline->recvData(pack, &len);
+    /*! The samples send short packs without dataLen for some answers */
+    if ((ret == MOP_PASSED) && (len >= 4)) {
+      if (len < packHeaderLen) memset(buf + len, 0, packHeaderLen - len);
+      return MOP_PASSED;
+    }
+    if ((ret != MOP_PASSED) && (ret != MOP_TIMEOUT)) return ret;
+    OsdkOsal_GetTimeMs(&curMs);
+    if (curMs - t0 >= config.timeoutMs) return MOP_TIMEOUT;
+  }
+}
+
+MopErrCode MopFileTransfer::recvCtrl(uint32_t &len) {
+  return recvPack(ctrlBuf, sizeof(ctrlBuf), len);
+}
+
+MopErrCode MopFileTransfer::request(uint8_t cmd, uint8_t subcmd,
+                                    const void *data, uint32_t len,
+                                    uint8_t answerCmd, uint32_t &answerLen) {
+  uint32_t t0 = 0;
+  uint32_t t1 = 0;
+  OsdkOsal_GetTimeMs(&t0);
+  MopErrCode ret = sendPack(cmd, subcmd, data, len);
+  if (ret != MOP_PASSED) return ret;
+  ret = recvCtrl(answerLen);
+  if (ret != MOP_PASSED) return ret;
+  OsdkOsal_GetTimeMs(&t1);
+  addRtt(t1 - t0);
+
+  PackHeader *answer = (PackHeader *)ctrlBuf;
+  if (answer->cmd != answerCmd) {
+    DERROR("Pack 0x%02X answered with 0x%02X", cmd, answer->cmd);
+    return MOP_FAILED;
+  }
+  if ((answerCmd == CMD_ACK) && (answer->subcmd != ACK_OK)) {
+    DERROR("Pack 0x%02X rejected by the peer", cmd);
+    return MOP_FAILED;
+  }
+  return MOP_PASSED;
+}
+
+MopErrCode MopFileTransfer::hashFile(FILE *fp, uint32_t size, uint8_t md5[16]) {
+  MD5_CTX md5Ctx;
+  OsdkMd5_Init(&md5Ctx);
+  ChunkRing ring(config.window, packHeaderLen + config.chunkSize);
+  if (!ring.valid()) return MOP_NOMEM;
+
+  DiskStage stage;
+  stage.ring = &ring;
+  stage.fd = fileno(fp);
+  stage.from = 0;
+  stage.to = size;
+  stage.chunkSize = config.chunkSize;
+  T_OsdkTaskHandle handle;
+  if (!startStage(handle, readStageTask, stage)) return MOP_NOMEM;
+
+  /*! Hash chunk n while chunk n + 1 is read */
+  uint32_t waitMs = 0;
+  bool last = false;
+  while (!last) {
+    uint32_t len = 0;
+    uint8_t *slot = ring.front(len, last, waitMs);
+    if (!slot || cancelReq) break;
+    OsdkMd5_Update(&md5Ctx, slot + packHeaderLen, len);
+    ring.release();
+  }
+  stopStage(handle, stage, !last);
+  addWait(waitMs, stage.waitMs);
+  if (!last || stage.failed) return MOP_FAILED;
+  OsdkMd5_Final(&md5Ctx, md5);
+  return MOP_PASSED;
+}
+
+MopErrCode MopFileTransfer::sendFileData(FILE *fp, uint32_t offset,
+                                         uint32_t size) {
+  ChunkRing ring(config.window, packHeaderLen + config.chunkSize);
+  if (!ring.valid()) return MOP_NOMEM;
+
+  DiskStage stage;
+  stage.ring = &ring;
+  stage.fd = fileno(fp);
+  stage.from = offset;
+  stage.to = size;
+  stage.chunkSize = config.chunkSize;
+  T_OsdkTaskHandle handle;
+  if (!startStage(handle, readStageTask, stage)) return MOP_NOMEM;
+
+  uint32_t t0 = 0;
+  uint32_t t1 = 0;
+  uint32_t waitMs = 0;
+  uint16_t seq = 0;
+  bool last = false;
+  MopErrCode ret = MOP_PASSED;
+  OsdkOsal_GetTimeMs(&t0);
+  while (!last) {
+    uint32_t len = 0;
+    uint8_t *slot = ring.front(len, last, waitMs);
+    if (!slot) {
+      ret = MOP_FAILED;
+      break;
+    }
+    if (cancelReq) {
+      ret = MOP_FAILED;
+      break;
+    }
+
+    /*! The header goes in front of the chunk, the pack is sent in place */
+    PackHeader *header = (PackHeader *)slot;
+    header->cmd = CMD_FILEDATA;
+    header->subcmd = last ? END_PACK : NORMAL_PACK;
+    header->seq = seq++;
+    header->dataLen = len;
+    MopPipeline::DataPackType pack = {slot, packHeaderLen + len};
+    uint32_t sentLen = 0;
+    do {
+      ret = pipeline->sendData(pack, &sentLen);
+    } while ((ret == MOP_TIMEOUT) && !cancelReq);
+    if ((ret == MOP_PASSED) && (sentLen != pack.length)) ret = MOP_SEND;
+    if (ret != MOP_PASSED) {
+      DERROR("Send file data failed, stat:%d", ret);
+      break;
+    }
+    ring.release();
+
+    OsdkOsal_GetTimeMs(&t1);
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      stats.bytesDone += len;
+      stats.packs++;
+      stats.dataMs = t1 - t0;
+      stats.bytesPerSec =
+          stats.dataMs ? (uint32_t)(stats.bytesDone * 1000 / stats.dataMs) : 0;
+    }
+    reportProgress(false);
+  }
+  stopStage(handle, stage, ret != MOP_PASSED);
+  addWait(waitMs, stage.waitMs);
+  if ((ret == MOP_PASSED) && stage.failed) ret = MOP_FAILED;
+  return ret;
+}
+
+MopErrCode MopFileTransfer::recvFileData(FILE *fp, uint32_t offset,
+                                         uint32_t size, const uint8_t md5[16]) {
+  ChunkRing ring(config.window, config.recvPackSize);
+  if (!ring.valid()) return MOP_NOMEM;
+
+  DiskStage stage;
+  stage.ring = &ring;
+  stage.fd = fileno(fp);
+  stage.from = offset;
+  stage.to = size;
+  stage.chunkSize = config.recvPackSize - packHeaderLen;
+  OsdkMd5_Init(&stage.md5Ctx);
+  T_OsdkTaskHandle handle;
+  if (!startStage(handle, writeStageTask, stage)) return MOP_NOMEM;
+
+  uint32_t t0 = 0;
+  uint32_t t1 = 0;
+  uint32_t waitMs = 0;
+  uint32_t pos = offset;
+  bool last = false;
+  MopErrCode ret = MOP_PASSED;
+  OsdkOsal_GetTimeMs(&t0);
+  while (!last) {
+    uint8_t *slot = ring.acquire(waitMs);
+    if (!slot) {
+      ret = MOP_FAILED;
+      break;
+    }
+
+    /*! Received straight into the slot the write stage takes it from */
+    uint32_t len = 0;
+    ret = recvPack(slot, config.recvPackSize, len);
+    if (ret != MOP_PASSED) {
+      DERROR("Receive file data failed, stat:%d", ret);
+      break;
+    }
+    PackHeader *header = (PackHeader *)slot;
+    if ((header->cmd != CMD_FILEDATA) ||
+        (header->dataLen > len - packHeaderLen) ||
+        (header->dataLen > size - pos)) {
+      DERROR("Unexpected pack 0x%02X of %u bytes at %u", header->cmd,
+             header->dataLen, pos);
+      ret = MOP_FAILED;
+      break;
+    }
+    pos += header->dataLen;
+    /*! Some senders never flag a pack that ends the file exactly */
+    last = (header->subcmd == END_PACK) || ((pos == size) && (pos > offset));
+    ring.commit(header->dataLen, last);
+
+    OsdkOsal_GetTimeMs(&t1);
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      stats.bytesDone += header->dataLen;
+      stats.packs++;
+      stats.dataMs = t1 - t0;
+      stats.bytesPerSec =
+          stats.dataMs ? (uint32_t)(stats.bytesDone * 1000 / stats.dataMs) : 0;
+    }
+    reportProgress(false);
+  }
+  stopStage(handle, stage, ret != MOP_PASSED);
+  addWait(waitMs, stage.waitMs);
+  if ((ret == MOP_PASSED) && (stage.failed || (pos != size))) {
+    DERROR("File data ended at %u of %u", pos, size);
+    ret = MOP_FAILED;
+  }
+  if (ret != MOP_PASSED) return ret;
+
+  uint8_t localMd5[16];
+  OsdkMd5_Final(&stage.md5Ctx, localMd5);
+  if (memcmp(localMd5, md5, sizeof(localMd5)) != 0) {
+    DERROR("MD5 of the received file does not match");
+    return MOP_FAILED;
+  }
+  return MOP_PASSED;
+}
+
+bool MopFileTransfer::isValidName(const std::string &name) {
+  return !name.empty() && (name.size() < sizeof(((FileInfo *)0)->fileName)) &&
+         (name.find('/') == std::string::npos) && (name != ".") &&
+         (name != "..");
+}
+
+MopErrCode MopFileTransfer::getFileSize(FILE *fp, uint32_t &size) {
+  struct stat st;
+  if ((fstat(fileno(fp), &st) != 0) || (st.st_size > (off_t)UINT32_MAX))
+    return MOP_PARM;
+  size = (uint32_t)st.st_size;
+  return MOP_PASSED;
+}
+
+#define RETURN_IF_FAILED(ret)                              \
+  do {                                                     \
+    MopErrCode _ret = (ret);                               \
+    if (_ret != MOP_PASSED) {                              \
+      if (fp) fclose(fp);                                  \
+      reportProgress(true);                                \
+      return _ret;                                         \
+    }                                                      \
+  } while (0)
+
+MopErrCode MopFileTransfer::upload(const std::string &localPath,
+                                   const std::string &remoteName,
+                                   uint32_t offset) {
+  if (!pipeline || !isValidName(remoteName)) return MOP_PARM;
+  FILE *fp = fopen(localPath.c_str(), "rb");
+  if (!fp) {
+    DERROR("Open %s failed", localPath.c_str());
+    return MOP_PARM;
+  }
+  uint32_t size = 0;
+  cancelReq = false;
+  RETURN_IF_FAILED(getFileSize(fp, size));
+  RETURN_IF_FAILED((offset > size) ? MOP_PARM : MOP_PASSED);
+  resetStats(size, offset);
+
+  FileInfo info;
+  memset(&info, 0, sizeof(info));
+  info.isExist = true;
+  info.fileLength = size;
+  /*! isValidName keeps it shorter than fileName, the rest stays 0 */
+  memcpy(info.fileName, remoteName.data(), remoteName.size());
+  RETURN_IF_FAILED(hashFile(fp, size, info.md5Buf));
+
+  uint32_t len = 0;
+  RETURN_IF_FAILED(request(CMD_REQUEST, REQ_UPLOAD, NULL, 0, CMD_ACK, len));
+  if (offset) {
+    RETURN_IF_FAILED(request(CMD_FILE_OFFSET, SUBCMD_DEFAULT, &offset,
+                             sizeof(offset), CMD_ACK, len));
+  }
+  RETURN_IF_FAILED(request(CMD_FILEINFO, SUBCMD_DEFAULT, &info, sizeof(info),
+                           CMD_ACK, len));
+  RETURN_IF_FAILED(sendFileData(fp, offset, size));
+
+  /*! The peer checks the MD5 and answers with the result */
+  uint32_t t0 = 0;
+  uint32_t t1 = 0;
+  OsdkOsal_GetTimeMs(&t0);
+  RETURN_IF_FAILED(recvCtrl(len));
+  OsdkOsal_GetTimeMs(&t1);
+  addRtt(t1 - t0);
+  PackHeader *result = (PackHeader *)ctrlBuf;
+  RETURN_IF_FAILED(((result->cmd == CMD_RESULT) && (result->subcmd == RET_OK))
+                       ? MOP_PASSED
+                       : MOP_FAILED);
+  fclose(fp);
+  reportProgress(true);
+  return MOP_PASSED;
+}
+
+MopErrCode MopFileTransfer::download(const std::string &remoteName,
+                                     const std::string &localPath,
+                                     uint32_t offset) {
+  if (!pipeline || !isValidName(remoteName)) return MOP_PARM;
+  FILE *fp = fopen(localPath.c_str(), offset ? "r+b" : "w+b");
+  if (!fp) {
+    DERROR("Open %s failed", localPath.c_str());
+    return MOP_PARM;
+  }
+  uint32_t localSize = 0;
+  cancelReq = false;
+  RETURN_IF_FAILED(getFileSize(fp, localSize));
+  RETURN_IF_FAILED((offset > localSize) ? MOP_PARM : MOP_PASSED);
+  resetStats(0, offset);
+
+  uint32_t len = 0;
+  RETURN_IF_FAILED(request(CMD_REQUEST, REQ_DOWNLOAD, NULL, 0, CMD_ACK, len));
+  if (offset) {
+    RETURN_IF_FAILED(request(CMD_FILE_OFFSET, SUBCMD_DEFAULT, &offset,
+                             sizeof(offset), CMD_ACK, len));
+  }
+  char name[sizeof(((FileInfo *)0)->fileName)] = {0};
+  memcpy(name, remoteName.data(), remoteName.size());
+  RETURN_IF_FAILED(request(CMD_DL_FILENAME, SUBCMD_DEFAULT, name, sizeof(name),
+                           CMD_FILEINFO, len));
+  FileInfo info;
+  memcpy(&info, ctrlBuf + packHeaderLen, sizeof(info));
+  if ((len < sizeof(ctrlBuf)) || !info.isExist || (offset > info.fileLength)) {
+    DERROR("File %s is not available for download", name);
+    sendPack(CMD_RESULT, RET_FAIL, NULL, 0);
+    RETURN_IF_FAILED(MOP_FAILED);
+  }
+  {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    stats.fileSize = info.fileLength;
+  }
+
+  MopErrCode ret = recvFileData(fp, offset, info.fileLength, info.md5Buf);
+  if ((ret == MOP_PASSED) && (ftruncate(fileno(fp), info.fileLength) != 0))
+    ret = MOP_FAILED;
+  MopErrCode resultRet =
+      sendPack(CMD_RESULT, (ret == MOP_PASSED) ? RET_OK : RET_FAIL, NULL, 0);
+  RETURN_IF_FAILED(ret);
+  RETURN_IF_FAILED(resultRet);
+  fclose(fp);
+  reportProgress(true);
+  return MOP_PASSED;
+}
+
+MopErrCode MopFileTransfer::serve(const std::string &localDir) {
+  if (!pipeline) return MOP_PARM;
+  FILE *fp = NULL;
+  uint32_t len = 0;
+  uint32_t offset = 0;
+  PackHeader *pack = (PackHeader *)ctrlBuf;
+  cancelReq = false;
+
+  /*! Anything before a request is left over from an earlier transfer */
+  for (;;) {
+    MopErrCode ret = recvCtrl(len);
+    if (ret == MOP_TIMEOUT) continue;
+    if (ret != MOP_PASSED) return ret;
+    if ((pack->cmd == CMD_REQUEST) &&
+        ((pack->subcmd == REQ_UPLOAD) || (pack->subcmd == REQ_DOWNLOAD)))
+      break;
+  }
+  bool upload = (pack->subcmd == REQ_UPLOAD);
+  resetStats(0, 0);
+  RETURN_IF_FAILED(sendPack(CMD_ACK, ACK_OK, NULL, 0));
+
+  RETURN_IF_FAILED(recvCtrl(len));
+  if (pack->cmd == CMD_FILE_OFFSET) {
+    if (len >= packHeaderLen + sizeof(offset))
+      memcpy(&offset, ctrlBuf + packHeaderLen, sizeof(offset));
+    RETURN_IF_FAILED(sendPack(CMD_ACK, ACK_OK, NULL, 0));
+    RETURN_IF_FAILED(recvCtrl(len));
+  }
+
+  if (upload) {
+    FileInfo info;
+    memcpy(&info, ctrlBuf + packHeaderLen, sizeof(info));
+    info.fileName[sizeof(info.fileName) - 1] = '\0';
+    std::string path = localDir + "/" + info.fileName;
+    if ((pack->cmd == CMD_FILEINFO) && (len >= sizeof(ctrlBuf)) &&
+        isValidName(info.fileName) && (offset <= info.fileLength)) {
+      fp = fopen(path.c_str(), offset ? "r+b" : "w+b");
+    }
+    uint32_t localSize = 0;
+    if (fp && ((getFileSize(fp, localSize) != MOP_PASSED) ||
+               (offset > localSize))) {
+      fclose(fp);
+      fp = NULL;
+    }
+    if (!fp) {
+      DERROR("Upload of %s rejected", path.c_str());
+      sendPack(CMD_ACK, ACK_REJECT, NULL, 0);
+      RETURN_IF_FAILED(MOP_FAILED);
+    }
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      stats.fileSize = info.fileLength;
+      stats.offset = offset;
+    }
+    RETURN_IF_FAILED(sendPack(CMD_ACK, ACK_OK, NULL, 0));
+
+    MopErrCode ret = recvFileData(fp, offset, info.fileLength, info.md5Buf);
+    if ((ret == MOP_PASSED) && (ftruncate(fileno(fp), info.fileLength) != 0))
+      ret = MOP_FAILED;
+    MopErrCode resultRet =
+        sendPack(CMD_RESULT, (ret == MOP_PASSED) ? RET_OK : RET_FAIL, NULL, 0);
+    RETURN_IF_FAILED(ret);
+    RETURN_IF_FAILED(resultRet);
+  } else {
+    char name[sizeof(((FileInfo *)0)->fileName)] = {0};
+    memcpy(name, ctrlBuf + packHeaderLen, sizeof(name) - 1);
+    std::string path = localDir + "/" + name;
+    FileInfo info;
+    memset(&info, 0, sizeof(info));
+    memcpy(info.fileName, name, sizeof(name) - 1);
+    uint32_t size = 0;
+    if ((pack->cmd == CMD_DL_FILENAME) && isValidName(name))
+      fp = fopen(path.c_str(), "rb");
+    if (fp && ((getFileSize(fp, size) != MOP_PASSED) || (offset > size))) {
+      fclose(fp);
+      fp = NULL;
+    }
+    if (!fp) {
+      DERROR("Download of %s rejected", path.c_str());
+      sendPack(CMD_FILEINFO, SUBCMD_DEFAULT, &info, sizeof(info));
+      RETURN_IF_FAILED(MOP_FAILED);
+    }
+    info.isExist = true;
+    info.fileLength = size;
+    {
+      std::lock_guard<std::mutex> lock(statsMutex);
+      stats.fileSize = size;
+      stats.offset = offset;
+    }
+    RETURN_IF_FAILED(hashFile(fp, size, info.md5Buf));
+    RETURN_IF_FAILED(
+        sendPack(CMD_FILEINFO, SUBCMD_DEFAULT, &info, sizeof(info)));
+    RETURN_IF_FAILED(sendFileData(fp, offset, size));
+
+    RETURN_IF_FAILED(recvCtrl(len));
+    RETURN_IF_FAILED(((pack->cmd == CMD_RESULT) && (pack->subcmd == RET_OK))
+                         ? MOP_PASSED
+                         : MOP_FAILED);
+  }
+  fclose(fp);
+  reportProgress(true);
+  return MOP_PASSED;
+}
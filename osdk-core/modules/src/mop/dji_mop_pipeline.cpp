@@ -27,13 +27,42 @@
  */
 
 #include "dji_mop_pipeline.hpp"
+#include "dji_mop_event_loop.hpp"
 #include "mop.h"
+#include "osdk_osal.h"
+#include <string.h>
+
+#define MOP_ASYNC_QUEUE_DEPTH 8
 
 MopPipeline::MopPipeline(PipelineID id, PipelineType type) : id(id),
-                                                             type(type) {
+                                                             type(type),
+                                                             leased(false) {
+  txBuf.data = NULL;
+  txBuf.size = 0;
+  rxBuf.data = NULL;
+  rxBuf.size = 0;
+
+  txQueue = new MopAsyncQueue();
+  txQueue->pipeline = this;
+  txQueue->send = true;
+  rxQueue = new MopAsyncQueue();
+  rxQueue->pipeline = this;
+  rxQueue->send = false;
+  for (MopAsyncQueue *queue : {txQueue, rxQueue}) {
+    queue->depth = MOP_ASYNC_QUEUE_DEPTH;
+    queue->scheduled = false;
+    queue->busy = false;
+    queue->idle = false;
+    queue->cancelled = false;
+  }
 }
 
 MopPipeline::~MopPipeline() {
+  cancelAsync();
+  delete txQueue;
+  delete rxQueue;
+  if (txBuf.data) OsdkOsal_Free(txBuf.data);
+  if (rxBuf.data) OsdkOsal_Free(rxBuf.data);
 }
 
 MopErrCode MopPipeline::sendData(DataPackType dataPacket, uint32_t *len) {
@@ -67,6 +96,150 @@ MopErrCode MopPipeline::recvData(DataPackType dataPacket, uint32_t *len) {
   }
 }
 
+bool MopPipeline::reserveBuffer(PipelineBuffer &buf, uint32_t size) {
+  if (buf.size >= size) return true;
+  uint8_t *data = (uint8_t *)OsdkOsal_Malloc(size);
+  if (!data) return false;
+  if (buf.data) OsdkOsal_Free(buf.data);
+  buf.data = data;
+  buf.size = size;
+  return true;
+}
+
+uint8_t *MopPipeline::getContiguous(const DataPackType *dataPackets,
+                                    uint32_t count, uint64_t &total) {
+  uint8_t *start = NULL;
+  uint8_t *next = NULL;
+  bool contiguous = true;
+  total = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    if (!dataPackets[i].length) continue;
+    if (!start) start = dataPackets[i].data;
+    else if (dataPackets[i].data != next) contiguous = false;
+    next = dataPackets[i].data + dataPackets[i].length;
+    total += dataPackets[i].length;
+  }
+  return contiguous ? start : NULL;
+}
+
+MopErrCode MopPipeline::sendv(const DataPackType *dataPackets, uint32_t count,
+                              uint32_t *len) {
+  if (!this->channelHandle) return MOP_UNKNOWN_ERR;
+  if (!dataPackets || !count || !len) return MOP_PARM;
+
+  uint64_t total = 0;
+  uint8_t *data = getContiguous(dataPackets, count, total);
+  if (!total || (total > ONCE_READ_WRITE_SIZE)) return MOP_PARM;
+
+  if (!data) {
+    if (!reserveBuffer(txBuf, (uint32_t)total)) return MOP_NOMEM;
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < count; i++) {
+      if (!dataPackets[i].length) continue;
+      memcpy(txBuf.data + offset, dataPackets[i].data, dataPackets[i].length);
+      offset += dataPackets[i].length;
+    }
+    data = txBuf.data;
+  }
+
+  int32_t ret = mop_write_channel(this->channelHandle, data, (uint32_t)total);
+  if (ret < 0) {
+    return getMopErrCode(ret);
+  } else {
+    *len = ret;
+    return MOP_PASSED;
+  }
+}
+
+MopErrCode MopPipeline::recvv(const DataPackType *dataPackets, uint32_t count,
+                              uint32_t *len) {
+  if (!this->channelHandle) return MOP_UNKNOWN_ERR;
+  if (!dataPackets || !count || !len) return MOP_PARM;
+
+  uint64_t total = 0;
+  uint8_t *data = getContiguous(dataPackets, count, total);
+  if (!total || (total > ONCE_READ_WRITE_SIZE)) return MOP_PARM;
+  if (data) {
+    DataPackType dataPacket = {data, (uint32_t)total};
+    return recvData(dataPacket, len);
+  }
+
+  if (leased.exchange(true)) return MOP_RESBUSY;
+  if (!reserveBuffer(rxBuf, (uint32_t)total)) {
+    leased = false;
+    return MOP_NOMEM;
+  }
+  int32_t ret = mop_read_channel(this->channelHandle, rxBuf.data,
+                                 (uint32_t)total);
+  if (ret < 0) {
+    leased = false;
+    return getMopErrCode(ret);
+  }
+
+  uint32_t offset = 0;
+  for (uint32_t i = 0; (i < count) && (offset < (uint32_t)ret); i++) {
+    uint32_t cpLen = dataPackets[i].length;
+    if (cpLen > (uint32_t)ret - offset) cpLen = (uint32_t)ret - offset;
+    if (!cpLen) continue;
+    memcpy(dataPackets[i].data, rxBuf.data + offset, cpLen);
+    offset += cpLen;
+  }
+  leased = false;
+  *len = ret;
+  return MOP_PASSED;
+}
+
+MopErrCode MopPipeline::recvLease(uint32_t maxLength,
+                                  DataPackType *dataPacket) {
+  if (!this->channelHandle) return MOP_UNKNOWN_ERR;
+  if (!dataPacket || !maxLength || (maxLength > ONCE_READ_WRITE_SIZE))
+    return MOP_PARM;
+  if (leased.exchange(true)) return MOP_RESBUSY;
+  if (!reserveBuffer(rxBuf, maxLength)) {
+    leased = false;
+    return MOP_NOMEM;
+  }
+
+  int32_t ret = mop_read_channel(this->channelHandle, rxBuf.data, maxLength);
+  if (ret < 0) {
+    leased = false;
+    return getMopErrCode(ret);
+  }
+  dataPacket->data = rxBuf.data;
+  dataPacket->length = ret;
+  return MOP_PASSED;
+}
+
+void MopPipeline::releaseLease() {
+  leased = false;
+}
+
+MopErrCode MopPipeline::sendDataAsync(DataPackType dataPacket, AsyncCBType cb,
+                                      void *userData, uint32_t timeoutMs) {
+  MopAsyncRequest request = {dataPacket, cb, userData, timeoutMs, 0};
+  return MopEventLoop::instance().submit(txQueue, request);
+}
+
+MopErrCode MopPipeline::recvDataAsync(DataPackType dataPacket, AsyncCBType cb,
+                                      void *userData, uint32_t timeoutMs) {
+  MopAsyncRequest request = {dataPacket, cb, userData, timeoutMs, 0};
+  return MopEventLoop::instance().submit(rxQueue, request);
+}
+
+void MopPipeline::setAsyncQueueDepth(uint32_t depth) {
+  txQueue->depth = depth ? depth : 1;
+  rxQueue->depth = depth ? depth : 1;
+}
+
+uint32_t MopPipeline::getAsyncQueueDepth() {
+  return txQueue->depth;
+}
+
+void MopPipeline::cancelAsync() {
+  MopEventLoop::instance().cancel(txQueue);
+  MopEventLoop::instance().cancel(rxQueue);
+}
+
 PipelineID MopPipeline::getId() {
   return this->id;
 }
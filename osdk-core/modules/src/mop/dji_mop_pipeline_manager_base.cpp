@@ -35,18 +35,25 @@
 #include <atomic>
 
 map<PipelineID, MopPipeline*> pipelineMap;
+std::mutex pipelineMapMutex;
 static std::atomic<uint16_t> mopObjectCnt(0);
+static std::mutex mopEntryMutex;
 
 MopPipelineManagerBase::MopPipelineManagerBase() {
+  std::lock_guard<std::mutex> lock(pipelineMapMutex);
   pipelineMap.clear();
 }
 
 MopPipelineManagerBase::~MopPipelineManagerBase() {
-  if (mopObjectCnt) {
-    mopObjectCnt--;
-    OsdkCommand_DestroyMopTask();
-    DSTATUS("MOP background task now is deleted.");
+  {
+    std::lock_guard<std::mutex> lock(mopEntryMutex);
+    if (mopObjectCnt) {
+      mopObjectCnt--;
+      OsdkCommand_DestroyMopTask();
+      DSTATUS("MOP background task now is deleted.");
+    }
   }
+  std::lock_guard<std::mutex> lock(pipelineMapMutex);
   pipelineMap.clear();
 }
 
@@ -55,6 +62,7 @@ MopErrCode MopPipelineManagerBase::create(PipelineID id, MopPipeline *&p) {
   checkEntry();
   p = new MopPipeline(id, UNRELIABLE);
   if (p) {
+    std::lock_guard<std::mutex> lock(pipelineMapMutex);
     pipelineMap.insert(map<PipelineID, MopPipeline *>::value_type(id, p));
     return MOP_PASSED;
   } else {
@@ -65,15 +73,21 @@ MopErrCode MopPipelineManagerBase::create(PipelineID id, MopPipeline *&p) {
 MopErrCode MopPipelineManagerBase::destroy(PipelineID id) {
   /*! Check the entry env */
   checkEntry();
-  if (pipelineMap.find(id)!=pipelineMap.end()) {
-    delete pipelineMap[id];
-    pipelineMap.erase(id);
+  MopPipeline *p = NULL;
+  {
+    std::lock_guard<std::mutex> lock(pipelineMapMutex);
+    if (pipelineMap.find(id) != pipelineMap.end()) {
+      p = pipelineMap[id];
+      pipelineMap.erase(id);
+    }
   }
+  delete p;
 
   return MOP_PASSED;
 }
 
 void MopPipelineManagerBase::checkEntry() {
+  std::lock_guard<std::mutex> lock(mopEntryMutex);
   if (!mopObjectCnt) {
     mopObjectCnt++;
     OsdkCommand_CreateMopTask();
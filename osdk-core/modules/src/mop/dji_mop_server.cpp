@@ -27,12 +27,39 @@
  */
 
 #include "dji_mop_server.hpp"
+#include "dji_mop_event_loop.hpp"
 #include "mop.h"
 
 #define ACCEPT_RETRY_TIMES 3
 
 using namespace std;
 
+/*! Arguments of a non-blocking accept or close */
+typedef struct MopServerJob {
+  MopServer *server;
+  PipelineID id;
+  PipelineType type;
+  void (*acceptCb)(MopErrCode errCode, MopPipeline *p, void *userData);
+  void (*closeCb)(MopErrCode errCode, void *userData);
+  void *userData;
+} MopServerJob;
+
+static void acceptJob(void *arg) {
+  MopServerJob *job = (MopServerJob *)arg;
+  MopPipeline *p = NULL;
+  MopErrCode ret = job->server->accept(job->id, job->type, p);
+  if (job->acceptCb)
+    job->acceptCb(ret, (ret == MOP_PASSED) ? p : NULL, job->userData);
+  delete job;
+}
+
+static void closeJob(void *arg) {
+  MopServerJob *job = (MopServerJob *)arg;
+  MopErrCode ret = job->server->close(job->id);
+  if (job->closeCb) job->closeCb(ret, job->userData);
+  delete job;
+}
+
 MopServer::MopServer() : MopPipelineManagerBase() {
 }
 
@@ -48,8 +75,11 @@ MopErrCode MopServer::accept(PipelineID id, PipelineType type, MopPipeline *&p)
 
   /*! 0.Find whether the pipeline object is existed or not */
   DSTATUS("/*! 0.Find whether the pipeline object is existed or not */");
-  if (pipelineMap.find(id) != pipelineMap.end()) {
-    return MOP_RESOCCUPIED;
+  {
+    std::lock_guard<std::mutex> lock(pipelineMapMutex);
+    if (pipelineMap.find(id) != pipelineMap.end()) {
+      return MOP_RESOCCUPIED;
+    }
   }
 
   /*! 1.Create handler for binding */
@@ -92,24 +122,44 @@ MopErrCode MopServer::accept(PipelineID id, PipelineType type, MopPipeline *&p)
 
   /*! 4.Accept finished */
   DSTATUS("/*! 4.Accept finished */");
-  pipelineMap[id] = p;
+  {
+    std::lock_guard<std::mutex> lock(pipelineMapMutex);
+    pipelineMap[id] = p;
+  }
   DSTATUS("MOP channel [%d] accepted success", id);
   return MOP_PASSED;
 }
 
+void MopServer::accept(PipelineID id, PipelineType type,
+                       void (*cb)(MopErrCode errCode, MopPipeline *p,
+                                  void *userData),
+                       void *userData) {
+  MopServerJob *job = new MopServerJob{this, id, type, cb, NULL, userData};
+  MopErrCode ret = MopEventLoop::instance().post(acceptJob, job);
+  if (ret != MOP_PASSED) {
+    delete job;
+    if (cb) cb(ret, NULL, userData);
+  }
+}
+
 MopErrCode MopServer::close(PipelineID id) {
   int32_t ret;
-  if (pipelineMap.find(id) == pipelineMap.end()) {
-    return MOP_PARM;
+  MopPipeline *pipeline;
+  {
+    std::lock_guard<std::mutex> lock(pipelineMapMutex);
+    if (pipelineMap.find(id) == pipelineMap.end()) {
+      return MOP_PARM;
+    }
+    pipeline = pipelineMap[id];
   }
-
-  MopPipeline *pipeline = pipelineMap[id];
   if (!pipeline)
     return MOP_UNKNOWN_ERR;
 
   /*! Check the entry env */
   checkEntry();
 
+  /*! No worker may be in a read or write of the channel once it is gone */
+  pipeline->cancelAsync();
   mop_channel_handle_t handler = pipeline->channelHandle;
 
   DSTATUS("Trying to close pipeline channel_id : %d", id);
@@ -117,8 +167,21 @@ MopErrCode MopServer::close(PipelineID id) {
   DSTATUS("Result of close pipeline channel_id:%d : %d", id, ret);
   ret = mop_destroy_channel(handler);
   DSTATUS("Result of destroy pipeline channel_id:%d : %d", id, ret);
+  {
+    std::lock_guard<std::mutex> lock(pipelineMapMutex);
+    pipelineMap.erase(id);
+  }
   delete pipeline;
-
-  pipelineMap.erase(id);
   return getMopErrCode(ret);
+}
+
+void MopServer::close(PipelineID id,
+                      void (*cb)(MopErrCode errCode, void *userData),
+                      void *userData) {
+  MopServerJob *job = new MopServerJob{this, id, RELIABLE, NULL, cb, userData};
+  MopErrCode ret = MopEventLoop::instance().post(closeJob, job);
+  if (ret != MOP_PASSED) {
+    delete job;
+    if (cb) cb(ret, userData);
+  }
 }
\ No newline at end of file
@@ -33,6 +33,7 @@
 #include "dji_legacy_linker.hpp"
 #include "dji_camera_module.hpp"
 #include "dji_internal_command.hpp"
+#include "dji_async_context_pool.hpp"
 
 using namespace DJI;
 using namespace DJI::OSDK;
@@ -118,7 +119,7 @@ void retAckCB(const T_CmdInfo *cmdInfo,
     cb(ret, handler->udata);
   }
 
-  if (handler)free(handler);
+  if (handler)AsyncContextPool::instance().release(handler);
 }
 
 
@@ -144,6 +145,7 @@ void paramAckCB(const T_CmdInfo *cmdInfo,
 
     if (!cmdInfo) {
       DERROR("Cannot get the link info, system error.");
+      AsyncContextPool::instance().release(handler);
       return;
     }
 
@@ -257,8 +259,9 @@ void paramAckCB(const T_CmdInfo *cmdInfo,
              cmdInfo->cmdId);
     }
 //clang-format on
-    if (handler)free(handler);
   }
+
+  if (handler)AsyncContextPool::instance().release(handler);
 }
 
 template<typename DataT>
@@ -284,7 +287,7 @@ void CameraModule::getInterfaceAsync(
                                             getIndex() * 2);
   cmdInfo.sender = getLinker()->getLocalSenderId();
 
-  auto *handler = (handlerType *) malloc(sizeof(handlerType));
+  auto *handler = AsyncContextPool::instance().alloc<handlerType>();
   handler->cb = (void *) userCB;
   handler->udata = userData;
   uint8_t temp = 0; // @TODO:fix the linker send data len = 0 issue
@@ -350,7 +353,7 @@ void CameraModule::setInterfaceAsync(const uint8_t cmd[2], const uint8_t *pdata,
                                             getIndex() * 2);
   cmdInfo.sender = getLinker()->getLocalSenderId();
 
-  auto *handler = (handlerType *) malloc(sizeof(handlerType));
+  auto *handler = AsyncContextPool::instance().alloc<handlerType>();
   handler->cb = (void *) userCB;
   handler->udata = userData;
 
@@ -430,7 +433,7 @@ void CameraModule::setExposureModeAsync(
                                             getIndex() * 2);
   cmdInfo.sender = getLinker()->getLocalSenderId();
 
-  auto *handler = (handlerType *) malloc(sizeof(handlerType));
+  auto *handler = AsyncContextPool::instance().alloc<handlerType>();
   handler->cb = (void *)UserCallBack;
   handler->udata = userData;
 
@@ -908,7 +911,7 @@ void CameraModule::setTapZoomEnabledAsync(
     bool param,
     void (*UserCallBack)(ErrorCode::ErrorCodeType retCode, UserData userData),
     UserData userData) {
-  auto handler = (TapZoomEnabledHandler *)malloc(sizeof(TapZoomEnabledHandler));
+  auto handler = AsyncContextPool::instance().alloc<TapZoomEnabledHandler>();
   handler->cameraModule = this;
   handler->enable = param;
   handler->UserCallBack = UserCallBack;
@@ -946,7 +949,7 @@ void CameraModule::callbackToSetTapZoomEnabled(ErrorCode::ErrorCodeType retCode,
         V1ProtocolCMD::Camera::setPointZoomMode, (uint8_t *) &req,
         sizeof(req), handler.UserCallBack, handler.userData, 1000 / 3, 3);
   }
-  if (userData) free(userData);
+  if (userData) AsyncContextPool::instance().release(userData);
 }
 
 void CameraModule::getTapZoomDataAckAsync(
@@ -961,7 +964,7 @@ void CameraModule::getTapZoomEnabledAsync(
     void (*UserCallBack)(ErrorCode::ErrorCodeType retCode, bool param,
                          UserData userData),
     UserData userData) {
-  auto *handler = (handlerType *) malloc(sizeof(handlerType));
+  auto *handler = AsyncContextPool::instance().alloc<handlerType>();
   handler->cb = (void *) UserCallBack;
   handler->udata = userData;
   getTapZoomDataAckAsync(getTapZoomEnabledDecoder, handler);
@@ -984,7 +987,7 @@ void CameraModule::setTapZoomMultiplierAsync(
     TapZoomMultiplierData param,
     void (*UserCallBack)(ErrorCode::ErrorCodeType retCode, UserData userData),
     UserData userData) {
-  auto handler = (TapZoomEnabledHandler *)malloc(sizeof(TapZoomEnabledHandler));
+  auto handler = AsyncContextPool::instance().alloc<TapZoomEnabledHandler>();
   handler->cameraModule = this;
   handler->enable = false;
   handler->multiplier = param;
@@ -1022,14 +1025,14 @@ void CameraModule::callbackToSetTapZoomMultiplier(
         V1ProtocolCMD::Camera::setPointZoomMode, (uint8_t *) &req,
         sizeof(req), handler.UserCallBack, handler.userData, 1000 / 3, 3);
   }
-  if (userData) free(userData);
+  if (userData) AsyncContextPool::instance().release(userData);
 }
 
 void CameraModule::getTapZoomMultiplierAsync(
     void (*UserCallBack)(ErrorCode::ErrorCodeType retCode,
                          TapZoomMultiplierData param, UserData userData),
     UserData userData) {
-  auto *handler = (handlerType *) malloc(sizeof(handlerType));
+  auto *handler = AsyncContextPool::instance().alloc<handlerType>();
   handler->cb = (void *) UserCallBack;
   handler->udata = userData;
   getTapZoomDataAckAsync(getTapZoomMultiplierDecoder, handler);
@@ -1055,7 +1058,7 @@ void CameraModule::getShootPhotoModeDataDecoder(ErrorCode::ErrorCodeType retCode
   auto *handler = (handlerType *) userData;
   auto cb = (void (*)(ErrorCode::ErrorCodeType, CameraModule::ShootPhotoMode, UserData)) handler->cb;
   if(cb) cb(retCode, (CameraModule::ShootPhotoMode)captureParam.captureMode, handler->udata);
-  free(userData);
+  AsyncContextPool::instance().release(userData);
 }
 
 void CameraModule::getPhotoAEBCountDecoder(ErrorCode::ErrorCodeType retCode,
@@ -1065,7 +1068,7 @@ void CameraModule::getPhotoAEBCountDecoder(ErrorCode::ErrorCodeType retCode,
   auto *handler = (handlerType *) userData;
   auto cb = (void (*)(ErrorCode::ErrorCodeType, CameraModule::PhotoAEBCount, UserData)) handler->cb;
   if(cb) cb(retCode, (CameraModule::PhotoAEBCount)captureParam.photoNumBurst, handler->udata);
-  free(userData);
+  AsyncContextPool::instance().release(userData);
 }
 
 void CameraModule::getPhotoBurstCountDecoder(ErrorCode::ErrorCodeType retCode,
@@ -1075,7 +1078,7 @@ void CameraModule::getPhotoBurstCountDecoder(ErrorCode::ErrorCodeType retCode,
   auto *handler = (handlerType *) userData;
   auto cb = (void (*)(ErrorCode::ErrorCodeType, CameraModule::PhotoBurstCount, UserData)) handler->cb;
   if(cb) cb(retCode, (CameraModule::PhotoBurstCount)captureParam.photoNumBurst, handler->udata);
-  free(userData);
+  AsyncContextPool::instance().release(userData);
 }
 
 void CameraModule::getPhotoIntervalDatasDecoder(ErrorCode::ErrorCodeType retCode,
@@ -1085,7 +1088,7 @@ void CameraModule::getPhotoIntervalDatasDecoder(ErrorCode::ErrorCodeType retCode
   auto *handler = (handlerType *) userData;
   auto cb = (void (*)(ErrorCode::ErrorCodeType, PhotoIntervalData, UserData)) handler->cb;
   if(cb) cb(retCode, captureParam.intervalSetting, handler->udata);
-  free(userData);
+  AsyncContextPool::instance().release(userData);
 }
 
 void CameraModule::getTapZoomEnabledDecoder(ErrorCode::ErrorCodeType retCode,
@@ -1095,7 +1098,7 @@ void CameraModule::getTapZoomEnabledDecoder(ErrorCode::ErrorCodeType retCode,
   auto *handler = (handlerType *) userData;
   auto cb = (void (*)(ErrorCode::ErrorCodeType, bool, UserData)) handler->cb;
   if(cb) cb(retCode, data.tapZoomEnable, handler->udata);
-  free(userData);
+  AsyncContextPool::instance().release(userData);
 }
 
 void CameraModule::getTapZoomMultiplierDecoder(ErrorCode::ErrorCodeType retCode,
@@ -1105,7 +1108,7 @@ void CameraModule::getTapZoomMultiplierDecoder(ErrorCode::ErrorCodeType retCode,
   auto *handler = (handlerType *) userData;
   auto cb = (void (*)(ErrorCode::ErrorCodeType, TapZoomMultiplierData, UserData)) handler->cb;
   if(cb) cb(retCode, data.multiplier, handler->udata);
-  free(userData);
+  AsyncContextPool::instance().release(userData);
 }
 
 CameraModule::ShutterSpeedType createShutterSpeedStruct(
@@ -1505,6 +1508,7 @@ void CameraModule::callbackToSetShootPhotoMode(ErrorCode::ErrorCodeType retCode,
                                                UserData userData) {
   if (!userData) return;
   shootPhotoParamHandler handler = *(shootPhotoParamHandler*)userData;
+  AsyncContextPool::instance().release(userData);
   if (retCode != ErrorCode::SysCommonErr::Success) {
     captureParam = handler.cameraModule->CreateDefCaptureParamData();
   }
@@ -1542,7 +1546,7 @@ void CameraModule::setShootPhotoModeAsync(
                       sizeof(req), UserCallBack, userData, 1000 / 3, 3);
   } else {
     auto handler =
-      (shootPhotoParamHandler*)malloc(sizeof(shootPhotoParamHandler));
+      AsyncContextPool::instance().alloc<shootPhotoParamHandler>();
     handler->cameraModule          = this;
     handler->paramData.captureMode = takePhotoMode;
     handler->UserCallBack          = UserCallBack;
@@ -1606,7 +1610,7 @@ void CameraModule::getShootPhotoModeAsync(
     void (*UserCallBack)(ErrorCode::ErrorCodeType retCode,
                          ShootPhotoMode takePhotoMode, UserData userData),
     UserData userData) {
-  auto *handler = (handlerType *) malloc(sizeof(handlerType));
+  auto *handler = AsyncContextPool::instance().alloc<handlerType>();
   handler->cb = (void *) UserCallBack;
   handler->udata = userData;
   getCaptureParamDataAsync(getShootPhotoModeDataDecoder, handler);
@@ -1627,6 +1631,7 @@ void CameraModule::callbackToSetPhotoBurstCount(
     UserData userData) {
   if (!userData) return;
   shootPhotoParamHandler handler = *(shootPhotoParamHandler*)userData;
+  AsyncContextPool::instance().release(userData);
   if (retCode != ErrorCode::SysCommonErr::Success) {
     captureParam = handler.cameraModule->CreateDefCaptureParamData(BURST);
   }
@@ -1644,7 +1649,7 @@ void CameraModule::setPhotoBurstCountAsync(
     PhotoBurstCount count,
     void (*UserCallBack)(ErrorCode::ErrorCodeType retCode, UserData userData),
     UserData userData) {
-  auto handler = (shootPhotoParamHandler*)malloc(sizeof(shootPhotoParamHandler));
+  auto handler = AsyncContextPool::instance().alloc<shootPhotoParamHandler>();
   handler->cameraModule = this;
   handler->paramData.photoNumBurst = count;
   handler->UserCallBack = UserCallBack;
@@ -1671,7 +1676,7 @@ void CameraModule::getPhotoBurstCountAsync(
     void (*UserCallBack)(ErrorCode::ErrorCodeType retCode,
                          PhotoBurstCount count, UserData userData),
     UserData userData) {
-  auto *handler = (handlerType *) malloc(sizeof(handlerType));
+  auto *handler = AsyncContextPool::instance().alloc<handlerType>();
   handler->cb = (void *) UserCallBack;
   handler->udata = userData;
   getCaptureParamDataAsync(getPhotoBurstCountDecoder, handler);
@@ -1698,7 +1703,7 @@ void CameraModule::getPhotoAEBCountAsync(
     void (*UserCallBack)(ErrorCode::ErrorCodeType retCode, PhotoAEBCount count,
                          UserData userData),
     UserData userData) {
-  auto *handler = (handlerType *) malloc(sizeof(handlerType));
+  auto *handler = AsyncContextPool::instance().alloc<handlerType>();
   handler->cb = (void *) UserCallBack;
   handler->udata = userData;
   getCaptureParamDataAsync(getPhotoAEBCountDecoder, handler);
@@ -1724,6 +1729,7 @@ void CameraModule::callbackToSetPhotoTimeIntervalSettings(
     UserData userData) {
   if (!userData) return;
   shootPhotoParamHandler handler = *(shootPhotoParamHandler*)userData;
+  AsyncContextPool::instance().release(userData);
   if (retCode != ErrorCode::SysCommonErr::Success) {
     captureParam = handler.cameraModule->CreateDefCaptureParamData(INTERVAL);
   }
@@ -1750,7 +1756,7 @@ void CameraModule::setPhotoTimeIntervalSettingsAsync(
       sizeof(req), UserCallBack, userData, 1000 / 3, 3);
   } else {
     auto handler =
-      (shootPhotoParamHandler*)malloc(sizeof(shootPhotoParamHandler));
+      AsyncContextPool::instance().alloc<shootPhotoParamHandler>();
     handler->cameraModule              = this;
     handler->paramData.intervalSetting = intervalSetting;
     handler->UserCallBack              = UserCallBack;
@@ -1793,7 +1799,7 @@ void CameraModule::getPhotoIntervalDatasAsync(
     void (*UserCallBack)(ErrorCode::ErrorCodeType retCode,
                          PhotoIntervalData intervalSetting, UserData userData),
     UserData userData) {
-  auto *handler = (handlerType *) malloc(sizeof(handlerType));
+  auto *handler = AsyncContextPool::instance().alloc<handlerType>();
   handler->cb = (void *) UserCallBack;
   handler->udata = userData;
   getCaptureParamDataAsync(getPhotoIntervalDatasDecoder, handler);
@@ -41,7 +41,7 @@ void PayloadLink::sendAsync(const uint8_t cmd[], void *pdata, size_t len,
                             int retry_time) {
   vehicle->legacyLinker->sendAsync(cmd, (uint8_t *) pdata, len, timeout,
                                    retry_time, (VehicleCallBack) callBack,
-                                   userData);
+                                   userData, true);
 }
 
 ACK::ExtendedFunctionRsp *PayloadLink::sendSync(const uint8_t cmd[],
@@ -28,6 +28,7 @@
 
 #include "dji_psdk_module.hpp"
 #include "dji_legacy_linker.hpp"
+#include "dji_async_context_pool.hpp"
 
 #include <vector>
 using namespace DJI;
@@ -144,22 +145,19 @@ ErrorCode::ErrorCodeType PSDKModule::configureWidgetValueSync(
   return ErrorCode::SysCommonErr::ReqNotSupported;
 }
 
-/*! @TODO Here is only the temporary way to alloc memory for the asynchronous
- * interface to stash the user data. This method will be optimized in the
- * future.
+/*! @note The handler is released by the legacy linker once the request
+ * completes, see PayloadLink::sendAsync.
  */
 PSDKModule::UCBRetCodeHandler *PSDKModule::allocUCBHandler(void *callback,
                                                            UserData userData) {
-  static int ucbHandlerIndex = 0;
-
-  ucbHandlerIndex++;
-  if (ucbHandlerIndex >= maxSize) {
-    ucbHandlerIndex = 0;
+  UCBRetCodeHandler *ucb =
+      AsyncContextPool::instance().alloc<UCBRetCodeHandler>();
+  if (ucb) {
+    ucb->UserCallBack =
+        (void (*)(ErrorCode::ErrorCodeType errCode, UserData userData))callback;
+    ucb->userData = userData;
   }
-  ucbHandler[ucbHandlerIndex].UserCallBack =
-      (void (*)(ErrorCode::ErrorCodeType errCode, UserData userData))callback;
-  ucbHandler[ucbHandlerIndex].userData = userData;
-  return &(ucbHandler[ucbHandlerIndex]);
+  return ucb;
 }
 
 void PSDKModule::PSDKSetWidgetDecoder(Vehicle *vehicle, RecvContainer recvFrame,
@@ -0,0 +1,152 @@
+/** @file dji_async_context_pool.hpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Fixed-capacity pool for the contexts of asynchronous requests
+ *
+ *  @Copyright (c) 2016-2017 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef OSDK_DJI_ASYNC_CONTEXT_POOL_H_
+#define OSDK_DJI_ASYNC_CONTEXT_POOL_H_
+
+#include <stdint.h>
+#include "osdk_platform.h"
+#ifdef __linux__
+#include <atomic>
+#endif
+
+/*! Number of slots in the pool unless AsyncContextPool::setCapacity() is
+ *  called before Vehicle::init() */
+#ifndef DJI_ASYNC_CONTEXT_POOL_SIZE
+#define DJI_ASYNC_CONTEXT_POOL_SIZE 128
+#endif
+
+namespace DJI
+{
+namespace OSDK
+{
+
+/*! @brief Pool of small fixed-size slots holding the callback and user data
+ *  of in-flight asynchronous requests
+ *  @details The slots are allocated once, by Vehicle::init() before any
+ *  request is sent, and recycled through a lock-free free list on Linux, or a
+ *  mutex elsewhere. A request larger
+ *  than a slot, or arriving while all slots are taken, is served by the OSAL
+ *  heap and counted in the stats, so callers never see a failure they would
+ *  not have seen with malloc. Always hand a context back with release(),
+ *  wherever it came from.
+ */
+class AsyncContextPool
+{
+public:
+  static const uint32_t SLOT_SIZE = 64;
+
+  typedef struct PoolStats
+  {
+    uint32_t capacity;  /*!< number of slots */
+    uint32_t inUse;     /*!< slots currently handed out */
+    uint32_t peakInUse; /*!< high-water mark of inUse */
+    uint32_t exhausted; /*!< heap allocations because all slots were taken */
+    uint32_t oversized; /*!< heap allocations because size > SLOT_SIZE */
+  } PoolStats;
+
+  static AsyncContextPool& instance();
+
+  /*! @brief Set the number of slots and set the pool up
+   *  @return false once the pool is set up, i.e. after Vehicle::init()
+   */
+  bool setCapacity(uint32_t slots);
+
+  /*! @brief Set the pool up with the default capacity unless setCapacity()
+   *  did already. Called by Vehicle::init() while no other task uses the
+   *  pool: the setup is not locked on RTOS platforms, where alloc() falls
+   *  back to the heap until it's done.
+   *  @return true once the pool is set up
+   */
+  bool init();
+
+  void* alloc(uint32_t size);
+
+  template <typename T>
+  T* alloc()
+  {
+    return (T*)alloc(sizeof(T));
+  }
+
+  void release(void* ctx);
+
+  PoolStats getStats();
+
+private:
+  typedef struct Slot
+  {
+    uint64_t data[SLOT_SIZE / sizeof(uint64_t)];
+  } Slot;
+
+  AsyncContextPool();
+  ~AsyncContextPool();
+
+  bool  setup(uint32_t slots);
+  Slot* pop();
+  void  push(Slot* slot);
+  void  countExhausted();
+
+  Slot*    slots;
+  uint32_t capacity;
+
+#ifdef __linux__
+  enum
+  {
+    POOL_EMPTY = 0,
+    POOL_SETTING_UP,
+    POOL_READY
+  };
+
+  /* Free list head, slot index + 1 in the low word and an ABA tag in the
+   * high word. next[i] holds the index + 1 of the slot after slot i. */
+  std::atomic<int>       state;
+  std::atomic<uint64_t>  head;
+  std::atomic<uint32_t>* next;
+
+  std::atomic<uint32_t> inUse;
+  std::atomic<uint32_t> peakInUse;
+  std::atomic<uint32_t> exhausted;
+  std::atomic<uint32_t> oversized;
+#else
+  bool              ready;
+  T_OsdkMutexHandle mutex;
+  uint32_t          head;
+  uint32_t*         next;
+
+  uint32_t inUse;
+  uint32_t peakInUse;
+  uint32_t exhausted;
+  uint32_t oversized;
+#endif
+};
+
+} // namespace OSDK
+} // namespace DJI
+
+#endif // OSDK_DJI_ASYNC_CONTEXT_POOL_H_
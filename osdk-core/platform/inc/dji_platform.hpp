@@ -48,6 +48,10 @@
   DJI::OSDK::Platform::instance()                                   \
   .registerOsalHandler(handlerPtr)
 
+#define DJI_REG_OSAL_CLOCK_HANDLER(handlerPtr)                      \
+  DJI::OSDK::Platform::instance()                                   \
+  .registerOsalClockHandler(handlerPtr)
+
 #define DJI_REG_LOGGER_CONSOLE(consolePtr)                          \
   DJI::OSDK::Platform::instance()                                   \
   .registerLoggerConsole(consolePtr)
@@ -112,11 +116,29 @@
   DJI::OSDK::Platform::instance()                                   \
   .getTimeMs(msPtr)
 
-#ifdef OS_DEBUG
 #define DJI_GET_TIME_US(usPtr)                                      \
   DJI::OSDK::Platform::instance()                                   \
   .getTimeUs(usPtr)
-#endif
+
+#define DJI_GET_TIME_NS(nsPtr)                                      \
+  DJI::OSDK::Platform::instance()                                   \
+  .getTimeNs(nsPtr)
+
+/*! @brief Optional monotonic clock of the platform
+ *  @details T_OsdkOsalHandler is consumed by the prebuilt linker library and
+ *  can't grow new members, so the clock is registered on its own. Any member
+ *  may be NULL: times then fall back to the coarser ones down to GetTimeMs,
+ *  and sleeping until a deadline falls back to TaskSleepMs.
+ */
+typedef struct
+{
+  /*! monotonic time since an unspecified start, unit: us */
+  E_OsdkStat (*GetTimeUs)(uint64_t *us);
+  /*! monotonic time since an unspecified start, unit: ns */
+  E_OsdkStat (*GetTimeNs)(uint64_t *ns);
+  /*! sleep until the absolute monotonic time deadlineNs */
+  E_OsdkStat (*TaskSleepUntilNs)(uint64_t deadlineNs);
+} T_OsdkOsalClockHandler;
 
 namespace DJI
 {
@@ -145,6 +167,8 @@ public:
 
   bool registerLoggerConsole(T_OsdkLoggerConsole *console);
 
+  bool registerOsalClockHandler(const T_OsdkOsalClockHandler *clockHandler);
+
   bool taskCreate(T_OsdkTaskHandle *task, void *(*taskFunc)(void *), uint32_t stackSize, void *arg);
 
   bool taskDestroy(T_OsdkTaskHandle task);
@@ -171,9 +195,11 @@ public:
 
   bool getTimeMs(uint32_t *ms);
 
-#ifdef OS_DEBUG
   bool getTimeUs(uint64_t *us);
-#endif
+
+  bool getTimeNs(uint64_t *ns);
+
+  bool taskSleepUntilNs(uint64_t deadlineNs);
 
   void* malloc(uint32_t size);
 
@@ -183,7 +209,59 @@ private:
   bool osalRegFlag;
   bool halUartRegFlag;
   bool loggerConsoleRegFlag;
+  T_OsdkOsalClockHandler clockHandler;
+  /*! extends GetTimeMs to 64 bits when no clock handler gives the time */
+  T_OsdkMutexHandle msClockMutex;
+  uint32_t msClockLast;
+  uint32_t msClockWraps;
+
+};
+
+/*! @brief Drift-free periodic wake up on the platform's monotonic clock
+ *  @details Each deadline is the previous one plus the period, not the wake
+ *  up time plus the period, so the loop rate doesn't drift with the work done
+ *  in the loop. Periods lost to an overrun are skipped and counted instead of
+ *  being caught up in a burst. Stats are meant to be read by the loop's own
+ *  thread.
+ */
+class PeriodicTimer
+{
+public:
+  typedef struct JitterStats
+  {
+    uint32_t wakeUps;       /*!< number of wait() calls */
+    uint32_t missedPeriods; /*!< periods skipped because of overruns */
+    uint32_t minLateUs;     /*!< smallest wake up delay after a deadline */
+    uint32_t maxLateUs;     /*!< largest wake up delay after a deadline */
+    uint64_t sumLateUs;     /*!< mean delay is sumLateUs / wakeUps */
+  } JitterStats;
+
+  PeriodicTimer(uint32_t periodUs);
+
+  /*! @brief Restart the period from now, the first wait() returns one period
+   *  later. wait() starts the timer itself if it's not started.
+   */
+  void start();
+
+  /*! @brief Sleep until the next deadline
+   *  @return false if the platform clock is not available, after sleeping
+   *  one period so that loops calling it don't spin
+   */
+  bool wait();
+
+  uint32_t getPeriodUs() const;
+
+  JitterStats getStats() const;
+
+  void resetStats();
+
+private:
+  uint64_t    periodNs;
+  uint64_t    nextNs;
+  bool        started;
+  JitterStats stats;
 
+  void sleepPeriod();
 };
 }
 }
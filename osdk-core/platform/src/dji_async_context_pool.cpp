@@ -0,0 +1,409 @@
+/** @file dji_async_context_pool.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Fixed-capacity pool for the contexts of asynchronous requests
+ *
+ *  @Copyright (c) 2016-2017 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "dji_async_context_pool.hpp"
+#include "dji_log.hpp"
+#include <new>
+
+using namespace DJI;
+using namespace DJI::OSDK;
+
+AsyncContextPool&
+AsyncContextPool::instance()
+{
+  static AsyncContextPool pool;
+  return pool;
+}
+
+#ifdef __linux__
+
+AsyncContextPool::AsyncContextPool()
+  : slots(NULL)
+  , capacity(DJI_ASYNC_CONTEXT_POOL_SIZE)
+  , state(POOL_EMPTY)
+  , head(0)
+  , next(NULL)
+  , inUse(0)
+  , peakInUse(0)
+  , exhausted(0)
+  , oversized(0)
+{
+}
+
+AsyncContextPool::~AsyncContextPool()
+{
+  /* Slots may still be referenced by requests that never completed, keep
+   * them alive until the process exits. */
+}
+
+bool
+AsyncContextPool::setCapacity(uint32_t slotCount)
+{
+  return setup(slotCount);
+}
+
+bool
+AsyncContextPool::init()
+{
+  setup(capacity);
+  return state.load(std::memory_order_acquire) == POOL_READY;
+}
+
+bool
+AsyncContextPool::setup(uint32_t slotCount)
+{
+  int expected = POOL_EMPTY;
+  if (!state.compare_exchange_strong(expected, POOL_SETTING_UP,
+                                     std::memory_order_acquire))
+  {
+    return false;
+  }
+
+  Slot*                  newSlots = new (std::nothrow) Slot[slotCount];
+  std::atomic<uint32_t>* newNext =
+    new (std::nothrow) std::atomic<uint32_t>[slotCount];
+  if (!slotCount || !newSlots || !newNext)
+  {
+    DERROR("Failed to set up the async context pool with %u slots.",
+           slotCount);
+    delete[] newSlots;
+    delete[] newNext;
+    newSlots  = NULL;
+    newNext   = NULL;
+    slotCount = 0;
+  }
+
+  for (uint32_t i = 0; i < slotCount; i++)
+  {
+    newNext[i].store(i + 2 <= slotCount ? i + 2 : 0,
+                     std::memory_order_relaxed);
+  }
+
+  slots    = newSlots;
+  next     = newNext;
+  capacity = slotCount;
+  head.store(slotCount ? 1 : 0, std::memory_order_relaxed);
+  state.store(POOL_READY, std::memory_order_release);
+  return true;
+}
+
+AsyncContextPool::Slot*
+AsyncContextPool::pop()
+{
+  uint64_t oldHead = head.load(std::memory_order_acquire);
+  while (true)
+  {
+    uint32_t index = (uint32_t)oldHead;
+    if (!index)
+    {
+      return NULL;
+    }
+
+    uint64_t newHead = (((oldHead >> 32) + 1) << 32) |
+                       next[index - 1].load(std::memory_order_relaxed);
+    if (head.compare_exchange_weak(oldHead, newHead,
+                                   std::memory_order_acquire,
+                                   std::memory_order_acquire))
+    {
+      return &slots[index - 1];
+    }
+  }
+}
+
+void
+AsyncContextPool::push(Slot* slot)
+{
+  uint32_t index   = (uint32_t)(slot - slots);
+  uint64_t oldHead = head.load(std::memory_order_relaxed);
+  uint64_t newHead;
+  do
+  {
+    next[index].store((uint32_t)oldHead, std::memory_order_relaxed);
+    newHead = (((oldHead >> 32) + 1) << 32) | (index + 1);
+  } while (!head.compare_exchange_weak(oldHead, newHead,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed));
+}
+
+void*
+AsyncContextPool::alloc(uint32_t size)
+{
+  if (size > SLOT_SIZE)
+  {
+    oversized.fetch_add(1, std::memory_order_relaxed);
+    return OsdkOsal_Malloc(size);
+  }
+
+  if (state.load(std::memory_order_acquire) != POOL_READY)
+  {
+    setup(capacity);
+    if (state.load(std::memory_order_acquire) != POOL_READY)
+    {
+      /* Another thread is setting the pool up right now */
+      return OsdkOsal_Malloc(size);
+    }
+  }
+
+  Slot* slot = pop();
+  if (!slot)
+  {
+    countExhausted();
+    return OsdkOsal_Malloc(size);
+  }
+
+  uint32_t used = inUse.fetch_add(1, std::memory_order_relaxed) + 1;
+  uint32_t peak = peakInUse.load(std::memory_order_relaxed);
+  while (used > peak &&
+         !peakInUse.compare_exchange_weak(peak, used,
+                                          std::memory_order_relaxed))
+  {
+  }
+
+  return slot;
+}
+
+void
+AsyncContextPool::release(void* ctx)
+{
+  if (!ctx)
+  {
+    return;
+  }
+
+  Slot* slot = (Slot*)ctx;
+  if (slots && slot >= slots && slot < slots + capacity)
+  {
+    inUse.fetch_sub(1, std::memory_order_relaxed);
+    push(slot);
+  }
+  else
+  {
+    OsdkOsal_Free(ctx);
+  }
+}
+
+void
+AsyncContextPool::countExhausted()
+{
+  uint32_t count = exhausted.fetch_add(1, std::memory_order_relaxed) + 1;
+  /* Warn on the 1st, 2nd, 4th, 8th... time only */
+  if (!(count & (count - 1)))
+  {
+    DERROR("Async context pool exhausted (%u slots) %u time(s), falling back "
+           "to the heap. Consider raising its capacity.",
+           capacity, count);
+  }
+}
+
+AsyncContextPool::PoolStats
+AsyncContextPool::getStats()
+{
+  PoolStats stats;
+  stats.capacity  = capacity;
+  stats.inUse     = inUse.load(std::memory_order_relaxed);
+  stats.peakInUse = peakInUse.load(std::memory_order_relaxed);
+  stats.exhausted = exhausted.load(std::memory_order_relaxed);
+  stats.oversized = oversized.load(std::memory_order_relaxed);
+  return stats;
+}
+
+#else
+
+AsyncContextPool::AsyncContextPool()
+  : slots(NULL)
+  , capacity(DJI_ASYNC_CONTEXT_POOL_SIZE)
+  , ready(false)
+  , mutex(NULL)
+  , head(0)
+  , next(NULL)
+  , inUse(0)
+  , peakInUse(0)
+  , exhausted(0)
+  , oversized(0)
+{
+}
+
+AsyncContextPool::~AsyncContextPool()
+{
+}
+
+bool
+AsyncContextPool::setCapacity(uint32_t slotCount)
+{
+  return setup(slotCount);
+}
+
+bool
+AsyncContextPool::init()
+{
+  setup(capacity);
+  return ready;
+}
+
+bool
+AsyncContextPool::setup(uint32_t slotCount)
+{
+  if (ready)
+  {
+    return false;
+  }
+
+  if (OsdkOsal_MutexCreate(&mutex) != OSDK_STAT_OK)
+  {
+    DERROR("Failed to create the async context pool mutex.");
+    return false;
+  }
+
+  slots = (Slot*)OsdkOsal_Malloc(slotCount * sizeof(Slot));
+  next  = (uint32_t*)OsdkOsal_Malloc(slotCount * sizeof(uint32_t));
+  if (!slotCount || !slots || !next)
+  {
+    DERROR("Failed to set up the async context pool with %u slots.",
+           slotCount);
+    OsdkOsal_Free(slots);
+    OsdkOsal_Free(next);
+    slots     = NULL;
+    next      = NULL;
+    slotCount = 0;
+  }
+
+  for (uint32_t i = 0; i < slotCount; i++)
+  {
+    next[i] = i + 2 <= slotCount ? i + 2 : 0;
+  }
+
+  capacity = slotCount;
+  head     = slotCount ? 1 : 0;
+  ready    = true;
+  return true;
+}
+
+AsyncContextPool::Slot*
+AsyncContextPool::pop()
+{
+  Slot* slot = NULL;
+
+  OsdkOsal_MutexLock(mutex);
+  if (head)
+  {
+    slot = &slots[head - 1];
+    head = next[head - 1];
+    if (++inUse > peakInUse)
+    {
+      peakInUse = inUse;
+    }
+  }
+  OsdkOsal_MutexUnlock(mutex);
+
+  return slot;
+}
+
+void
+AsyncContextPool::push(Slot* slot)
+{
+  uint32_t index = (uint32_t)(slot - slots);
+
+  OsdkOsal_MutexLock(mutex);
+  next[index] = head;
+  head        = index + 1;
+  inUse--;
+  OsdkOsal_MutexUnlock(mutex);
+}
+
+void*
+AsyncContextPool::alloc(uint32_t size)
+{
+  if (size > SLOT_SIZE)
+  {
+    oversized++;
+    return OsdkOsal_Malloc(size);
+  }
+
+  /* No setup here, two tasks could run it at once. It's done by
+   * Vehicle::init() before any request. */
+  if (!ready)
+  {
+    return OsdkOsal_Malloc(size);
+  }
+
+  Slot* slot = pop();
+  if (!slot)
+  {
+    countExhausted();
+    return OsdkOsal_Malloc(size);
+  }
+
+  return slot;
+}
+
+void
+AsyncContextPool::release(void* ctx)
+{
+  if (!ctx)
+  {
+    return;
+  }
+
+  Slot* slot = (Slot*)ctx;
+  if (slots && slot >= slots && slot < slots + capacity)
+  {
+    push(slot);
+  }
+  else
+  {
+    OsdkOsal_Free(ctx);
+  }
+}
+
+void
+AsyncContextPool::countExhausted()
+{
+  uint32_t count = ++exhausted;
+  /* Warn on the 1st, 2nd, 4th, 8th... time only */
+  if (!(count & (count - 1)))
+  {
+    DERROR("Async context pool exhausted (%u slots) %u time(s), falling back "
+           "to the heap. Consider raising its capacity.",
+           capacity, count);
+  }
+}
+
+AsyncContextPool::PoolStats
+AsyncContextPool::getStats()
+{
+  PoolStats stats;
+  stats.capacity  = capacity;
+  stats.inUse     = inUse;
+  stats.peakInUse = peakInUse;
+  stats.exhausted = exhausted;
+  stats.oversized = oversized;
+  return stats;
+}
+
+#endif
@@ -29,6 +29,7 @@
 
 #include "dji_platform.hpp"
 #include <new>
+#include <string.h>
 
 using namespace DJI;
 using namespace DJI::OSDK;
@@ -38,6 +39,10 @@ Platform::Platform()
   osalRegFlag = false;
   halUartRegFlag = false;
   loggerConsoleRegFlag = false;
+  memset(&clockHandler, 0, sizeof(clockHandler));
+  msClockMutex = NULL;
+  msClockLast  = 0;
+  msClockWraps = 0;
 }
 
 Platform::~Platform()
@@ -80,6 +85,9 @@ Platform::registerOsalHandler(const T_OsdkOsalHandler *osalHandler)
 
   if (errCode == OSDK_STAT_OK) {
     osalRegFlag = true;
+    if (!msClockMutex) {
+      OsdkOsal_MutexCreate(&msClockMutex);
+    }
     return true;
   }else {
     osalRegFlag = false;
@@ -102,6 +110,16 @@ Platform::registerLoggerConsole(T_OsdkLoggerConsole *console)
   }
 }
 
+bool
+Platform::registerOsalClockHandler(const T_OsdkOsalClockHandler *clockHandler)
+{
+  if (!clockHandler) {
+    return false;
+  }
+  this->clockHandler = *clockHandler;
+  return true;
+}
+
 bool
 Platform::isOsalReady()
 {
@@ -266,16 +284,78 @@ Platform::getTimeMs(uint32_t *ms)
   return (errCode == OSDK_STAT_OK)? true : false;
 }
 
-#ifdef OS_DEBUG
 bool
 Platform::getTimeUs(uint64_t *us)
 {
   E_OsdkStat errCode;
-  errCode = OsdkOsal_GetTimeUs(us);
+
+  if (clockHandler.GetTimeUs) {
+    errCode = clockHandler.GetTimeUs(us);
+  } else if (clockHandler.GetTimeNs) {
+    uint64_t ns = 0;
+    errCode = clockHandler.GetTimeNs(&ns);
+    *us = ns / 1000;
+  } else {
+    /*! GetTimeMs wraps after about 49.7 days, count the wraps to keep the
+     *  time monotonic. It must be read at least once per wrap period, which
+     *  any PeriodicTimer in use does. */
+    uint32_t ms = 0;
+    if (msClockMutex) {
+      OsdkOsal_MutexLock(msClockMutex);
+    }
+    errCode = OsdkOsal_GetTimeMs(&ms);
+    if (errCode == OSDK_STAT_OK) {
+      if (ms < msClockLast) {
+        msClockWraps++;
+      }
+      msClockLast = ms;
+    }
+    *us = (((uint64_t)msClockWraps << 32) + ms) * 1000;
+    if (msClockMutex) {
+      OsdkOsal_MutexUnlock(msClockMutex);
+    }
+  }
+
+  return (errCode == OSDK_STAT_OK)? true : false;
+}
+
+bool
+Platform::getTimeNs(uint64_t *ns)
+{
+  E_OsdkStat errCode;
+
+  if (clockHandler.GetTimeNs) {
+    errCode = clockHandler.GetTimeNs(ns);
+  } else {
+    uint64_t us = 0;
+    errCode = getTimeUs(&us) ? OSDK_STAT_OK : OSDK_STAT_ERR;
+    *ns = us * 1000;
+  }
+
+  return (errCode == OSDK_STAT_OK)? true : false;
+}
+
+bool
+Platform::taskSleepUntilNs(uint64_t deadlineNs)
+{
+  E_OsdkStat errCode;
+
+  if (clockHandler.TaskSleepUntilNs) {
+    errCode = clockHandler.TaskSleepUntilNs(deadlineNs);
+  } else {
+    uint64_t nowNs = 0;
+    if (!getTimeNs(&nowNs)) {
+      return false;
+    }
+    if (nowNs >= deadlineNs) {
+      return true;
+    }
+    errCode = OsdkOsal_TaskSleepMs(
+        (uint32_t)((deadlineNs - nowNs + 999999) / 1000000));
+  }
 
   return (errCode == OSDK_STAT_OK)? true : false;
 }
-#endif
 
 void*
 Platform::malloc(uint32_t size)
@@ -289,3 +369,77 @@ Platform::free(void *ptr)
   return OsdkOsal_Free(ptr);
 }
 
+PeriodicTimer::PeriodicTimer(uint32_t periodUs)
+  : periodNs((uint64_t)(periodUs ? periodUs : 1) * 1000)
+  , nextNs(0)
+  , started(false)
+{
+  resetStats();
+}
+
+void
+PeriodicTimer::start()
+{
+  uint64_t nowNs = 0;
+  started = Platform::instance().getTimeNs(&nowNs);
+  nextNs  = nowNs + periodNs;
+}
+
+bool
+PeriodicTimer::wait()
+{
+  if (!started) {
+    start();
+    if (!started) {
+      sleepPeriod();
+      return false;
+    }
+  }
+
+  uint64_t nowNs = 0;
+  Platform::instance().taskSleepUntilNs(nextNs);
+  if (!Platform::instance().getTimeNs(&nowNs)) {
+    sleepPeriod();
+    return false;
+  }
+
+  uint32_t lateUs = (nowNs > nextNs) ? (uint32_t)((nowNs - nextNs) / 1000) : 0;
+  stats.wakeUps++;
+  stats.sumLateUs += lateUs;
+  if (lateUs < stats.minLateUs) stats.minLateUs = lateUs;
+  if (lateUs > stats.maxLateUs) stats.maxLateUs = lateUs;
+
+  nextNs += periodNs;
+  if (nowNs >= nextNs) {
+    uint64_t missed = (nowNs - nextNs) / periodNs + 1;
+    stats.missedPeriods += (uint32_t)missed;
+    nextNs += missed * periodNs;
+  }
+  return true;
+}
+
+void
+PeriodicTimer::sleepPeriod()
+{
+  uint32_t periodMs = (uint32_t)((periodNs + 999999) / 1000000);
+  Platform::instance().taskSleepMs(periodMs);
+}
+
+uint32_t
+PeriodicTimer::getPeriodUs() const
+{
+  return (uint32_t)(periodNs / 1000);
+}
+
+PeriodicTimer::JitterStats
+PeriodicTimer::getStats() const
+{
+  return stats;
+}
+
+void
+PeriodicTimer::resetStats()
+{
+  memset(&stats, 0, sizeof(stats));
+  stats.minLateUs = 0xFFFFFFFF;
+}
@@ -0,0 +1,96 @@
+/** @file benchmark_common.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Helpers shared by the benchmarks of osdk-core internals
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "benchmark_common.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "dji_platform.hpp"
+#include "osdkosal_linux.h"
+
+static E_OsdkStat BenchmarkConsole(const uint8_t *data, uint16_t dataLen) {
+  fwrite(data, 1, dataLen, stderr);
+  return OSDK_STAT_OK;
+}
+
+bool setupBenchmarkEnvironment() {
+  static T_OsdkLoggerConsole printConsole = {
+      .consoleLevel = OSDK_LOGGER_CONSOLE_LOG_LEVEL_ERROR,
+      .func = BenchmarkConsole,
+  };
+
+  static T_OsdkOsalHandler osalHandler = {
+      .TaskCreate = OsdkLinux_TaskCreate,
+      .TaskDestroy = OsdkLinux_TaskDestroy,
+      .TaskSleepMs = OsdkLinux_TaskSleepMs,
+      .MutexCreate = OsdkLinux_MutexCreate,
+      .MutexDestroy = OsdkLinux_MutexDestroy,
+      .MutexLock = OsdkLinux_MutexLock,
+      .MutexUnlock = OsdkLinux_MutexUnlock,
+      .SemaphoreCreate = OsdkLinux_SemaphoreCreate,
+      .SemaphoreDestroy = OsdkLinux_SemaphoreDestroy,
+      .SemaphoreWait = OsdkLinux_SemaphoreWait,
+      .SemaphoreTimedWait = OsdkLinux_SemaphoreTimedWait,
+      .SemaphorePost = OsdkLinux_SemaphorePost,
+      .GetTimeMs = OsdkLinux_GetTimeMs,
+#ifdef OS_DEBUG
+      .GetTimeUs = OsdkLinux_GetTimeUs,
+#endif
+      .Malloc = OsdkLinux_Malloc,
+      .Free = OsdkLinux_Free,
+  };
+
+  if (DJI_REG_LOGGER_CONSOLE(&printConsole) != true) {
+    printf("logger console register fail\n");
+    return false;
+  }
+  if (DJI_REG_OSAL_HANDLER(&osalHandler) != true) {
+    printf("Osal handler register fail\n");
+    return false;
+  }
+  return true;
+}
+
+uint64_t benchmarkNowUs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+uint64_t benchmarkDirtyKB() {
+  FILE *fp = fopen("/proc/meminfo", "r");
+  if (!fp) return 0;
+  char line[128];
+  unsigned long long kb = 0;
+  while (fgets(line, sizeof(line), fp)) {
+    if (sscanf(line, "Dirty: %llu kB", &kb) == 1) break;
+  }
+  fclose(fp);
+  return kb;
+}
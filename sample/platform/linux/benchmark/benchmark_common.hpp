@@ -0,0 +1,45 @@
+/** @file benchmark_common.hpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Helpers shared by the benchmarks of osdk-core internals
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef DJI_BENCHMARK_COMMON_HPP
+#define DJI_BENCHMARK_COMMON_HPP
+
+#include <stdint.h>
+
+/*! Register the Linux OSAL and a console printing errors only. The
+ *  benchmarks run without a vehicle, so this is all the setup they need. */
+bool setupBenchmarkEnvironment();
+
+/*! Monotonic clock in microseconds */
+uint64_t benchmarkNowUs();
+
+/*! Dirty page cache in kB, from /proc/meminfo */
+uint64_t benchmarkDirtyKB();
+
+#endif  // DJI_BENCHMARK_COMMON_HPP
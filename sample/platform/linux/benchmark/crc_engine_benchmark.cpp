@@ -0,0 +1,91 @@
+/** @file crc_engine_benchmark.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Throughput of the CRCEngine kernels at OpenProtocol frame sizes
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "benchmark_common.hpp"
+#include "dji_crc_engine.hpp"
+
+using namespace DJI::OSDK;
+
+/*! Usage: crc_engine_benchmark [MB per case]
+ *
+ *  Runs CRC16 and CRC32 of every kernel this build and CPU have over frames
+ *  of the sizes OpenProtocol sends, from a header to the largest frame, and
+ *  over large blocks. Reported in MB/s. */
+
+static const CRCEngine::Kernel kernels[] = {
+    CRCEngine::KERNEL_REFERENCE, CRCEngine::KERNEL_SLICING_BY_8,
+    CRCEngine::KERNEL_ARMV8_CRC32,
+};
+
+static const size_t frameSizes[] = {10, 64, 256, 1024, 65536};
+
+int main(int argc, char **argv) {
+  uint64_t bytesPerCase = ((argc > 1) ? strtoull(argv[1], NULL, 0) : 256) << 20;
+  size_t maxSize = frameSizes[sizeof(frameSizes) / sizeof(frameSizes[0]) - 1];
+  std::vector<uint8_t> buf(maxSize);
+  for (size_t i = 0; i < buf.size(); i++) buf[i] = rand();
+
+  printf("%-14s %-6s", "kernel", "crc");
+  for (size_t size : frameSizes) printf(" %8zuB", size);
+  printf("   (MB/s)\n");
+
+  for (CRCEngine::Kernel kernel : kernels) {
+    for (int width = 16; width <= 32; width += 16) {
+      uint16_t crc16 = 0x3AA3;
+      uint32_t crc32 = 0x11223344;
+      bool available = (width == 16)
+          ? CRCEngine::crc16WithKernel(kernel, crc16, buf.data(), 1)
+          : CRCEngine::crc32WithKernel(kernel, crc32, buf.data(), 1);
+      if (!available) continue;
+
+      printf("%-14s crc%-3d", CRCEngine::getKernelName(kernel), width);
+      for (size_t size : frameSizes) {
+        uint64_t frames = bytesPerCase / size;
+        uint64_t startUs = benchmarkNowUs();
+        for (uint64_t i = 0; i < frames; i++) {
+          /*! Chained so the calls cannot be dropped or overlapped */
+          if (width == 16)
+            CRCEngine::crc16WithKernel(kernel, crc16, buf.data(), size);
+          else
+            CRCEngine::crc32WithKernel(kernel, crc32, buf.data(), size);
+        }
+        uint64_t us = benchmarkNowUs() - startUs;
+        printf(" %9.0f", us ? (double)(frames * size) / us : 0.0);
+      }
+      printf("   (0x%x)\n", (width == 16) ? crc16 : crc32);
+    }
+  }
+  printf("selected: crc16 %s, crc32 %s\n",
+         CRCEngine::getKernelName(CRCEngine::getCRC16Kernel()),
+         CRCEngine::getKernelName(CRCEngine::getCRC32Kernel()));
+  return 0;
+}
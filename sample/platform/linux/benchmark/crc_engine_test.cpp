@@ -0,0 +1,109 @@
+/** @file crc_engine_test.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Check every CRCEngine kernel against the byte-wise reference
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "dji_crc_engine.hpp"
+
+using namespace DJI::OSDK;
+
+/*! Every kernel this build and CPU have, and the selected one through
+ *  CRCEngine::crc16/crc32, must give the reference CRC for random data,
+ *  lengths, alignments and initial values. Returns 0 if they all do. */
+
+static const CRCEngine::Kernel kernels[] = {
+    CRCEngine::KERNEL_REFERENCE, CRCEngine::KERNEL_SLICING_BY_8,
+    CRCEngine::KERNEL_ARMV8_CRC32,
+};
+
+#define CRC_TEST_ROUNDS 20000
+#define CRC_TEST_MAX_LEN 4096
+#define CRC_TEST_MAX_ALIGN 16
+
+int main(int argc, char **argv) {
+  unsigned int seed = (argc > 1) ? strtoul(argv[1], NULL, 0) : 1;
+  std::vector<uint8_t> buf(CRC_TEST_MAX_LEN + CRC_TEST_MAX_ALIGN);
+  uint32_t checks[sizeof(kernels) / sizeof(kernels[0])][2] = {{0}};
+  uint32_t failures = 0;
+
+  srand(seed);
+  for (int round = 0; round < CRC_TEST_ROUNDS; round++) {
+    /*! Short lengths, where the kernels fall back to bytes, come often */
+    size_t len = (round & 1) ? rand() % 32 : rand() % (CRC_TEST_MAX_LEN + 1);
+    size_t align = rand() % CRC_TEST_MAX_ALIGN;
+    const uint8_t *data = buf.data() + align;
+    for (size_t i = 0; i < len; i++) buf[align + i] = rand();
+    uint16_t init16 = rand();
+    uint32_t init32 = ((uint32_t)rand() << 16) ^ rand();
+
+    uint16_t ref16 = CRCEngine::crc16Reference(init16, data, len);
+    uint32_t ref32 = CRCEngine::crc32Reference(init32, data, len);
+    if ((CRCEngine::crc16(init16, data, len) != ref16) ||
+        (CRCEngine::crc32(init32, data, len) != ref32)) {
+      printf("selected kernels: mismatch at len %zu align %zu\n", len, align);
+      failures++;
+    }
+
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+      uint16_t crc16 = init16;
+      uint32_t crc32 = init32;
+      if (CRCEngine::crc16WithKernel(kernels[k], crc16, data, len)) {
+        checks[k][0]++;
+        if (crc16 != ref16) {
+          printf("%s crc16: 0x%04x instead of 0x%04x at len %zu align %zu\n",
+                 CRCEngine::getKernelName(kernels[k]), crc16, ref16, len,
+                 align);
+          failures++;
+        }
+      }
+      if (CRCEngine::crc32WithKernel(kernels[k], crc32, data, len)) {
+        checks[k][1]++;
+        if (crc32 != ref32) {
+          printf("%s crc32: 0x%08x instead of 0x%08x at len %zu align %zu\n",
+                 CRCEngine::getKernelName(kernels[k]), crc32, ref32, len,
+                 align);
+          failures++;
+        }
+      }
+    }
+  }
+
+  for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+    printf("%-14s crc16 %s, crc32 %s\n", CRCEngine::getKernelName(kernels[k]),
+           checks[k][0] ? "checked" : "not available",
+           checks[k][1] ? "checked" : "not available");
+  }
+  printf("selected: crc16 %s, crc32 %s\n",
+         CRCEngine::getKernelName(CRCEngine::getCRC16Kernel()),
+         CRCEngine::getKernelName(CRCEngine::getCRC32Kernel()));
+  printf("%s, %u mismatches in %d rounds (seed %u)\n",
+         failures ? "FAILED" : "PASSED", failures, CRC_TEST_ROUNDS, seed);
+  return failures ? 1 : 0;
+}
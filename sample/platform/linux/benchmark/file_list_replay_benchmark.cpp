@@ -0,0 +1,111 @@
+/** @file file_list_replay_benchmark.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Replay of a 5000-file list through the download buffer queue
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "benchmark_common.hpp"
+#include "downloadbufferqueue.h"
+
+using namespace DJI::OSDK;
+
+/*! Usage: file_list_replay_benchmark [files] [rounds] [reorder depth]
+ *
+ *  Builds the packs of a file list of 56-byte descriptors, 990 list bytes
+ *  per pack behind a 10-byte header, and feeds them to DownloadBufferQueue
+ *  as fileListRawDataCB does: each pack is inserted, then every pack now
+ *  in order is taken out and its list bytes gathered. Packs come in
+ *  shuffled groups of reorder depth. Run once with the queue the file list
+ *  uses and once with the 5000 slots it had before, reported per list with
+ *  the memory of the queue. */
+
+#define LIST_DESCRIPTOR_SIZE 56
+#define LIST_HEADER_SIZE 8
+#define PACK_HEADER_SIZE 10
+#define PACK_DATA_SIZE 990
+
+static double replay(int slots, const std::vector<std::vector<uint8_t> > &packs,
+                     const std::vector<int> &order, int rounds, size_t &gathered) {
+  DownloadBufferQueue queue;
+  std::vector<uint8_t> list(packs.size() * PACK_DATA_SIZE);
+  uint64_t startUs = benchmarkNowUs();
+  for (int round = 0; round < rounds; round++) {
+    queue.Clear();
+    queue.InitBufferQueue(slots, 0);
+    size_t len = 0;
+    for (int seq : order) {
+      queue.InsertBlock(packs[seq].data(), packs[seq].size(), seq, true);
+      for (DataPointer pack; (pack = queue.FrontBuffer()).data;
+           queue.PopBuffer()) {
+        memcpy(list.data() + len, (uint8_t *)pack.data + PACK_HEADER_SIZE,
+               pack.length - PACK_HEADER_SIZE);
+        len += pack.length - PACK_HEADER_SIZE;
+      }
+    }
+    gathered = len;
+  }
+  return (double)(benchmarkNowUs() - startUs) / rounds;
+}
+
+int main(int argc, char **argv) {
+  int files = (argc > 1) ? atoi(argv[1]) : 5000;
+  int rounds = (argc > 2) ? atoi(argv[2]) : 2000;
+  int depth = (argc > 3) ? atoi(argv[3]) : 8;
+  if ((files <= 0) || (rounds <= 0) || (depth <= 0)) return 1;
+
+  size_t total = LIST_HEADER_SIZE + (size_t)files * LIST_DESCRIPTOR_SIZE;
+  int packCnt = (int)((total + PACK_DATA_SIZE - 1) / PACK_DATA_SIZE);
+  std::vector<std::vector<uint8_t> > packs(packCnt);
+  for (int i = 0; i < packCnt; i++) {
+    size_t dataLen = std::min<size_t>(PACK_DATA_SIZE, total - i * PACK_DATA_SIZE);
+    packs[i].resize(PACK_HEADER_SIZE + dataLen);
+    for (auto &byte : packs[i]) byte = rand();
+  }
+  std::vector<int> order(packCnt);
+  for (int i = 0; i < packCnt; i++) order[i] = i;
+  srand(1);
+  for (int i = 0; i < packCnt; i += depth) {
+    std::random_shuffle(order.begin() + i,
+                        order.begin() + std::min(packCnt, i + depth));
+  }
+
+  printf("%d files, %d packs, reorder depth %d\n", files, packCnt, depth);
+  int slots[] = {DOWNLOAD_LIST_BUFFER_PACKS, 5000};
+  for (int slotCnt : slots) {
+    size_t gathered = 0;
+    double us = replay(slotCnt, packs, order, rounds, gathered);
+    printf("%5d slots: %7.1f us per list, %5zu kB queue, %s\n", slotCnt, us,
+           (size_t)slotCnt * (DOWNLOAD_BUFFER_SLOT_SIZE + sizeof(uint32_t)) /
+               1024,
+           (gathered == total) ? "complete" : "INCOMPLETE");
+  }
+  return 0;
+}
@@ -0,0 +1,148 @@
+/** @file hms_alarm_benchmark.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Lookup and formatting of a 50-alarm HMS push
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "benchmark_common.hpp"
+#include "dji_hms_internal.hpp"
+
+using namespace DJI::OSDK;
+
+/*! Usage: hms_alarm_benchmark [alarms per push] [pushes]
+ *
+ *  Looks up and formats the alarms of a push as MarchErrCodeInfoTbl does,
+ *  with findHMSErrCodeInfo and formatHMSAlarmInfo into one buffer, and
+ *  reports the cost per push. For reference the same is done with the scan
+ *  of the whole table and the three std::string replacements per alarm they
+ *  replaced. Every template of the table is also formatted both ways and
+ *  the results compared. */
+
+typedef struct Alarm {
+  uint32_t alarmId;
+  uint8_t sensorIndex;
+} Alarm;
+
+static const uint8_t componentIndex = 1;
+
+/*! The formatting before formatHMSAlarmInfo, on a copy of the template */
+static std::string replaceAll(const char *alarmInfo, uint32_t alarmId,
+                              uint8_t sensorIndex) {
+  char alarmIdStr[16], indexStr[8], componentIndexStr[8];
+  snprintf(alarmIdStr, sizeof(alarmIdStr), "0x%08X", alarmId);
+  snprintf(indexStr, sizeof(indexStr), "%d", sensorIndex);
+  snprintf(componentIndexStr, sizeof(componentIndexStr), "%d", componentIndex);
+  std::string info = alarmInfo;
+  replaceStr(info, "%alarmid", alarmIdStr);
+  replaceStr(info, "%index", indexStr);
+  replaceStr(info, "%component_index", componentIndexStr);
+  return info;
+}
+
+static double runTable(const std::vector<Alarm> &alarms, int pushes,
+                       size_t &chars) {
+  char alarmInfo[hmsAlarmInfoMaxLen];
+  chars = 0;
+  uint64_t startUs = benchmarkNowUs();
+  for (int push = 0; push < pushes; push++) {
+    for (const Alarm &alarm : alarms) {
+      const HMSErrCodeInfo *info = findHMSErrCodeInfo(alarm.alarmId);
+      if (!info || info->groundAlarmInfo[0] == '\0') continue;
+      chars += formatHMSAlarmInfo(alarmInfo, sizeof(alarmInfo),
+                                  info->groundAlarmInfo, alarm.alarmId,
+                                  alarm.sensorIndex, componentIndex);
+    }
+  }
+  return (double)(benchmarkNowUs() - startUs) / pushes;
+}
+
+static double runScan(const HMSErrCodeInfo *table, uint32_t size,
+                      const std::vector<Alarm> &alarms, int pushes,
+                      size_t &chars) {
+  chars = 0;
+  uint64_t startUs = benchmarkNowUs();
+  for (int push = 0; push < pushes; push++) {
+    for (const Alarm &alarm : alarms) {
+      for (uint32_t i = 0; i < size; i++) {
+        if (table[i].alarmId != alarm.alarmId) continue;
+        if (table[i].groundAlarmInfo[0] == '\0') continue;
+        chars += replaceAll(table[i].groundAlarmInfo, alarm.alarmId,
+                            alarm.sensorIndex).size();
+      }
+    }
+  }
+  return (double)(benchmarkNowUs() - startUs) / pushes;
+}
+
+int main(int argc, char **argv) {
+  int alarmCnt = (argc > 1) ? atoi(argv[1]) : 50;
+  int pushes = (argc > 2) ? atoi(argv[2]) : 20000;
+  if ((alarmCnt <= 0) || (pushes <= 0)) return 1;
+
+  uint32_t size = 0;
+  const HMSErrCodeInfo *table = getHMSErrCodeInfoTbl(size);
+  if (!size) return 1;
+
+  int mismatches = 0;
+  char alarmInfo[hmsAlarmInfoMaxLen];
+  for (uint32_t i = 0; i < size; i++) {
+    const char *templates[] = {table[i].groundAlarmInfo, table[i].flyAlarmInfo};
+    for (const char *alarmTemplate : templates) {
+      formatHMSAlarmInfo(alarmInfo, sizeof(alarmInfo), alarmTemplate,
+                         table[i].alarmId, i % 4, componentIndex);
+      if (replaceAll(alarmTemplate, table[i].alarmId, i % 4) != alarmInfo) {
+        printf("mismatch for 0x%08X: %s\n", table[i].alarmId, alarmInfo);
+        mismatches++;
+      }
+    }
+  }
+
+  /*! Alarms spread over the table, the last one of the push is unknown */
+  std::vector<Alarm> alarms(alarmCnt);
+  srand(1);
+  for (int i = 0; i < alarmCnt; i++) {
+    alarms[i].alarmId = table[rand() % size].alarmId;
+    alarms[i].sensorIndex = rand() % 4;
+  }
+  alarms.back().alarmId = 0xFFFFFFFF;
+
+  size_t tableChars, scanChars;
+  double tableUs = runTable(alarms, pushes, tableChars);
+  double scanUs = runScan(table, size, alarms, pushes, scanChars);
+
+  printf("%u table entries, %d alarms per push\n", size, alarmCnt);
+  printf("binary search and one pass: %7.2f us per push\n", tableUs);
+  printf("scan and std::string:       %7.2f us per push\n", scanUs);
+  printf("%d templates differ, %s\n", mismatches,
+         (tableChars == scanChars) ? "same output length"
+                                   : "DIFFERENT output length");
+  return (mismatches || (tableChars != scanChars)) ? 1 : 0;
+}
@@ -0,0 +1,186 @@
+/** @file liveview_dispatch_benchmark.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Per pack cost of dispatching liveview H.264 packs to the callbacks
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <map>
+#include <thread>
+#include "benchmark_common.hpp"
+#include "dji_liveview_impl.hpp"
+
+using namespace DJI::OSDK;
+
+/*! Usage: liveview_dispatch_benchmark [packs]
+ *
+ *  Feeds packs of the four camera positions to LiveViewImpl's
+ *  RecordStreamHandler, as the USB receive thread does, and reports the
+ *  cost per pack. For reference the same is done with a copy of the
+ *  position->handler map per pack, which is what the handler table
+ *  replaced. A last run replaces the callbacks from another thread all the
+ *  time and checks that every pack reaches a cb with its own userData. */
+
+#define LIVEVIEW_CMD_SET 0x65
+
+static const uint8_t cmdIds[] = {0x54, 0x55, 0x56, 0x57};
+static const LiveView::LiveViewCameraPosition positions[] = {
+    LiveView::OSDK_CAMERA_POSITION_FPV, LiveView::OSDK_CAMERA_POSITION_NO_1,
+    LiveView::OSDK_CAMERA_POSITION_NO_2, LiveView::OSDK_CAMERA_POSITION_NO_3,
+};
+
+namespace DJI {
+namespace OSDK {
+/*! The friend of LiveViewImpl reaching its dispatch without a Vehicle */
+class LiveViewDispatchBench {
+ public:
+  static void set(LiveView::LiveViewCameraPosition pos, H264Callback cb,
+                  void *userData) {
+    LiveViewImpl::setH264Callback(pos, cb, userData);
+  }
+
+  static void dispatch(const T_CmdInfo *cmdInfo, const uint8_t *cmdData) {
+    LiveViewImpl::RecordStreamHandler(NULL, cmdInfo, cmdData,
+                                      LiveViewImpl::h264CbHandlerTable);
+  }
+};
+}  // namespace OSDK
+}  // namespace DJI
+
+static uint64_t packsSeen[2];
+static uint64_t mismatches;
+
+static void countCB(uint8_t *buf, int bufLen, void *userData) {
+  (void)buf;
+  (void)bufLen;
+  (*(uint64_t *)userData)++;
+}
+
+static void checkCB0(uint8_t *buf, int bufLen, void *userData) {
+  (void)buf;
+  (void)bufLen;
+  if (userData != &packsSeen[0]) mismatches++;
+  packsSeen[0]++;
+}
+
+static void checkCB1(uint8_t *buf, int bufLen, void *userData) {
+  (void)buf;
+  (void)bufLen;
+  if (userData != &packsSeen[1]) mismatches++;
+  packsSeen[1]++;
+}
+
+/*! The dispatch RecordStreamHandler did before the table */
+typedef std::map<LiveView::LiveViewCameraPosition,
+                 LiveViewImpl::H264CallbackHandler> HandlerMap;
+
+static void mapDispatch(const T_CmdInfo *cmdInfo, const uint8_t *cmdData,
+                        void *userData) {
+  HandlerMap handlerMap = *(HandlerMap *)userData;
+  LiveView::LiveViewCameraPosition pos;
+  switch (cmdInfo->cmdId) {
+    case 0x54: pos = LiveView::OSDK_CAMERA_POSITION_FPV; break;
+    case 0x55: pos = LiveView::OSDK_CAMERA_POSITION_NO_1; break;
+    case 0x56: pos = LiveView::OSDK_CAMERA_POSITION_NO_2; break;
+    default: pos = LiveView::OSDK_CAMERA_POSITION_NO_3; break;
+  }
+  if ((handlerMap.find(pos) != handlerMap.end()) &&
+      (handlerMap[pos].cb != NULL)) {
+    handlerMap[pos].cb((uint8_t *)cmdData, cmdInfo->dataLen,
+                       handlerMap[pos].userData);
+  }
+}
+
+int main(int argc, char **argv) {
+  uint64_t packs = (argc > 1) ? strtoull(argv[1], NULL, 0) : 10000000;
+  uint8_t data[1024] = {0};
+  T_CmdInfo cmdInfo[4];
+  for (int i = 0; i < 4; i++) {
+    cmdInfo[i] = T_CmdInfo();
+    cmdInfo[i].cmdSet = LIVEVIEW_CMD_SET;
+    cmdInfo[i].cmdId = cmdIds[i];
+    cmdInfo[i].dataLen = sizeof(data);
+  }
+
+  uint64_t count = 0;
+  HandlerMap handlerMap;
+  for (int i = 0; i < 4; i++) {
+    LiveViewDispatchBench::set(positions[i], countCB, &count);
+    handlerMap[positions[i]].cb = countCB;
+    handlerMap[positions[i]].userData = &count;
+  }
+
+  uint64_t startUs = benchmarkNowUs();
+  for (uint64_t i = 0; i < packs; i++) {
+    LiveViewDispatchBench::dispatch(&cmdInfo[i & 3], data);
+  }
+  uint64_t tableUs = benchmarkNowUs() - startUs;
+
+  startUs = benchmarkNowUs();
+  for (uint64_t i = 0; i < packs; i++) {
+    mapDispatch(&cmdInfo[i & 3], data, &handlerMap);
+  }
+  uint64_t mapUs = benchmarkNowUs() - startUs;
+
+  printf("handler table: %6.1f ns per pack\n", tableUs * 1000.0 / packs);
+  printf("map copy     : %6.1f ns per pack\n", mapUs * 1000.0 / packs);
+  if (count != 2 * packs) {
+    printf("FAILED, %llu of %llu packs dispatched\n",
+           (unsigned long long)count, (unsigned long long)(2 * packs));
+    return 1;
+  }
+
+  /*! Replace the callback of the main camera all the time meanwhile */
+  LiveViewDispatchBench::set(LiveView::OSDK_CAMERA_POSITION_NO_1, checkCB0,
+                             &packsSeen[0]);
+  volatile bool stop = false;
+  uint64_t sets = 1;
+  std::thread setter([&stop, &sets] {
+    while (!stop) {
+      LiveViewDispatchBench::set(LiveView::OSDK_CAMERA_POSITION_NO_1,
+                                 (sets & 1) ? checkCB1 : checkCB0,
+                                 &packsSeen[sets & 1]);
+      sets++;
+    }
+  });
+  startUs = benchmarkNowUs();
+  for (uint64_t i = 0; i < packs; i++) {
+    LiveViewDispatchBench::dispatch(&cmdInfo[1], data);
+  }
+  uint64_t swapUs = benchmarkNowUs() - startUs;
+  stop = true;
+  setter.join();
+
+  printf("while setting: %6.1f ns per pack, %llu sets, %llu mismatches\n",
+         swapUs * 1000.0 / packs, (unsigned long long)sets,
+         (unsigned long long)mismatches);
+  if (mismatches || (packsSeen[0] + packsSeen[1] != packs)) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,201 @@
+/** @file mmap_file_buffer_benchmark.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Write a large file through MmapFileBuffer the way a download does
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+#include "benchmark_common.hpp"
+#include "mmap_file_buffer.hpp"
+
+using namespace DJI::OSDK;
+
+/*! Usage: mmap_file_buffer_benchmark [path] [MB] [block bytes]
+ *
+ *  Writes MB of data in blocks of the size of a download pack, with every
+ *  pair of neighbouring blocks swapped as packs come out of order, and every
+ *  64th block written twice as a resent pack is. It is done once through
+ *  MmapFileBuffer and once through a mapping of the whole file, which is
+ *  what MmapFileBuffer replaced. Reported for both: the throughput, the
+ *  slowest single write as seen by the receive thread, the time closing
+ *  takes and the peak of dirty page cache. */
+
+typedef struct Result {
+  double mbPerSec;
+  uint64_t maxBlockUs;
+  uint64_t closeUs;
+  uint64_t peakDirtyKB;
+} Result;
+
+static std::vector<uint64_t> blockOrder(uint64_t blocks) {
+  std::vector<uint64_t> order;
+  order.reserve(blocks + blocks / 64);
+  for (uint64_t i = 0; i < blocks; i += 2) {
+    if (i + 1 < blocks) order.push_back(i + 1);
+    order.push_back(i);
+    if (i % 64 == 0) order.push_back(i);
+  }
+  return order;
+}
+
+static void fillBlock(std::vector<uint8_t> &buf, uint64_t block) {
+  for (size_t i = 0; i < buf.size(); i += 8) {
+    uint64_t v = block * 0x9E3779B97F4A7C15ull + i;
+    memcpy(&buf[i], &v, (buf.size() - i < 8) ? buf.size() - i : 8);
+  }
+}
+
+static bool runWindowed(const char *path, uint64_t size, uint32_t blockSize,
+                        Result &result) {
+  MmapFileBuffer buffer;
+  std::vector<uint8_t> block(blockSize);
+  uint64_t blocks = (size + blockSize - 1) / blockSize;
+  uint64_t baseDirty = benchmarkDirtyKB();
+  uint64_t startUs = benchmarkNowUs();
+
+  if (!buffer.init(path, size)) return false;
+  memset(&result, 0, sizeof(result));
+  uint64_t n = 0;
+  for (uint64_t b : blockOrder(blocks)) {
+    uint64_t offset = b * blockSize;
+    uint32_t len = (offset + blockSize > size) ? size - offset : blockSize;
+    fillBlock(block, b);
+    uint64_t t0 = benchmarkNowUs();
+    if (!buffer.InsertBlock(block.data(), len, offset)) return false;
+    uint64_t us = benchmarkNowUs() - t0;
+    if (us > result.maxBlockUs) result.maxBlockUs = us;
+    if ((++n % 4096) == 0) {
+      uint64_t dirty = benchmarkDirtyKB();
+      if (dirty > baseDirty && dirty - baseDirty > result.peakDirtyKB)
+        result.peakDirtyKB = dirty - baseDirty;
+    }
+  }
+  uint64_t closeStartUs = benchmarkNowUs();
+  buffer.deInit();
+  uint64_t endUs = benchmarkNowUs();
+  result.closeUs = endUs - closeStartUs;
+  result.mbPerSec = (double)size / (endUs - startUs);
+  return true;
+}
+
+static bool runWholeFile(const char *path, uint64_t size, uint32_t blockSize,
+                         Result &result) {
+  std::vector<uint8_t> block(blockSize);
+  uint64_t blocks = (size + blockSize - 1) / blockSize;
+  uint64_t baseDirty = benchmarkDirtyKB();
+  uint64_t startUs = benchmarkNowUs();
+
+  int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if ((fd < 0) || (ftruncate(fd, size) != 0)) return false;
+  char *addr = (char *)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                            fd, 0);
+  if (addr == MAP_FAILED) return false;
+  memset(&result, 0, sizeof(result));
+  uint64_t n = 0;
+  for (uint64_t b : blockOrder(blocks)) {
+    uint64_t offset = b * blockSize;
+    uint32_t len = (offset + blockSize > size) ? size - offset : blockSize;
+    fillBlock(block, b);
+    uint64_t t0 = benchmarkNowUs();
+    memcpy(addr + offset, block.data(), len);
+    uint64_t us = benchmarkNowUs() - t0;
+    if (us > result.maxBlockUs) result.maxBlockUs = us;
+    if ((++n % 4096) == 0) {
+      uint64_t dirty = benchmarkDirtyKB();
+      if (dirty > baseDirty && dirty - baseDirty > result.peakDirtyKB)
+        result.peakDirtyKB = dirty - baseDirty;
+    }
+  }
+  uint64_t closeStartUs = benchmarkNowUs();
+  munmap(addr, size);
+  close(fd);
+  uint64_t endUs = benchmarkNowUs();
+  result.closeUs = endUs - closeStartUs;
+  result.mbPerSec = (double)size / (endUs - startUs);
+  return true;
+}
+
+static bool checkFile(const char *path, uint64_t size, uint32_t blockSize) {
+  FILE *fp = fopen(path, "rb");
+  if (!fp) return false;
+  std::vector<uint8_t> expected(blockSize);
+  std::vector<uint8_t> got(blockSize);
+  bool ok = true;
+  for (uint64_t b = 0; ok && (b * blockSize < size); b++) {
+    uint64_t offset = b * blockSize;
+    uint32_t len = (offset + blockSize > size) ? size - offset : blockSize;
+    fillBlock(expected, b);
+    ok = (fread(got.data(), 1, len, fp) == len) &&
+         (memcmp(got.data(), expected.data(), len) == 0);
+  }
+  fclose(fp);
+  return ok;
+}
+
+static void printResult(const char *name, const Result &result) {
+  printf("%-12s %8.0f MB/s  slowest block %6llu us  close %8.1f ms  "
+         "peak dirty +%llu MB\n",
+         name, result.mbPerSec, (long long unsigned int)result.maxBlockUs,
+         result.closeUs / 1000.0,
+         (long long unsigned int)(result.peakDirtyKB / 1024));
+}
+
+int main(int argc, char **argv) {
+  const char *path = (argc > 1) ? argv[1] : "mmap_file_buffer_benchmark.bin";
+  uint64_t size = ((argc > 2) ? strtoull(argv[2], NULL, 0) : 1024) << 20;
+  uint32_t blockSize = (argc > 3) ? strtoul(argv[3], NULL, 0) : 1000;
+  Result result;
+
+  if (!setupBenchmarkEnvironment() || !blockSize) return -1;
+  printf("Writing %llu MB in %u byte blocks to %s\n",
+         (long long unsigned int)(size >> 20), blockSize, path);
+
+  remove(path);
+  if (!runWindowed(path, size, blockSize, result)) {
+    printf("MmapFileBuffer failed\n");
+    return -1;
+  }
+  printResult("windowed", result);
+  if (!checkFile(path, size, blockSize)) {
+    printf("MmapFileBuffer wrote wrong data\n");
+    return -1;
+  }
+
+  remove(path);
+  if (!runWholeFile(path, size, blockSize, result)) {
+    printf("Whole file mapping failed\n");
+    return -1;
+  }
+  printResult("whole-file", result);
+  remove(path);
+  return 0;
+}
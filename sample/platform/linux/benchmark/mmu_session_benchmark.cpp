@@ -0,0 +1,213 @@
+/** @file mmu_session_benchmark.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Session buffer allocation of MMU against the first-fit arena it replaced
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "benchmark_common.hpp"
+#include "dji_memory.hpp"
+
+using namespace DJI::OSDK;
+
+/*! Usage: mmu_session_benchmark [operations] [sessions]
+ *
+ *  Every operation picks one of sessions slots at random and frees its
+ *  buffer, or allocates one when the slot is empty, as sessions of the
+ *  protocol come and go. Three buffers in four are commands or acks of 10
+ *  to 69 bytes, the others 200 to 299 bytes, and one in 256 is a full size
+ *  pack. The same sequence runs on MMU and on a copy of the first-fit scan
+ *  over a 1KB arena MMU replaced, reported per operation with the requests
+ *  that could not be served. */
+
+#define FIRST_FIT_TABLE_NUM 32
+#define FIRST_FIT_MEMORY_SIZE 1024
+
+/*! The allocator MMU had before the size classes, kept for reference */
+class FirstFitArena {
+ public:
+  FirstFitArena() {
+    table[0].tabIndex = 0;
+    table[0].usageFlag = 1;
+    table[0].pmem = memory;
+    table[0].memSize = 0;
+    for (int i = 1; i < FIRST_FIT_TABLE_NUM - 1; i++) {
+      table[i].tabIndex = i;
+      table[i].usageFlag = 0;
+    }
+    table[FIRST_FIT_TABLE_NUM - 1].tabIndex = FIRST_FIT_TABLE_NUM - 1;
+    table[FIRST_FIT_TABLE_NUM - 1].usageFlag = 1;
+    table[FIRST_FIT_TABLE_NUM - 1].pmem = memory + FIRST_FIT_MEMORY_SIZE;
+    table[FIRST_FIT_TABLE_NUM - 1].memSize = 0;
+  }
+
+  void freeMemory(MMU_Tab *tab) {
+    if (tab && tab->tabIndex && (tab->tabIndex != FIRST_FIT_TABLE_NUM - 1))
+      tab->usageFlag = 0;
+  }
+
+  MMU_Tab *allocMemory(uint16_t size) {
+    uint32_t used = 0;
+    uint8_t usedNum = 0;
+    uint8_t usedIndex[FIRST_FIT_TABLE_NUM];
+    if (size > PRO_PURE_DATA_MAX_SIZE) return NULL;
+    for (int i = 0; i < FIRST_FIT_TABLE_NUM; i++) {
+      if (table[i].usageFlag == 1) {
+        used += table[i].memSize;
+        usedIndex[usedNum++] = table[i].tabIndex;
+      }
+    }
+    if (FIRST_FIT_MEMORY_SIZE < used + size) return NULL;
+    if (used == 0) return take(1, table[0].pmem, size);
+
+    /*! Sort the used blocks by address, then look for the smallest gap */
+    for (int i = 0; i < usedNum - 1; i++) {
+      for (int j = 0; j < usedNum - i - 1; j++) {
+        if (table[usedIndex[j]].pmem > table[usedIndex[j + 1]].pmem) {
+          uint8_t index = usedIndex[j];
+          usedIndex[j] = usedIndex[j + 1];
+          usedIndex[j + 1] = index;
+        }
+      }
+    }
+    uint32_t bestIndex = 0xFFFFFFFF, bestGap = 0xFFFFFFFF, freeBytes = 0;
+    int last = -1;
+    for (int i = 0; i < usedNum - 1; i++) {
+      MMU_Tab &cur = table[usedIndex[i]];
+      uint32_t gap = (uint32_t)(table[usedIndex[i + 1]].pmem - cur.pmem) -
+                     cur.memSize;
+      if ((gap >= size) && (gap < bestGap)) {
+        bestIndex = cur.tabIndex;
+        bestGap = gap;
+      }
+      freeBytes += gap;
+      if ((freeBytes >= size) && (last < 0)) last = i;
+    }
+    if (bestIndex != 0xFFFFFFFF)
+      return takeFree(table[bestIndex].pmem + table[bestIndex].memSize, size);
+
+    /*! No gap is large enough, move the blocks down until one is */
+    for (int i = 0; i < last; i++) {
+      MMU_Tab &cur = table[usedIndex[i]];
+      MMU_Tab &next = table[usedIndex[i + 1]];
+      if (next.pmem > cur.pmem + cur.memSize) {
+        memmove(cur.pmem + cur.memSize, next.pmem, next.memSize);
+        next.pmem = cur.pmem + cur.memSize;
+      }
+    }
+    return takeFree(
+        table[usedIndex[last]].pmem + table[usedIndex[last]].memSize, size);
+  }
+
+ private:
+  MMU_Tab table[FIRST_FIT_TABLE_NUM];
+  uint8_t memory[FIRST_FIT_MEMORY_SIZE];
+
+  MMU_Tab *take(int index, uint8_t *pmem, uint16_t size) {
+    table[index].pmem = pmem;
+    table[index].memSize = size;
+    table[index].usageFlag = 1;
+    return &table[index];
+  }
+
+  MMU_Tab *takeFree(uint8_t *pmem, uint16_t size) {
+    for (int i = 1; i < FIRST_FIT_TABLE_NUM - 1; i++) {
+      if (table[i].usageFlag == 0) return take(i, pmem, size);
+    }
+    return NULL;
+  }
+};
+
+typedef struct Operation {
+  int slot;
+  uint16_t size;
+} Operation;
+
+template <typename Allocator>
+static double run(Allocator &allocator, const std::vector<Operation> &ops,
+                  int sessions, uint32_t &failed) {
+  std::vector<MMU_Tab *> live(sessions, (MMU_Tab *)NULL);
+  failed = 0;
+  uint64_t startUs = benchmarkNowUs();
+  for (const Operation &op : ops) {
+    MMU_Tab *&tab = live[op.slot];
+    if (tab) {
+      allocator.freeMemory(tab);
+      tab = NULL;
+    } else if ((tab = allocator.allocMemory(op.size)) != NULL) {
+      tab->pmem[0] = (uint8_t)op.size;
+    } else {
+      failed++;
+    }
+  }
+  uint64_t elapsedUs = benchmarkNowUs() - startUs;
+  for (MMU_Tab *tab : live) {
+    if (tab) allocator.freeMemory(tab);
+  }
+  return elapsedUs * 1000.0 / ops.size();
+}
+
+int main(int argc, char **argv) {
+  int count = (argc > 1) ? atoi(argv[1]) : 2000000;
+  int sessions = (argc > 2) ? atoi(argv[2]) : 8;
+  if ((count <= 0) || (sessions <= 0)) return 1;
+
+  std::vector<Operation> ops(count);
+  srand(1);
+  for (Operation &op : ops) {
+    op.slot = rand() % sessions;
+    if (rand() % 256 == 0)
+      op.size = PRO_PURE_DATA_MAX_SIZE;
+    else if (rand() % 4 == 0)
+      op.size = 200 + rand() % 100;
+    else
+      op.size = 10 + rand() % 60;
+  }
+
+  static FirstFitArena firstFit;
+  static MMU mmu;
+  uint32_t firstFitFailed, mmuFailed;
+  double firstFitNs = run(firstFit, ops, sessions, firstFitFailed);
+  double mmuNs = run(mmu, ops, sessions, mmuFailed);
+
+  printf("%d operations over %d sessions\n", count, sessions);
+  printf("first fit, %4d B: %6.1f ns per operation, %u failed\n",
+         FIRST_FIT_MEMORY_SIZE, firstFitNs, firstFitFailed);
+  printf("MMU,       %4d B: %6.1f ns per operation, %u failed\n",
+         MMU::MEMORY_SIZE, mmuNs, mmuFailed);
+
+  MMU::Stats stats;
+  mmu.getStats(&stats);
+  for (int c = 0; c < MMU::CLASS_NUM; c++) {
+    printf("  %4u B class: %2u blocks, %2u used at most, empty %u times\n",
+           stats.classes[c].blockSize, stats.classes[c].blockNum,
+           stats.classes[c].highWater, stats.classes[c].exhausted);
+  }
+  return 0;
+}
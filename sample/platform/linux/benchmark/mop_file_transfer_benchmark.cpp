@@ -0,0 +1,406 @@
+/** @file mop_file_transfer_benchmark.cpp
+ *  @version 4.0.0
+ *  @date Oct 2026
+ *
+ *  @brief
+ *  Uploads and downloads of MopFileTransfer over a stand-in mop channel
+ *
+ *  @Copyright (c) 2020 DJI
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "benchmark_common.hpp"
+#include "dji_mop_file_transfer.hpp"
+#include "mop.h"
+#include "osdk_md5.h"
+
+using namespace DJI::OSDK;
+
+/*! Usage: mop_file_transfer_benchmark [file MB] [link MB/s] [latency us]
+ *  [disk MB/s]
+ *
+ *  The mop library needs a vehicle, so the benchmark links with
+ *  --wrap=mop_read_channel,--wrap=mop_write_channel and the two pipelines
+ *  of a link talk through in-memory queues instead. Every write pays
+ *  length / link speed plus the latency, a read times out after 100ms
+ *  without data like the library does. The file reads and writes of the
+ *  transfers are wrapped too and pay length / disk speed, the page cache
+ *  would hide the disk otherwise. 0 leaves the link or the disk as fast as
+ *  they are. Runs the sequential upload of the MOP samples, which hashes
+ *  the whole file before sending it and then reads and sends one chunk at
+ *  a time, against the uploads and download of MopFileTransfer, and two
+ *  uploads at once over two links. Every copy is compared with the file
+ *  sent. */
+
+#define LINK_QUEUE_BYTES (1 << 20)
+#define LINK_READ_TIMEOUT_MS 100
+#define SAMPLE_CHUNK_SIZE (100 * 1024 - sizeof(MopFileTransfer::PackHeader))
+#define SAMPLE_RECV_SIZE (3 * 1024 * 1024)
+
+typedef MopFileTransfer::PackHeader PackHeader;
+typedef MopFileTransfer::FileInfo FileInfo;
+
+typedef struct LinkQueue {
+  std::mutex mutex;
+  std::condition_variable cond;
+  std::deque<std::vector<uint8_t> > packs;
+  size_t bytes;
+} LinkQueue;
+
+typedef struct LinkEnd {
+  LinkQueue *tx;
+  LinkQueue *rx;
+} LinkEnd;
+
+static double linkBytesPerUs;
+static uint32_t linkLatencyUs;
+static double diskBytesPerUs;
+
+static void diskDelay(size_t len) {
+  if ((diskBytesPerUs > 0) && len) usleep((useconds_t)(len / diskBytesPerUs));
+}
+
+extern "C" {
+ssize_t __real_pread(int fd, void *buf, size_t len, off_t offset);
+ssize_t __real_pwrite(int fd, const void *buf, size_t len, off_t offset);
+size_t __real_fread(void *buf, size_t size, size_t count, FILE *fp);
+size_t __real_fwrite(const void *buf, size_t size, size_t count, FILE *fp);
+
+ssize_t __wrap_pread(int fd, void *buf, size_t len, off_t offset) {
+  diskDelay(len);
+  return __real_pread(fd, buf, len, offset);
+}
+
+ssize_t __wrap_pwrite(int fd, const void *buf, size_t len, off_t offset) {
+  diskDelay(len);
+  return __real_pwrite(fd, buf, len, offset);
+}
+
+size_t __wrap_fread(void *buf, size_t size, size_t count, FILE *fp) {
+  diskDelay(size * count);
+  return __real_fread(buf, size, count, fp);
+}
+
+size_t __wrap_fwrite(const void *buf, size_t size, size_t count, FILE *fp) {
+  diskDelay(size * count);
+  return __real_fwrite(buf, size, count, fp);
+}
+
+int32_t __wrap_mop_write_channel(mop_channel_handle_t handle, void *buf,
+                                 uint32_t length) {
+  LinkQueue *queue = ((LinkEnd *)handle)->tx;
+  if (linkBytesPerUs > 0)
+    usleep((useconds_t)(length / linkBytesPerUs) + linkLatencyUs);
+  {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    queue->cond.wait(lock, [queue] { return queue->bytes < LINK_QUEUE_BYTES; });
+    queue->packs.push_back(
+        std::vector<uint8_t>((uint8_t *)buf, (uint8_t *)buf + length));
+    queue->bytes += length;
+  }
+  queue->cond.notify_all();
+  return length;
+}
+
+int32_t __wrap_mop_read_channel(mop_channel_handle_t handle, void *buf,
+                                uint32_t length) {
+  LinkQueue *queue = ((LinkEnd *)handle)->rx;
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!queue->cond.wait_for(lock,
+                            std::chrono::milliseconds(LINK_READ_TIMEOUT_MS),
+                            [queue] { return !queue->packs.empty(); }))
+    return MOP_ERR_TIMEOUT;
+  std::vector<uint8_t> pack;
+  pack.swap(queue->packs.front());
+  queue->packs.pop_front();
+  queue->bytes -= pack.size();
+  queue->cond.notify_all();
+  uint32_t len = (pack.size() < length) ? pack.size() : length;
+  memcpy(buf, pack.data(), len);
+  return len;
+}
+}
+
+/*! Two pipelines connected by a queue in each direction */
+class Link {
+ public:
+  Link() : client(1, RELIABLE), server(1, RELIABLE) {
+    up.bytes = down.bytes = 0;
+    clientEnd.tx = serverEnd.rx = &up;
+    clientEnd.rx = serverEnd.tx = &down;
+    client.channelHandle = &clientEnd;
+    server.channelHandle = &serverEnd;
+  }
+
+  MopPipeline client;
+  MopPipeline server;
+
+ private:
+  LinkQueue up;
+  LinkQueue down;
+  LinkEnd clientEnd;
+  LinkEnd serverEnd;
+};
+
+/*! makeFile and sameFile use read and write, the disk speed is only paid
+ *  by the transfers */
+static void makeFile(const std::string &path, uint32_t size) {
+  int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (fd < 0) return;
+  std::vector<uint8_t> buf(1 << 20);
+  srand(size);
+  for (uint32_t done = 0; done < size;) {
+    for (auto &byte : buf) byte = rand();
+    uint32_t len = std::min<uint32_t>(buf.size(), size - done);
+    if (write(fd, buf.data(), len) != (ssize_t)len) break;
+    done += len;
+  }
+  close(fd);
+}
+
+static bool sameFile(const std::string &a, const std::string &b) {
+  int fdA = open(a.c_str(), O_RDONLY);
+  int fdB = open(b.c_str(), O_RDONLY);
+  bool same = (fdA >= 0) && (fdB >= 0);
+  std::vector<uint8_t> bufA(1 << 20), bufB(1 << 20);
+  while (same) {
+    ssize_t lenA = read(fdA, bufA.data(), bufA.size());
+    ssize_t lenB = read(fdB, bufB.data(), bufB.size());
+    same = (lenA >= 0) && (lenA == lenB) &&
+           !memcmp(bufA.data(), bufB.data(), lenA);
+    if (lenA <= 0) break;
+  }
+  if (fdA >= 0) close(fdA);
+  if (fdB >= 0) close(fdB);
+  return same;
+}
+
+static bool sendPack(MopPipeline &pipeline, uint8_t *buf, uint32_t len) {
+  MopPipeline::DataPackType pack = {buf, len};
+  uint32_t sent = 0;
+  return pipeline.sendData(pack, &sent) == MOP_PASSED;
+}
+
+static bool recvPack(MopPipeline &pipeline, uint8_t *buf, uint32_t size) {
+  MopPipeline::DataPackType pack = {buf, size};
+  uint32_t len = 0;
+  MopErrCode ret;
+  while ((ret = pipeline.recvData(pack, &len)) == MOP_TIMEOUT) {
+  }
+  return (ret == MOP_PASSED) && (len >= sizeof(PackHeader));
+}
+
+/*! The upload of the MOP samples, one thread hashing, reading and sending */
+static bool sampleUpload(MopPipeline &pipeline, const std::string &path,
+                         const char *name) {
+  FILE *fp = fopen(path.c_str(), "rb");
+  if (!fp) return false;
+  std::vector<uint8_t> buf(sizeof(PackHeader) + SAMPLE_CHUNK_SIZE);
+  uint8_t answer[64];
+  PackHeader *header = (PackHeader *)buf.data();
+  FileInfo info;
+  memset(&info, 0, sizeof(info));
+  info.isExist = true;
+  memcpy(info.fileName, name, strlen(name));
+
+  MD5_CTX md5;
+  OsdkMd5_Init(&md5);
+  size_t len;
+  while ((len = fread(buf.data(), 1, buf.size(), fp)) > 0) {
+    OsdkMd5_Update(&md5, buf.data(), len);
+    info.fileLength += len;
+  }
+  OsdkMd5_Final(&md5, info.md5Buf);
+
+  *header = {MopFileTransfer::CMD_REQUEST, MopFileTransfer::REQ_UPLOAD, 0, 0};
+  bool ok = sendPack(pipeline, buf.data(), sizeof(PackHeader)) &&
+            recvPack(pipeline, answer, sizeof(answer));
+  *header = {MopFileTransfer::CMD_FILEINFO, MopFileTransfer::SUBCMD_DEFAULT, 0,
+             sizeof(info)};
+  memcpy(buf.data() + sizeof(PackHeader), &info, sizeof(info));
+  ok = ok && sendPack(pipeline, buf.data(), sizeof(PackHeader) + sizeof(info)) &&
+       recvPack(pipeline, answer, sizeof(answer));
+
+  fseek(fp, 0, SEEK_SET);
+  uint32_t done = 0;
+  for (uint16_t seq = 0; ok && (done < info.fileLength); seq++) {
+    len = fread(buf.data() + sizeof(PackHeader), 1, SAMPLE_CHUNK_SIZE, fp);
+    if (!len) break;
+    done += len;
+    *header = {MopFileTransfer::CMD_FILEDATA,
+               (done == info.fileLength) ? MopFileTransfer::END_PACK
+                                         : MopFileTransfer::NORMAL_PACK,
+               seq, (uint32_t)len};
+    ok = sendPack(pipeline, buf.data(), sizeof(PackHeader) + len);
+  }
+  fclose(fp);
+  ok = ok && (done == info.fileLength) &&
+       recvPack(pipeline, answer, sizeof(answer));
+  return ok && (((PackHeader *)answer)->cmd == MopFileTransfer::CMD_RESULT) &&
+         (((PackHeader *)answer)->subcmd == MopFileTransfer::RET_OK);
+}
+
+/*! The receiving side of the MOP samples */
+static bool sampleReceive(MopPipeline &pipeline, const std::string &dir) {
+  std::vector<uint8_t> buf(SAMPLE_RECV_SIZE);
+  PackHeader *header = (PackHeader *)buf.data();
+  PackHeader ack = {MopFileTransfer::CMD_ACK, MopFileTransfer::ACK_OK, 0, 0};
+  FileInfo info;
+  if (!recvPack(pipeline, buf.data(), buf.size()) ||
+      !sendPack(pipeline, (uint8_t *)&ack, sizeof(ack)) ||
+      !recvPack(pipeline, buf.data(), buf.size()) ||
+      !sendPack(pipeline, (uint8_t *)&ack, sizeof(ack)))
+    return false;
+  memcpy(&info, buf.data() + sizeof(PackHeader), sizeof(info));
+  info.fileName[sizeof(info.fileName) - 1] = 0;
+
+  FILE *fp = fopen((dir + "/" + info.fileName).c_str(), "wb");
+  if (!fp) return false;
+  MD5_CTX md5;
+  OsdkMd5_Init(&md5);
+  uint32_t done = 0;
+  while ((done < info.fileLength) &&
+         recvPack(pipeline, buf.data(), buf.size())) {
+    fwrite(buf.data() + sizeof(PackHeader), 1, header->dataLen, fp);
+    OsdkMd5_Update(&md5, buf.data() + sizeof(PackHeader), header->dataLen);
+    done += header->dataLen;
+    if (header->subcmd == MopFileTransfer::END_PACK) break;
+  }
+  fclose(fp);
+  uint8_t md5Buf[16];
+  OsdkMd5_Final(&md5, md5Buf);
+  bool ok = (done == info.fileLength) && !memcmp(md5Buf, info.md5Buf, 16);
+  PackHeader result = {MopFileTransfer::CMD_RESULT,
+                       ok ? MopFileTransfer::RET_OK : MopFileTransfer::RET_FAIL,
+                       0, 0};
+  return sendPack(pipeline, (uint8_t *)&result, sizeof(result)) && ok;
+}
+
+static void report(const char *name, bool ok, uint64_t us, uint32_t mb) {
+  printf("%-22s %7.2f s %7.1f MB/s %s\n", name, us / 1e6, mb / (us / 1e6),
+         ok ? "ok" : "FAILED");
+}
+
+int main(int argc, char **argv) {
+  uint32_t mb = (argc > 1) ? atoi(argv[1]) : 64;
+  linkBytesPerUs = (argc > 2) ? atof(argv[2]) : 20;
+  linkLatencyUs = (argc > 3) ? atoi(argv[3]) : 200;
+  double diskMBps = (argc > 4) ? atof(argv[4]) : 40;
+  if (!mb || !setupBenchmarkEnvironment()) return 1;
+
+  char dirTemplate[] = "/tmp/mop_file_transfer_XXXXXX";
+  if (!mkdtemp(dirTemplate)) return 1;
+  std::string dir = dirTemplate;
+  std::string cliDir = dir + "/cli", srvDir = dir + "/srv";
+  if (mkdir(cliDir.c_str(), 0700) || mkdir(srvDir.c_str(), 0700)) return 1;
+  std::string fileA = cliDir + "/a.bin", fileB = cliDir + "/b.bin";
+  std::string srvA = srvDir + "/a.bin", srvB = srvDir + "/b.bin";
+  makeFile(fileA, mb << 20);
+  makeFile(fileB, (mb << 20) + 12345);
+  printf("%u MB file, link %.1f MB/s + %u us per pack, disk %.1f MB/s\n", mb,
+         linkBytesPerUs, linkLatencyUs, diskMBps);
+  diskBytesPerUs = diskMBps;
+  bool failed = false;
+
+  {
+    Link link;
+    bool received = false;
+    uint64_t startUs = benchmarkNowUs();
+    std::thread server([&] { received = sampleReceive(link.server, srvDir); });
+    bool sent = sampleUpload(link.client, fileA, "a.bin");
+    server.join();
+    bool ok = sent && received && sameFile(fileA, srvA);
+    report("sample upload", ok, benchmarkNowUs() - startUs, mb);
+    failed |= !ok;
+  }
+  unlink(srvA.c_str());
+
+  {
+    Link link;
+    MopFileTransfer client(&link.client), server(&link.server);
+    MopErrCode served = MOP_FAILED;
+    uint64_t startUs = benchmarkNowUs();
+    std::thread serverTask([&] { served = server.serve(srvDir); });
+    MopErrCode ret = client.upload(fileA, "a.bin");
+    serverTask.join();
+    bool ok = (ret == MOP_PASSED) && (served == MOP_PASSED) &&
+              sameFile(fileA, srvA);
+    report("MopFileTransfer upload", ok, benchmarkNowUs() - startUs, mb);
+    MopFileTransfer::Stats stats = client.getStats();
+    printf("%22s channel waited %u ms, disk waited %u ms\n", "",
+           stats.channelWaitMs, stats.diskWaitMs);
+    failed |= !ok;
+  }
+
+  {
+    Link link;
+    MopFileTransfer client(&link.client), server(&link.server);
+    MopErrCode served = MOP_FAILED;
+    std::string copy = cliDir + "/a_copy.bin";
+    uint64_t startUs = benchmarkNowUs();
+    std::thread serverTask([&] { served = server.serve(srvDir); });
+    MopErrCode ret = client.download("a.bin", copy);
+    serverTask.join();
+    bool ok = (ret == MOP_PASSED) && (served == MOP_PASSED) &&
+              sameFile(fileA, copy);
+    report("MopFileTransfer dl", ok, benchmarkNowUs() - startUs, mb);
+    failed |= !ok;
+  }
+  unlink(srvA.c_str());
+
+  {
+    Link link1, link2;
+    MopFileTransfer client1(&link1.client), server1(&link1.server);
+    MopFileTransfer client2(&link2.client), server2(&link2.server);
+    MopErrCode ret[4] = {MOP_FAILED, MOP_FAILED, MOP_FAILED, MOP_FAILED};
+    uint64_t startUs = benchmarkNowUs();
+    std::thread serverTask1([&] { ret[0] = server1.serve(srvDir); });
+    std::thread serverTask2([&] { ret[1] = server2.serve(srvDir); });
+    std::thread clientTask2([&] { ret[3] = client2.upload(fileB, "b.bin"); });
+    ret[2] = client1.upload(fileA, "a.bin");
+    clientTask2.join();
+    serverTask1.join();
+    serverTask2.join();
+    bool ok = true;
+    for (MopErrCode r : ret) ok = ok && (r == MOP_PASSED);
+    ok = ok && sameFile(fileA, srvA) && sameFile(fileB, srvB);
+    report("2 uploads at once", ok, benchmarkNowUs() - startUs, 2 * mb);
+    failed |= !ok;
+  }
+
+  std::string cleanup = "rm -rf " + dir;
+  if (system(cleanup.c_str())) printf("could not remove %s\n", dir.c_str());
+  return failed ? 1 : 0;
+}
@@ -77,12 +77,21 @@ LinuxSetup::setupEnvironment(int argc, char** argv)
   };
 
 #ifdef ADVANCED_SENSING
+#ifndef OSDK_USB_BULK_SYNC
+  static T_OsdkHalUSBBulkHandler halUSBBulkHandler = {
+      .USBBulkInit = OsdkLinux_USBBulkAsyncInit,
+      .USBBulkWriteData = OsdkLinux_USBBulkAsyncSendData,
+      .USBBulkReadData = OsdkLinux_USBBulkAsyncReadData,
+      .USBBulkClose = OsdkLinux_USBBulkAsyncClose,
+  };
+#else
   static T_OsdkHalUSBBulkHandler halUSBBulkHandler = {
       .USBBulkInit = OsdkLinux_USBBulkInit,
       .USBBulkWriteData = OsdkLinux_USBBulkSendData,
       .USBBulkReadData = OsdkLinux_USBBulkReadData,
       .USBBulkClose = OsdkLinux_USBBulkClose,
   };
+#endif
 #endif
 
   static T_OsdkOsalHandler osalHandler = {
@@ -124,6 +133,16 @@ LinuxSetup::setupEnvironment(int argc, char** argv)
     throw std::runtime_error("Osal handler register fail");
   }
 
+  static T_OsdkOsalClockHandler osalClockHandler = {
+      .GetTimeUs = OsdkLinux_GetTimeUs,
+      .GetTimeNs = OsdkLinux_GetTimeNs,
+      .TaskSleepUntilNs = OsdkLinux_TaskSleepUntilNs,
+  };
+
+  if(DJI_REG_OSAL_CLOCK_HANDLER(&osalClockHandler) != true) {
+    throw std::runtime_error("Osal clock handler register fail");
+  }
+
   // Config file loading
   const char* acm_dev_prefix = "/dev/ttyACM";
   std::string config_file_path;
@@ -27,6 +27,11 @@
 /* Includes ------------------------------------------------------------------*/
 #include "osdkhal_linux.h"
 #include "errno.h"
+#include <poll.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <linux/serial.h>
 
 #ifdef OSDK_HOTPLUG
 #include "pthread.h"
@@ -44,6 +49,157 @@ E_OsdkStat OsdkLinux_USBBulkHotPlugInit(uint16_t pid,
                                         T_HalObj *obj);
 #endif
 
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+  int fd;
+  int epollFd;
+  int lastErrno;
+  int readers; /* OsdkLinux_UartReadData() calls inside the slot */
+  uint32_t rdPos;
+  uint32_t wrPos;
+  uint8_t buf[OSDK_UART_RX_BUF_SIZE];
+} T_UartRxContext;
+
+/* Private values ------------------------------------------------------------*/
+static T_UartRxContext s_uartRxContext[OSDK_UART_MAX_PORTS] = {
+    [0 ... OSDK_UART_MAX_PORTS - 1] = {.fd = -1, .epollFd = -1}};
+static pthread_mutex_t s_uartRxContextMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_uartRxContextCond = PTHREAD_COND_INITIALIZER;
+
+/* Private functions definition-----------------------------------------------*/
+static T_UartRxContext *OsdkLinux_UartGetRxContext(int fd) {
+  for (int i = 0; i < OSDK_UART_MAX_PORTS; i++) {
+    if (s_uartRxContext[i].fd == fd) {
+      return &s_uartRxContext[i];
+    }
+  }
+  return NULL;
+}
+
+/* Called with s_uartRxContextMutex held. Clearing fd keeps new readers out,
+ * the slot is only reused once the reader inside it has left and epollFd is
+ * closed. */
+static void OsdkLinux_UartRetireRxContext(T_UartRxContext *ctx) {
+  ctx->fd = -1;
+  while (ctx->readers > 0) {
+    pthread_cond_wait(&s_uartRxContextCond, &s_uartRxContextMutex);
+  }
+  if (ctx->epollFd != -1) {
+    close(ctx->epollFd);
+    ctx->epollFd = -1;
+  }
+}
+
+static void OsdkLinux_UartReleaseRxContext(int fd) {
+  T_UartRxContext *ctx;
+
+  pthread_mutex_lock(&s_uartRxContextMutex);
+  ctx = OsdkLinux_UartGetRxContext(fd);
+  if (ctx) {
+    OsdkLinux_UartRetireRxContext(ctx);
+  }
+  pthread_mutex_unlock(&s_uartRxContextMutex);
+}
+
+/* Registers fd with a new epoll instance. Slots whose fd was closed behind
+ * our back, e.g. by a hot plug re-init, are reclaimed on the way. */
+static E_OsdkStat OsdkLinux_UartCreateRxContext(int fd) {
+  T_UartRxContext *ctx = NULL;
+  struct epoll_event event;
+
+  pthread_mutex_lock(&s_uartRxContextMutex);
+  for (int i = 0; i < OSDK_UART_MAX_PORTS; i++) {
+    T_UartRxContext *cur = &s_uartRxContext[i];
+    if (cur->fd != -1 && (cur->fd == fd || fcntl(cur->fd, F_GETFD) == -1)) {
+      OsdkLinux_UartRetireRxContext(cur);
+    }
+    if (cur->fd == -1 && cur->epollFd == -1 && ctx == NULL) {
+      ctx = cur;
+    }
+  }
+
+  if (ctx == NULL) {
+    pthread_mutex_unlock(&s_uartRxContextMutex);
+    return OSDK_STAT_ERR_OUT_OF_RANGE;
+  }
+
+  ctx->epollFd = epoll_create1(EPOLL_CLOEXEC);
+  if (ctx->epollFd == -1) {
+    pthread_mutex_unlock(&s_uartRxContextMutex);
+    return OSDK_STAT_ERR;
+  }
+
+  memset(&event, 0, sizeof(event));
+  event.events = EPOLLIN;
+  event.data.fd = fd;
+  if (epoll_ctl(ctx->epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+    close(ctx->epollFd);
+    ctx->epollFd = -1;
+    pthread_mutex_unlock(&s_uartRxContextMutex);
+    return OSDK_STAT_ERR;
+  }
+
+  ctx->lastErrno = 0;
+  ctx->rdPos = 0;
+  ctx->wrPos = 0;
+  ctx->fd = fd;
+  pthread_mutex_unlock(&s_uartRxContextMutex);
+
+  return OSDK_STAT_OK;
+}
+
+/* Only called with an empty buffer, so the whole of it is one contiguous
+ * span and a single read() usually empties the tty. With VMIN = VTIME = 0
+ * read() returns 0 instead of blocking once the tty is empty. */
+static void OsdkLinux_UartDrain(T_UartRxContext *ctx, int fd,
+                                uint32_t events) {
+  ssize_t readLen = 0;
+  int err = 0;
+
+  ctx->rdPos = 0;
+  ctx->wrPos = 0;
+  while (ctx->wrPos < OSDK_UART_RX_BUF_SIZE) {
+    readLen = read(fd, ctx->buf + ctx->wrPos,
+                   OSDK_UART_RX_BUF_SIZE - ctx->wrPos);
+    if (readLen <= 0) {
+      err = readLen < 0 ? errno : 0;
+      break;
+    }
+    ctx->wrPos += readLen;
+  }
+
+  if (ctx->wrPos > 0 || err == EAGAIN || err == EINTR) {
+    ctx->lastErrno = 0;
+    return;
+  }
+
+  /* Woken up with nothing to read: hang-up or I/O error, e.g. the adapter
+   * was unplugged. Report it once and back off instead of spinning on
+   * epoll until the port is re-initialized. */
+  if (err || (events & (EPOLLHUP | EPOLLERR))) {
+    err = err ? err : EIO;
+    if (err != ctx->lastErrno) {
+      printf("errno = %d\n", err);
+      errno = err;
+      perror("OsdkLinux_UartReadData");
+      ctx->lastErrno = err;
+    }
+    usleep(OSDK_UART_READ_TIMEOUT_MS * 1000);
+  }
+}
+
+static void OsdkLinux_UartSetLowLatency(int fd) {
+#if OSDK_UART_LOW_LATENCY
+  struct serial_struct serial;
+
+  /* Not every tty driver supports it, e.g. pty or some CDC-ACM */
+  if (ioctl(fd, TIOCGSERIAL, &serial) == 0) {
+    serial.flags |= ASYNC_LOW_LATENCY;
+    ioctl(fd, TIOCSSERIAL, &serial);
+  }
+#endif
+}
+
 /**
  * @brief Uart interface send function.
  * @param obj: pointer to the hal object, which including uart interface parameters.
@@ -68,26 +224,70 @@ E_OsdkStat OsdkLinux_UartSendData(const T_HalObj *obj, const uint8_t *pBuf,
 }
 
 /**
- * @brief Uart interface send function.
+ * @brief Uart interface read function.
+ * Waits up to OSDK_UART_READ_TIMEOUT_MS for the port to become readable,
+ * drains everything the tty holds into the port's receive buffer with one
+ * read(), then hands out up to OSDK_UART_READ_ONCE_LEN bytes per call.
+ * A hot plug re-init of the port waits for the call to leave the receive
+ * context before it resets it.
  * @param obj: pointer to the hal object, which including uart interface parameters.
- * @param pBuf:  pointer to the buffer which is used to store receive data.
- * @param bufLen:  receive data length.
+ * @param pBuf:  pointer to the buffer which is used to store receive data,
+ * at least OSDK_UART_READ_ONCE_LEN bytes.
+ * @param bufLen:  number of bytes actually stored in pBuf, 0 on timeout.
  * @return an enum that represents a status of OSDK
  */
 E_OsdkStat OsdkLinux_UartReadData(const T_HalObj *obj, uint8_t *pBuf,
                                   uint32_t *bufLen) {
-  if ((obj == NULL) || (obj->uartObject.fd == -1)) {
+  T_UartRxContext *ctx;
+  uint32_t len;
+
+  if ((obj == NULL) || (obj->uartObject.fd == -1) || !pBuf || !bufLen) {
     return OSDK_STAT_ERR;
   }
-  ssize_t readLen = read(obj->uartObject.fd, pBuf, 1024);
-  if (readLen < 0) {
-    *bufLen = 0;
-    printf("errno = %d\n", errno);
-    perror("OsdkLinux_UartReadData");
-  } else {
-    *bufLen = readLen;
+  *bufLen = 0;
+
+  pthread_mutex_lock(&s_uartRxContextMutex);
+  ctx = OsdkLinux_UartGetRxContext(obj->uartObject.fd);
+  if (ctx) {
+    ctx->readers++;
+  }
+  pthread_mutex_unlock(&s_uartRxContextMutex);
+
+  if (ctx == NULL) {
+    /* No event context for this port, wait with poll() and read directly */
+    struct pollfd pfd = {.fd = obj->uartObject.fd, .events = POLLIN};
+    if (poll(&pfd, 1, OSDK_UART_READ_TIMEOUT_MS) > 0) {
+      ssize_t readLen = read(obj->uartObject.fd, pBuf, OSDK_UART_READ_ONCE_LEN);
+      if (readLen > 0) {
+        *bufLen = readLen;
+      } else if (readLen < 0) {
+        perror("OsdkLinux_UartReadData");
+        usleep(OSDK_UART_READ_TIMEOUT_MS * 1000);
+      }
+    }
+    return OSDK_STAT_OK;
   }
 
+  if (ctx->rdPos == ctx->wrPos) {
+    struct epoll_event event;
+    if (epoll_wait(ctx->epollFd, &event, 1, OSDK_UART_READ_TIMEOUT_MS) > 0) {
+      OsdkLinux_UartDrain(ctx, obj->uartObject.fd, event.events);
+    }
+  }
+
+  len = ctx->wrPos - ctx->rdPos;
+  if (len > OSDK_UART_READ_ONCE_LEN) {
+    len = OSDK_UART_READ_ONCE_LEN;
+  }
+  memcpy(pBuf, ctx->buf + ctx->rdPos, len);
+  ctx->rdPos += len;
+  *bufLen = len;
+
+  pthread_mutex_lock(&s_uartRxContextMutex);
+  ctx->readers--;
+  pthread_cond_broadcast(&s_uartRxContextCond);
+  pthread_mutex_unlock(&s_uartRxContextMutex);
+
   return OSDK_STAT_OK;
 }
 
@@ -100,6 +300,7 @@ E_OsdkStat OsdkLinux_UartClose(T_HalObj *obj) {
   if ((obj == NULL) || (obj->uartObject.fd == -1)) {
     return OSDK_STAT_ERR;
   }
+  OsdkLinux_UartReleaseRxContext(obj->uartObject.fd);
   close(obj->uartObject.fd);
 
   return OSDK_STAT_OK;
@@ -177,6 +378,11 @@ E_OsdkStat OsdkLinux_UartInit(const char *port, const int baudrate,
 
     goto out;
   }
+
+  OsdkLinux_UartSetLowLatency(obj->uartObject.fd);
+  if (OsdkLinux_UartCreateRxContext(obj->uartObject.fd) != OSDK_STAT_OK) {
+    printf("UART %s falls back to poll(), no free receive context\n", port);
+  }
 #ifdef OSDK_HOTPLUG
   OsdkLinux_UartHotPlugInit(port, baudrate, obj);
 #endif
@@ -52,8 +52,63 @@ extern "C" {
 #endif
 
 /* Exported constants --------------------------------------------------------*/
+/* Size of the per-port receive buffer, one read() drains up to this much */
+#ifndef OSDK_UART_RX_BUF_SIZE
+#define OSDK_UART_RX_BUF_SIZE 8192
+#endif
+
+/* Max bytes handed out per OsdkLinux_UartReadData() call */
+#ifndef OSDK_UART_READ_ONCE_LEN
+#define OSDK_UART_READ_ONCE_LEN 1024
+#endif
+
+/* How long OsdkLinux_UartReadData() waits for data on an idle port */
+#ifndef OSDK_UART_READ_TIMEOUT_MS
+#define OSDK_UART_READ_TIMEOUT_MS 20
+#endif
+
+/* Set ASYNC_LOW_LATENCY on the port, e.g. 1ms FTDI latency timer */
+#ifndef OSDK_UART_LOW_LATENCY
+#define OSDK_UART_LOW_LATENCY 1
+#endif
+
+/* Max number of UART ports open at the same time */
+#ifndef OSDK_UART_MAX_PORTS
+#define OSDK_UART_MAX_PORTS 4
+#endif
+
+#ifdef ADVANCED_SENSING
+/* IN transfers kept in flight per bulk channel by the asynchronous backend */
+#ifndef OSDK_USB_BULK_IN_TRANSFERS
+#define OSDK_USB_BULK_IN_TRANSFERS 8
+#endif
+
+/* Size of each IN transfer buffer, a multiple of the max packet size */
+#ifndef OSDK_USB_BULK_IN_BUF_SIZE
+#define OSDK_USB_BULK_IN_BUF_SIZE (16 * 1024)
+#endif
+
+/* Max number of bulk channels (interface + IN endpoint) open at once */
+#ifndef OSDK_USB_BULK_MAX_CHANNELS
+#define OSDK_USB_BULK_MAX_CHANNELS 8
+#endif
+
+/* How long an asynchronous read waits for data, 0 means forever */
+#ifndef OSDK_USB_BULK_READ_TIMEOUT_MS
+#define OSDK_USB_BULK_READ_TIMEOUT_MS 0
+#endif
+#endif
 
 /* Exported types ------------------------------------------------------------*/
+#ifdef ADVANCED_SENSING
+typedef struct {
+  uint64_t bytes;     /*!< bytes received on the channel */
+  uint64_t transfers; /*!< IN transfers completed with success */
+  uint32_t errors;    /*!< IN transfers completed with an error */
+  uint32_t underruns; /*!< times no IN transfer was left in flight */
+  uint32_t inFlight;  /*!< IN transfers currently submitted */
+} T_UsbBulkAsyncStats;
+#endif
 
 /* Exported functions --------------------------------------------------------*/
 
@@ -70,6 +125,18 @@ E_OsdkStat OsdkLinux_USBBulkSendData(const T_HalObj *obj, const uint8_t *pBuf,
 E_OsdkStat OsdkLinux_USBBulkReadData(const T_HalObj *obj, uint8_t *pBuf,
                                      uint32_t *bufLen);
 E_OsdkStat OsdkLinux_USBBulkClose(T_HalObj *obj);
+
+E_OsdkStat OsdkLinux_USBBulkAsyncInit(uint16_t pid, uint16_t vid, uint16_t num,
+                                      uint16_t epIn, uint16_t epOut,
+                                      T_HalObj *obj);
+E_OsdkStat OsdkLinux_USBBulkAsyncSendData(const T_HalObj *obj,
+                                          const uint8_t *pBuf,
+                                          uint32_t bufLen);
+E_OsdkStat OsdkLinux_USBBulkAsyncReadData(const T_HalObj *obj, uint8_t *pBuf,
+                                          uint32_t *bufLen);
+E_OsdkStat OsdkLinux_USBBulkAsyncClose(T_HalObj *obj);
+E_OsdkStat OsdkLinux_USBBulkAsyncGetStats(const T_HalObj *obj,
+                                          T_UsbBulkAsyncStats *stats);
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,481 @@
+/**
+ ********************************************************************
+ * @file    osdkhal_linux_usb_async.c
+ * @version V1.0.0
+ * @date    2026/10/15
+ * @brief   Asynchronous libusb bulk transport. Keeps a queue of IN transfers
+ * in flight on each bulk channel so the endpoint is never left without a
+ * pending request between two reads.
+ *
+ * @copyright (c) 2018-2019 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "osdkhal_linux.h"
+
+#ifdef ADVANCED_SENSING
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+  bool used;
+  /* Set once the device is gone, the channel only waits to be closed */
+  bool dead;
+  bool closing;
+  bool reading;
+  struct libusb_device_handle *handle;
+  uint16_t epIn;
+
+  struct libusb_transfer *transfers[OSDK_USB_BULK_IN_TRANSFERS];
+  bool devMem[OSDK_USB_BULK_IN_TRANSFERS];
+  uint32_t transferNum;
+
+  /* Completed transfers in completion order, which on a single endpoint is
+   * also submission order. readOffset is how much of the first one has
+   * already been handed out. */
+  uint32_t doneQueue[OSDK_USB_BULK_IN_TRANSFERS];
+  uint32_t doneHead;
+  uint32_t doneCount;
+  uint32_t readOffset;
+
+  T_UsbBulkAsyncStats stats;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+} T_UsbBulkAsyncChannel;
+
+/* Private values ------------------------------------------------------------*/
+static T_UsbBulkAsyncChannel s_usbBulkAsyncChannel[OSDK_USB_BULK_MAX_CHANNELS];
+static pthread_mutex_t s_usbBulkAsyncMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t s_usbBulkEventThread;
+static volatile bool s_usbBulkEventThreadRun = false;
+static uint32_t s_usbBulkAsyncChannelCnt = 0;
+
+/* Private functions definition-----------------------------------------------*/
+static void *OsdkLinux_USBBulkEventTask(void *arg) {
+  struct timeval tv = {.tv_sec = 0, .tv_usec = 100 * 1000};
+
+  (void)arg;
+  while (s_usbBulkEventThreadRun) {
+    libusb_handle_events_timeout_completed(NULL, &tv, NULL);
+  }
+  return NULL;
+}
+
+static void LIBUSB_CALL
+OsdkLinux_USBBulkInCallback(struct libusb_transfer *transfer) {
+  T_UsbBulkAsyncChannel *channel = (T_UsbBulkAsyncChannel *)transfer->user_data;
+  uint32_t index = 0;
+  uint32_t inFlight;
+
+  while (channel->transfers[index] != transfer) {
+    index++;
+  }
+
+  pthread_mutex_lock(&channel->mutex);
+  switch (transfer->status) {
+    case LIBUSB_TRANSFER_COMPLETED:
+      channel->stats.bytes += transfer->actual_length;
+      channel->stats.transfers++;
+      break;
+    case LIBUSB_TRANSFER_CANCELLED:
+      break;
+    case LIBUSB_TRANSFER_NO_DEVICE:
+      channel->dead = true;
+      break;
+    default:
+      /* Stall, overflow, timeout: hand it back empty so it is resubmitted */
+      transfer->actual_length = 0;
+      channel->stats.errors++;
+      break;
+  }
+
+  if (!channel->closing && !channel->dead) {
+    channel->doneQueue[(channel->doneHead + channel->doneCount) %
+                       channel->transferNum] = index;
+    channel->doneCount++;
+  }
+
+  inFlight = --channel->stats.inFlight;
+  if (inFlight == 0 && !channel->closing && !channel->dead) {
+    /* Every buffer is full and waiting for the reader, the device has
+     * nowhere to put new data until one is handed back. */
+    channel->stats.underruns++;
+  }
+  pthread_cond_broadcast(&channel->cond);
+  pthread_mutex_unlock(&channel->mutex);
+}
+
+static void OsdkLinux_USBBulkFreeTransfers(T_UsbBulkAsyncChannel *channel) {
+  for (uint32_t i = 0; i < channel->transferNum; i++) {
+    struct libusb_transfer *transfer = channel->transfers[i];
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+    if (channel->devMem[i]) {
+      libusb_dev_mem_free(channel->handle, transfer->buffer,
+                          OSDK_USB_BULK_IN_BUF_SIZE);
+    } else {
+      free(transfer->buffer);
+    }
+#else
+    free(transfer->buffer);
+#endif
+    libusb_free_transfer(transfer);
+    channel->transfers[i] = NULL;
+  }
+  channel->transferNum = 0;
+}
+
+/* Cancels everything in flight and waits for the event thread to confirm */
+static void OsdkLinux_USBBulkStopChannel(T_UsbBulkAsyncChannel *channel) {
+  /* Wake the reader up and let it leave first, so it cannot resubmit a
+   * transfer behind the cancellation below. */
+  pthread_mutex_lock(&channel->mutex);
+  channel->closing = true;
+  pthread_cond_broadcast(&channel->cond);
+  while (channel->reading) {
+    pthread_cond_wait(&channel->cond, &channel->mutex);
+  }
+  pthread_mutex_unlock(&channel->mutex);
+
+  for (uint32_t i = 0; i < channel->transferNum; i++) {
+    libusb_cancel_transfer(channel->transfers[i]);
+  }
+
+  pthread_mutex_lock(&channel->mutex);
+  while (channel->stats.inFlight > 0) {
+    pthread_cond_wait(&channel->cond, &channel->mutex);
+  }
+  pthread_mutex_unlock(&channel->mutex);
+
+  OsdkLinux_USBBulkFreeTransfers(channel);
+  pthread_cond_destroy(&channel->cond);
+  pthread_mutex_destroy(&channel->mutex);
+  channel->used = false;
+
+  if (--s_usbBulkAsyncChannelCnt == 0) {
+    s_usbBulkEventThreadRun = false;
+    pthread_join(s_usbBulkEventThread, NULL);
+  }
+}
+
+static E_OsdkStat OsdkLinux_USBBulkSubmit(T_UsbBulkAsyncChannel *channel,
+                                          uint32_t index) {
+  pthread_mutex_lock(&channel->mutex);
+  if (channel->closing || channel->dead) {
+    pthread_mutex_unlock(&channel->mutex);
+    return OSDK_STAT_ERR;
+  }
+  channel->stats.inFlight++;
+  pthread_mutex_unlock(&channel->mutex);
+
+  if (libusb_submit_transfer(channel->transfers[index]) != LIBUSB_SUCCESS) {
+    pthread_mutex_lock(&channel->mutex);
+    channel->stats.inFlight--;
+    channel->dead = true;
+    pthread_cond_broadcast(&channel->cond);
+    pthread_mutex_unlock(&channel->mutex);
+    return OSDK_STAT_ERR;
+  }
+  return OSDK_STAT_OK;
+}
+
+static T_UsbBulkAsyncChannel *
+OsdkLinux_USBBulkFindChannel(struct libusb_device_handle *handle,
+                             uint16_t epIn) {
+  for (int i = 0; i < OSDK_USB_BULK_MAX_CHANNELS; i++) {
+    T_UsbBulkAsyncChannel *channel = &s_usbBulkAsyncChannel[i];
+    if (channel->used && channel->handle == handle && channel->epIn == epIn) {
+      return channel;
+    }
+  }
+  return NULL;
+}
+
+/* Sets up the IN transfer queue of a channel and starts the event thread
+ * with the first channel. Called from the reader on first use, so a handle
+ * reopened by the hot plug thread gets a fresh queue; channels whose device
+ * went away are reclaimed here. */
+static T_UsbBulkAsyncChannel *
+OsdkLinux_USBBulkOpenChannel(struct libusb_device_handle *handle,
+                             uint16_t epIn) {
+  T_UsbBulkAsyncChannel *channel = NULL;
+
+  pthread_mutex_lock(&s_usbBulkAsyncMutex);
+  channel = OsdkLinux_USBBulkFindChannel(handle, epIn);
+  if (channel) {
+    pthread_mutex_unlock(&s_usbBulkAsyncMutex);
+    return channel;
+  }
+
+  for (int i = 0; i < OSDK_USB_BULK_MAX_CHANNELS; i++) {
+    T_UsbBulkAsyncChannel *cur = &s_usbBulkAsyncChannel[i];
+    if (cur->used && cur->dead) {
+      OsdkLinux_USBBulkStopChannel(cur);
+    }
+    if (!cur->used && channel == NULL) {
+      channel = cur;
+    }
+  }
+  if (channel == NULL) {
+    pthread_mutex_unlock(&s_usbBulkAsyncMutex);
+    return NULL;
+  }
+
+  memset(channel, 0, sizeof(*channel));
+  channel->handle = handle;
+  channel->epIn = epIn;
+  pthread_mutex_init(&channel->mutex, NULL);
+  pthread_cond_init(&channel->cond, NULL);
+
+  for (uint32_t i = 0; i < OSDK_USB_BULK_IN_TRANSFERS; i++) {
+    struct libusb_transfer *transfer = libusb_alloc_transfer(0);
+    uint8_t *buf = NULL;
+
+    if (!transfer) {
+      break;
+    }
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+    /* DMA-able memory mapped from usbfs, saves a copy in the kernel */
+    buf = libusb_dev_mem_alloc(handle, OSDK_USB_BULK_IN_BUF_SIZE);
+    channel->devMem[i] = (buf != NULL);
+#endif
+    if (!buf) {
+      buf = malloc(OSDK_USB_BULK_IN_BUF_SIZE);
+    }
+    if (!buf) {
+      libusb_free_transfer(transfer);
+      break;
+    }
+
+    libusb_fill_bulk_transfer(transfer, handle, epIn, buf,
+                              OSDK_USB_BULK_IN_BUF_SIZE,
+                              OsdkLinux_USBBulkInCallback, channel, 0);
+    channel->transfers[i] = transfer;
+    channel->transferNum++;
+  }
+  if (channel->transferNum == 0) {
+    pthread_cond_destroy(&channel->cond);
+    pthread_mutex_destroy(&channel->mutex);
+    pthread_mutex_unlock(&s_usbBulkAsyncMutex);
+    return NULL;
+  }
+
+  channel->used = true;
+  if (s_usbBulkAsyncChannelCnt++ == 0) {
+    s_usbBulkEventThreadRun = true;
+    if (pthread_create(&s_usbBulkEventThread, NULL,
+                       OsdkLinux_USBBulkEventTask, NULL) != 0) {
+      s_usbBulkEventThreadRun = false;
+      s_usbBulkAsyncChannelCnt--;
+      OsdkLinux_USBBulkFreeTransfers(channel);
+      pthread_cond_destroy(&channel->cond);
+      pthread_mutex_destroy(&channel->mutex);
+      channel->used = false;
+      pthread_mutex_unlock(&s_usbBulkAsyncMutex);
+      return NULL;
+    }
+  }
+
+  for (uint32_t i = 0; i < channel->transferNum; i++) {
+    if (OsdkLinux_USBBulkSubmit(channel, i) != OSDK_STAT_OK) {
+      break;
+    }
+  }
+  pthread_mutex_unlock(&s_usbBulkAsyncMutex);
+
+  return channel;
+}
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Asynchronous USBBulk interface init function, same parameters as
+ * OsdkLinux_USBBulkInit. The IN transfer queue is started by the first read.
+ * @return an enum that represents a status of OSDK
+ */
+E_OsdkStat OsdkLinux_USBBulkAsyncInit(uint16_t pid, uint16_t vid, uint16_t num,
+                                      uint16_t epIn, uint16_t epOut,
+                                      T_HalObj *obj) {
+  return OsdkLinux_USBBulkInit(pid, vid, num, epIn, epOut, obj);
+}
+
+/**
+ * @brief Asynchronous USBBulk interface send function. OUT traffic is only
+ * commands and acks, so it keeps using the synchronous path.
+ * @return an enum that represents a status of OSDK
+ */
+E_OsdkStat OsdkLinux_USBBulkAsyncSendData(const T_HalObj *obj,
+                                          const uint8_t *pBuf,
+                                          uint32_t bufLen) {
+  return OsdkLinux_USBBulkSendData(obj, pBuf, bufLen);
+}
+
+/**
+ * @brief Asynchronous USBBulk interface read function.
+ * Hands out the data of the oldest completed IN transfer, and puts the
+ * transfer back in flight once all of it has been read.
+ * @param obj: pointer to the hal object, which including USBBulk interface parameters.
+ * @param pBuf:  pointer to the buffer which is used to store receive data.
+ * @param bufLen:  size of pBuf in, number of bytes stored in pBuf out.
+ * @return OSDK_STAT_ERR_TIMEOUT if nothing arrived within
+ * OSDK_USB_BULK_READ_TIMEOUT_MS, OSDK_STAT_ERR if the device is gone.
+ */
+E_OsdkStat OsdkLinux_USBBulkAsyncReadData(const T_HalObj *obj, uint8_t *pBuf,
+                                          uint32_t *bufLen) {
+  T_UsbBulkAsyncChannel *channel;
+  struct libusb_transfer *transfer;
+  struct timespec ts;
+  E_OsdkStat stat = OSDK_STAT_OK;
+  uint32_t index;
+  uint32_t len = 0;
+
+  if ((obj == NULL) || (obj->bulkObject.handle == NULL) || !pBuf || !bufLen) {
+    return OSDK_STAT_ERR;
+  }
+
+  channel = OsdkLinux_USBBulkFindChannel(obj->bulkObject.handle,
+                                         obj->bulkObject.epIn);
+  if (channel == NULL) {
+    channel = OsdkLinux_USBBulkOpenChannel(obj->bulkObject.handle,
+                                           obj->bulkObject.epIn);
+    if (channel == NULL) {
+      return OsdkLinux_USBBulkReadData(obj, pBuf, bufLen);
+    }
+  }
+
+#if OSDK_USB_BULK_READ_TIMEOUT_MS
+  clock_gettime(CLOCK_REALTIME, &ts);
+  ts.tv_sec += OSDK_USB_BULK_READ_TIMEOUT_MS / 1000;
+  ts.tv_nsec += (OSDK_USB_BULK_READ_TIMEOUT_MS % 1000) * 1000000L;
+  if (ts.tv_nsec >= 1000000000L) {
+    ts.tv_sec++;
+    ts.tv_nsec -= 1000000000L;
+  }
+#else
+  (void)ts;
+#endif
+
+  pthread_mutex_lock(&channel->mutex);
+  channel->reading = true;
+  while (len == 0) {
+    while (channel->doneCount == 0 && !channel->dead && !channel->closing) {
+#if OSDK_USB_BULK_READ_TIMEOUT_MS
+      if (pthread_cond_timedwait(&channel->cond, &channel->mutex, &ts) ==
+          ETIMEDOUT) {
+        break;
+      }
+#else
+      pthread_cond_wait(&channel->cond, &channel->mutex);
+#endif
+    }
+    if (channel->closing || (channel->doneCount == 0 && channel->dead)) {
+      stat = OSDK_STAT_ERR;
+      break;
+    }
+    if (channel->doneCount == 0) {
+      stat = OSDK_STAT_ERR_TIMEOUT;
+      break;
+    }
+
+    index = channel->doneQueue[channel->doneHead];
+    transfer = channel->transfers[index];
+    len = transfer->actual_length - channel->readOffset;
+    if (len > *bufLen) {
+      len = *bufLen;
+    }
+    memcpy(pBuf, transfer->buffer + channel->readOffset, len);
+    channel->readOffset += len;
+
+    if (channel->readOffset == (uint32_t)transfer->actual_length) {
+      channel->doneHead = (channel->doneHead + 1) % channel->transferNum;
+      channel->doneCount--;
+      channel->readOffset = 0;
+
+      /* Empty completions (errors, zero-length packets) just go back in
+       * flight and the wait goes on. */
+      pthread_mutex_unlock(&channel->mutex);
+      OsdkLinux_USBBulkSubmit(channel, index);
+      pthread_mutex_lock(&channel->mutex);
+    }
+  }
+  channel->reading = false;
+  pthread_cond_broadcast(&channel->cond);
+  pthread_mutex_unlock(&channel->mutex);
+
+  *bufLen = len;
+  return stat;
+}
+
+/**
+ * @brief Asynchronous USBBulk interface close function.
+ * Cancels the IN transfers of the channel before closing the handle.
+ * @return an enum that represents a status of OSDK
+ */
+E_OsdkStat OsdkLinux_USBBulkAsyncClose(T_HalObj *obj) {
+  T_UsbBulkAsyncChannel *channel;
+
+  if ((obj == NULL) || (obj->bulkObject.handle == NULL)) {
+    return OSDK_STAT_ERR;
+  }
+
+  pthread_mutex_lock(&s_usbBulkAsyncMutex);
+  channel = OsdkLinux_USBBulkFindChannel(obj->bulkObject.handle,
+                                         obj->bulkObject.epIn);
+  if (channel) {
+    OsdkLinux_USBBulkStopChannel(channel);
+  }
+  pthread_mutex_unlock(&s_usbBulkAsyncMutex);
+
+  return OsdkLinux_USBBulkClose(obj);
+}
+
+/**
+ * @brief Get the counters of a bulk channel, all zero before its first read.
+ * Throughput is the difference of bytes between two calls over the time
+ * between them.
+ * @return OSDK_STAT_ERR if the channel is not running.
+ */
+E_OsdkStat OsdkLinux_USBBulkAsyncGetStats(const T_HalObj *obj,
+                                          T_UsbBulkAsyncStats *stats) {
+  T_UsbBulkAsyncChannel *channel;
+
+  if ((obj == NULL) || (obj->bulkObject.handle == NULL) || !stats) {
+    return OSDK_STAT_ERR;
+  }
+
+  memset(stats, 0, sizeof(*stats));
+  pthread_mutex_lock(&s_usbBulkAsyncMutex);
+  channel = OsdkLinux_USBBulkFindChannel(obj->bulkObject.handle,
+                                         obj->bulkObject.epIn);
+  if (channel) {
+    pthread_mutex_lock(&channel->mutex);
+    *stats = channel->stats;
+    pthread_mutex_unlock(&channel->mutex);
+  }
+  pthread_mutex_unlock(&s_usbBulkAsyncMutex);
+
+  return channel ? OSDK_STAT_OK : OSDK_STAT_ERR;
+}
+
+#endif
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -193,9 +193,9 @@ static void OPDownloadFileTask(MopPipeline *OP_Pipeline) {
         if (fp == NULL) throw std::runtime_error("open file error");
 
         while (1) {
-          memset(recvBuf, 0, RELIABLE_READ_ONCE_BUFFER_SIZE);
-          MopPipeline::DataPackType readPacket = {(uint8_t *)recvBuf, RELIABLE_READ_ONCE_BUFFER_SIZE};
-          mopRet = OP_Pipeline->recvData(readPacket, &readPacket.length);
+          /*! The packet is parsed in the buffer of the pipeline */
+          MopPipeline::DataPackType readPacket = {NULL, 0};
+          mopRet = OP_Pipeline->recvLease(RELIABLE_READ_ONCE_BUFFER_SIZE, &readPacket);
           if (mopRet != MOP_PASSED) {
             DERROR("recv whole file data failed!, realLen = %d\n", readPacket.length);
             //break;
@@ -208,7 +208,9 @@ static void OPDownloadFileTask(MopPipeline *OP_Pipeline) {
             MD5_Update(&ctx, fileData->data.fileData, fileData->dataLen);
             cnt++;
             DSTATUS("recv cnt %d!\n", cnt);
-            if (fileData->subcmd == END_PACK) break;
+            bool endPack = (fileData->subcmd == END_PACK);
+            OP_Pipeline->releaseLease();
+            if (endPack) break;
           }
         }
         MD5_Final(md5_out, &ctx);
@@ -25,13 +25,25 @@
  */
 
 /* Includes ------------------------------------------------------------------*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* for sem_clockwait */
+#endif
 #include "osdkosal_linux.h"
+#include <errno.h>
 
 /* Private constants ---------------------------------------------------------*/
+#define OSDK_LINUX_NSEC_PER_SEC 1000000000ULL
+
+/* sem_clockwait() lets timed waits run on the monotonic clock as well */
+#if defined(__GLIBC__) && \
+    ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 30)))
+#define OSDK_LINUX_SEM_CLOCKWAIT 1
+#endif
 
 /* Private types -------------------------------------------------------------*/
 
 /* Private functions declaration ---------------------------------------------*/
+static uint64_t OsdkLinux_ClockNs(clockid_t clock);
 
 /* Exported functions definition ---------------------------------------------*/
 
@@ -206,20 +218,23 @@ E_OsdkStat OsdkLinux_SemaphoreTimedWait(T_OsdkSemHandle semaphore,
                                         uint32_t waitTime) {
   int result;
   struct timespec semaphoreWaitTime;
-  struct timeval systemTime;
+  uint64_t deadlineNs;
 
-  gettimeofday(&systemTime, NULL);
-
-  systemTime.tv_usec += waitTime * 1000;
-  if (systemTime.tv_usec >= 1000000) {
-    systemTime.tv_sec += systemTime.tv_usec / 1000000;
-    systemTime.tv_usec %= 1000000;
-  }
-
-  semaphoreWaitTime.tv_sec = systemTime.tv_sec;
-  semaphoreWaitTime.tv_nsec = systemTime.tv_usec * 1000;
-
-  result = sem_timedwait(semaphore, &semaphoreWaitTime);
+#ifdef OSDK_LINUX_SEM_CLOCKWAIT
+  deadlineNs = OsdkLinux_ClockNs(CLOCK_MONOTONIC) + (uint64_t)waitTime * 1000000;
+#else
+  deadlineNs = OsdkLinux_ClockNs(CLOCK_REALTIME) + (uint64_t)waitTime * 1000000;
+#endif
+  semaphoreWaitTime.tv_sec = deadlineNs / OSDK_LINUX_NSEC_PER_SEC;
+  semaphoreWaitTime.tv_nsec = deadlineNs % OSDK_LINUX_NSEC_PER_SEC;
+
+  do {
+#ifdef OSDK_LINUX_SEM_CLOCKWAIT
+    result = sem_clockwait(semaphore, CLOCK_MONOTONIC, &semaphoreWaitTime);
+#else
+    result = sem_timedwait(semaphore, &semaphoreWaitTime);
+#endif
+  } while (result != 0 && errno == EINTR);
   if (result != 0) {
     return OSDK_STAT_ERR;
   }
@@ -245,33 +260,67 @@ E_OsdkStat OsdkLinux_SemaphorePost(T_OsdkSemHandle semaphore) {
 
 /**
  * @brief Get the system time for ms.
+ * @note The time is monotonic, it doesn't jump with NTP or date changes.
  * @param us: time of system, uint:ms
  * @return an enum that represents a status of OSDK
  */
 E_OsdkStat OsdkLinux_GetTimeMs(uint32_t *ms) {
-  struct timeval time;
-
-  gettimeofday(&time, NULL);
-  *ms = (time.tv_sec * 1000 + time.tv_usec / 1000);
+  *ms = (uint32_t)(OsdkLinux_ClockNs(CLOCK_MONOTONIC) / 1000000);
 
   return OSDK_STAT_OK;
 }
 
 /**
- * @brief Get the system time for us, os related.
+ * @brief Get the monotonic system time for us.
  * @param us: time of system, uint:us
  * @return an enum that represents a status of OSDK
  */
-#ifdef OS_DEBUG
 E_OsdkStat OsdkLinux_GetTimeUs(uint64_t *us) {
-  struct timeval time;
+  *us = OsdkLinux_ClockNs(CLOCK_MONOTONIC) / 1000;
+
+  return OSDK_STAT_OK;
+}
 
-  gettimeofday(&time, NULL);
-  *us = (time.tv_sec * 1000000 + time.tv_usec);
+/**
+ * @brief Get the monotonic system time for ns.
+ * @param ns: time of system, uint:ns
+ * @return an enum that represents a status of OSDK
+ */
+E_OsdkStat OsdkLinux_GetTimeNs(uint64_t *ns) {
+  *ns = OsdkLinux_ClockNs(CLOCK_MONOTONIC);
 
   return OSDK_STAT_OK;
 }
-#endif
+
+/**
+ * @brief Sleep until an absolute monotonic time, so periodic loops don't
+ * accumulate the drift of relative sleeps.
+ * @param deadlineNs: wake up time, same base as OsdkLinux_GetTimeNs, uint:ns
+ * @return an enum that represents a status of OSDK
+ */
+E_OsdkStat OsdkLinux_TaskSleepUntilNs(uint64_t deadlineNs) {
+  struct timespec deadline;
+  int result;
+
+  deadline.tv_sec = deadlineNs / OSDK_LINUX_NSEC_PER_SEC;
+  deadline.tv_nsec = deadlineNs % OSDK_LINUX_NSEC_PER_SEC;
+
+  do {
+    result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+  } while (result == EINTR);
+  if (result != 0) {
+    return OSDK_STAT_ERR;
+  }
+
+  return OSDK_STAT_OK;
+}
+
+static uint64_t OsdkLinux_ClockNs(clockid_t clock) {
+  struct timespec time;
+
+  clock_gettime(clock, &time);
+  return (uint64_t)time.tv_sec * OSDK_LINUX_NSEC_PER_SEC + time.tv_nsec;
+}
 
 void *OsdkLinux_Malloc(uint32_t size)
 {
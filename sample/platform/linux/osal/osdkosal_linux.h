@@ -36,6 +36,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/time.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "osdk_typedef.h"
@@ -70,10 +71,9 @@ E_OsdkStat OsdkLinux_SemaphoreTimedWait(T_OsdkSemHandle semaphore,
 E_OsdkStat OsdkLinux_SemaphorePost(T_OsdkSemHandle semaphore);
 
 E_OsdkStat OsdkLinux_GetTimeMs(uint32_t *ms);
-
-#ifdef OS_DEBUG
 E_OsdkStat OsdkLinux_GetTimeUs(uint64_t *us);
-#endif
+E_OsdkStat OsdkLinux_GetTimeNs(uint64_t *ns);
+E_OsdkStat OsdkLinux_TaskSleepUntilNs(uint64_t deadlineNs);
 void *OsdkLinux_Malloc(uint32_t size);
 void OsdkLinux_Free(void *ptr);
 
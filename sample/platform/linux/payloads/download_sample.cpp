@@ -43,6 +43,18 @@ void fileListReqCB(E_OsdkStat ret_code, const FilePackage file_list, void* udata
   }
 }
 
+void fileListBatchCB(E_OsdkStat ret_code, const std::vector<MediaFile> &files,
+                     uint32_t amount, bool finished, void *udata) {
+  cur_file_list.type = FileType::MEDIA;
+  cur_file_list.media.insert(cur_file_list.media.end(), files.begin(),
+                             files.end());
+  for (auto &file : files) printMediaFileMsg(file);
+  if (finished) {
+    DSTATUS("\033[1;32;40m##[%s] : ret = %d, %d files kept of %u \033[0m",
+            udata, ret_code, cur_file_list.media.size(), amount);
+  }
+}
+
 bool fileDataDownloadFinished = false;
 void fileDataReqCB(E_OsdkStat ret_code, void *udata) {
   if (ret_code == OSDK_STAT_OK) {
@@ -53,6 +65,28 @@ void fileDataReqCB(E_OsdkStat ret_code, void *udata) {
   fileDataDownloadFinished = true;
 }
 
+void batchFileCB(E_OsdkStat ret_code, uint32_t jobIndex, uint64_t fileSize,
+                 void *udata) {
+  if (ret_code == OSDK_STAT_OK) {
+    DSTATUS("\033[1;32;40m##Download file [%s] successfully, %llu bytes. \033[0m",
+            cur_file_list.media[jobIndex].fileName.c_str(),
+            (long long unsigned int)fileSize);
+  } else {
+    DERROR("\033[1;31;40m##Download file [%s] failed. \033[0m",
+           cur_file_list.media[jobIndex].fileName.c_str());
+  }
+}
+
+void batchProgressCB(const FileMgr::BatchProgress &progress, bool finished,
+                     void *udata) {
+  if (finished) {
+    DSTATUS("Batch download over : %u/%u files in %ums, avg %u kB/s",
+            progress.filesDone, progress.filesTotal, progress.elapsedMs,
+            progress.avgBytesPerSec / 1000);
+    fileDataDownloadFinished = true;
+  }
+}
+
 using namespace DJI::OSDK;
 using namespace DJI::OSDK::Telemetry;
 
@@ -74,6 +108,10 @@ int main(int argc, char **argv) {
         << std::endl
         << "| [b] Download main camera filedata from case a                  |"
         << std::endl
+        << "| [c] Download all main camera files from case a in one batch    |"
+        << std::endl
+        << "| [d] Stream the main camera JPEG list, 20 files at a time       |"
+        << std::endl
         << "| [q] Quit                                                       |"
         << std::endl;
     char inputChar = 0;
@@ -137,6 +175,45 @@ int main(int argc, char **argv) {
         }
         break;
       }
+      case 'c': {
+        std::vector<CameraManager::MediaDownloadJob> jobs;
+        for (auto &file : cur_file_list.media) {
+          CameraManager::MediaDownloadJob job;
+          job.index = PAYLOAD_INDEX_0;
+          job.fileIndex = file.fileIndex;
+          job.localPath = "./" + file.fileName;
+          jobs.push_back(job);
+        }
+        DSTATUS("Now try to download %d media files from main camera.", jobs.size());
+        fileDataDownloadFinished = false;
+        ErrorCode::ErrorCodeType ret = vehicle->cameraManager->startBatchDownload(
+          jobs, batchFileCB, batchProgressCB, NULL);
+        ErrorCode::printErrorCodeMsg(ret);
+        while ((ret == ErrorCode::SysCommonErr::Success) &&
+               (fileDataDownloadFinished == false)) {
+          OsdkOsal_TaskSleepMs(1000);
+        }
+        break;
+      }
+      case 'd': {
+        ErrorCode::ErrorCodeType ret;
+        vehicle->cameraManager->setModeSync(PAYLOAD_INDEX_0,
+                                            CameraModule::WorkMode::PLAYBACK,
+                                            2);
+        ret = vehicle->cameraManager->obtainDownloadRightSync(PAYLOAD_INDEX_0,
+                                                              true, 2);
+        ErrorCode::printErrorCodeMsg(ret);
+        DSTATUS("Try to stream the JPEG file list  .......");
+        cur_file_list.media.clear();
+        FileMgr::FileListFilter filter = {};
+        filter.typeMask = 1 << (int)MediaFileType::JPEG;
+        filter.batchSize = 20;
+        ret = vehicle->cameraManager->startReqFileListStream(
+          PAYLOAD_INDEX_0, filter, fileListBatchCB,
+          (void*)("Stream main camera JPEG list"));
+        ErrorCode::printErrorCodeMsg(ret);
+        break;
+      }
       case 'q':
         DSTATUS("Quit now ...");
         return 0;